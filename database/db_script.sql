@@ -51,9 +51,102 @@ CREATE UNIQUE INDEX tournament_group_unique_name_idx ON GROUPS (tournament_id,(d
 CREATE TABLE MATCHES (
     id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
     document JSONB NOT NULL,
+    tournament_id UUID GENERATED ALWAYS AS ((document->>'tournamentId')::uuid) STORED,
+    round SMALLINT GENERATED ALWAYS AS ((document->>'round')::smallint) STORED,
+    played BOOLEAN GENERATED ALWAYS AS (document->'score' IS NOT NULL) STORED,
+    -- Se incrementa en cada UPDATE; MatchRepository::Update lo compara para detectar escrituras concurrentes
+    version INTEGER NOT NULL DEFAULT 0,
     last_update_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
     created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
+CREATE INDEX match_tournament_played_round_idx ON MATCHES (tournament_id, played, round);
+CREATE INDEX match_tournament_round_idx ON MATCHES (tournament_id, round);
+-- Bases creadas antes de las columnas generadas (reescribe la tabla; correr con el servicio detenido):
+-- ALTER TABLE MATCHES
+--     ADD COLUMN tournament_id UUID GENERATED ALWAYS AS ((document->>'tournamentId')::uuid) STORED,
+--     ADD COLUMN round SMALLINT GENERATED ALWAYS AS ((document->>'round')::smallint) STORED,
+--     ADD COLUMN played BOOLEAN GENERATED ALWAYS AS (document->'score' IS NOT NULL) STORED;
+-- CREATE INDEX match_tournament_played_round_idx ON MATCHES (tournament_id, played, round);
+-- CREATE INDEX match_tournament_round_idx ON MATCHES (tournament_id, round);
+-- Bases creadas antes de la columna version:
+-- ALTER TABLE MATCHES ADD COLUMN version INTEGER NOT NULL DEFAULT 0;
+
+-- Versión de cambios por torneo: los triggers de GROUPS y MATCHES la incrementan en la
+-- misma transacción que la escritura, y los listados la usan como ETag. El lock de la
+-- fila ordena los incrementos concurrentes. Sin fila, las dos versiones valen 0.
+-- Bases creadas antes de esta tabla: ejecutar desde aquí hasta los triggers y repetir los GRANT del final.
+CREATE TABLE TOURNAMENT_CHANGES (
+    tournament_id UUID PRIMARY KEY REFERENCES TOURNAMENTS(ID) ON DELETE CASCADE,
+    groups_version BIGINT NOT NULL DEFAULT 0,
+    matches_version BIGINT NOT NULL DEFAULT 0
+);
+
+-- El join con TOURNAMENTS descarta los torneos que ya no existen, como en el borrado en cascada
+CREATE FUNCTION bump_groups_version() RETURNS trigger AS $$
+BEGIN
+    INSERT INTO TOURNAMENT_CHANGES AS c (tournament_id, groups_version)
+        SELECT DISTINCT r.tournament_id, 1 FROM changed_rows r JOIN TOURNAMENTS t ON t.id = r.tournament_id
+    ON CONFLICT (tournament_id) DO UPDATE SET groups_version = c.groups_version + 1;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE FUNCTION bump_matches_version() RETURNS trigger AS $$
+BEGIN
+    INSERT INTO TOURNAMENT_CHANGES AS c (tournament_id, matches_version)
+        SELECT DISTINCT r.tournament_id, 1 FROM changed_rows r JOIN TOURNAMENTS t ON t.id = r.tournament_id
+    ON CONFLICT (tournament_id) DO UPDATE SET matches_version = c.matches_version + 1;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+-- Un trigger por evento porque las tablas de transición no admiten varios eventos
+CREATE TRIGGER groups_insert_version AFTER INSERT ON GROUPS
+    REFERENCING NEW TABLE AS changed_rows FOR EACH STATEMENT EXECUTE FUNCTION bump_groups_version();
+CREATE TRIGGER groups_update_version AFTER UPDATE ON GROUPS
+    REFERENCING NEW TABLE AS changed_rows FOR EACH STATEMENT EXECUTE FUNCTION bump_groups_version();
+CREATE TRIGGER groups_delete_version AFTER DELETE ON GROUPS
+    REFERENCING OLD TABLE AS changed_rows FOR EACH STATEMENT EXECUTE FUNCTION bump_groups_version();
+CREATE TRIGGER matches_insert_version AFTER INSERT ON MATCHES
+    REFERENCING NEW TABLE AS changed_rows FOR EACH STATEMENT EXECUTE FUNCTION bump_matches_version();
+CREATE TRIGGER matches_update_version AFTER UPDATE ON MATCHES
+    REFERENCING NEW TABLE AS changed_rows FOR EACH STATEMENT EXECUTE FUNCTION bump_matches_version();
+CREATE TRIGGER matches_delete_version AFTER DELETE ON MATCHES
+    REFERENCING OLD TABLE AS changed_rows FOR EACH STATEMENT EXECUTE FUNCTION bump_matches_version();
+
+-- Tabla de posiciones por equipo (fase regular). La mantiene el consumer con cada
+-- match.score-updated; los equipos que aún no juegan no tienen fila.
+CREATE TABLE STANDINGS (
+    tournament_id UUID NOT NULL REFERENCES TOURNAMENTS(ID) ON DELETE CASCADE,
+    team_id UUID NOT NULL,
+    wins INTEGER NOT NULL DEFAULT 0,
+    losses INTEGER NOT NULL DEFAULT 0,
+    ties INTEGER NOT NULL DEFAULT 0,
+    points_for INTEGER NOT NULL DEFAULT 0,
+    points_against INTEGER NOT NULL DEFAULT 0,
+    PRIMARY KEY (tournament_id, team_id)
+);
+-- Lo que STANDINGS ya contó de cada match (columnas nulas: nada). Con esto un evento
+-- repetido no cuenta dos veces y un marcador corregido resta el anterior.
+CREATE TABLE STANDINGS_APPLIED (
+    match_id UUID PRIMARY KEY,
+    tournament_id UUID REFERENCES TOURNAMENTS(ID) ON DELETE CASCADE,
+    home_id UUID,
+    visitor_id UUID,
+    home_score INTEGER,
+    visitor_score INTEGER
+);
+-- Bases con marcadores anteriores a estas tablas, para cargar lo ya jugado:
+-- INSERT INTO STANDINGS_APPLIED
+--     SELECT id, tournament_id, (document->'home'->>'id')::uuid, (document->'visitor'->>'id')::uuid,
+--            (document->'score'->>'home')::int, (document->'score'->>'visitor')::int
+--     FROM MATCHES WHERE round = 0 AND played;
+-- INSERT INTO STANDINGS
+--     SELECT tournament_id, team_id, sum((pf > pa)::int), sum((pf < pa)::int), sum((pf = pa)::int), sum(pf), sum(pa)
+--     FROM (SELECT tournament_id, home_id, home_score, visitor_score FROM STANDINGS_APPLIED
+--           UNION ALL
+--           SELECT tournament_id, visitor_id, visitor_score, home_score FROM STANDINGS_APPLIED) r(tournament_id, team_id, pf, pa)
+--     GROUP BY tournament_id, team_id;
 
 GRANT SELECT ON ALL TABLES IN SCHEMA public TO tournament_svc;
 GRANT DELETE ON ALL TABLES IN SCHEMA public TO tournament_svc;
@@ -74,14 +74,24 @@ class TournamentUser(HttpUser):
                 response.failure(f"Tournament selection failed: {response.status_code}")
 
     def get_pending_matches(self, tournament_id: Any | None):
+        # Last ETag and body per tournament; a 304 means the cached list is still current
+        if not hasattr(self, "pending_matches"):
+            self.pending_matches = {}
+        etag, cached = self.pending_matches.get(tournament_id, (None, []))
         with self.client.get(
                 f"/tournaments/{tournament_id}/matches?showMatches=pending",
+                headers={"If-None-Match": etag} if etag else None,
                 catch_response=True,
                 name=f"GET /tournaments/{tournament_id}/matches?showMatches=pending"
         ) as response:
+            if response.status_code == 304:
+                response.success()
+                return cached
             if response.status_code == 200 or response.status_code == 201:
                 # All pending matches
-                return response.json()
+                matches = response.json()
+                self.pending_matches[tournament_id] = (response.headers.get("ETag"), matches)
+                return matches
             else:
                 response.failure(f"Pending match selection failed: {response.status_code}")
                 return []
@@ -0,0 +1,158 @@
+//
+// Created by developer on 10/15/26.
+//
+// Compares checkout/return cost of the sharded ConnectionPool against the
+// previous single-mutex provider design at 4, 16 and 64 threads.
+// Usage: connection_pool_benchmark [poolSize] [iterationsPerThread]
+//
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <print>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "persistence/configuration/ConnectionPool.hpp"
+
+namespace {
+    // Stand-in for pqxx::connection: a checkout holds it for a short, fixed amount of work.
+    struct FakeConnection {
+        unsigned long counter = 0;
+
+        void Use() {
+            for (int i = 0; i < 64; i++) {
+                counter = counter * 31 + i;
+            }
+        }
+    };
+
+    // Replica of the previous PostgresConnectionProvider: one mutex and condition
+    // variable, a heap-allocated wrapper with a std::function deleter per checkout,
+    // and a dynamic_cast back to the concrete type on every use.
+    class IDbConnection {
+    public:
+        virtual ~IDbConnection() = default;
+    };
+
+    struct LegacyConnection final : IDbConnection {
+        std::unique_ptr<FakeConnection> connection;
+        explicit LegacyConnection(std::unique_ptr<FakeConnection> connection) : connection(std::move(connection)) {}
+    };
+
+    class LegacyPool {
+        std::queue<std::unique_ptr<FakeConnection>> connectionPool;
+        std::mutex connectionPoolMutex;
+        std::condition_variable connectionPoolCondition;
+    public:
+        explicit LegacyPool(size_t poolSize) {
+            for (size_t i = 0; i < poolSize; i++) {
+                connectionPool.push(std::make_unique<FakeConnection>());
+            }
+        }
+
+        std::unique_ptr<IDbConnection, std::function<void(IDbConnection*)>> Connection() {
+            std::unique_lock lock(connectionPoolMutex);
+            connectionPoolCondition.wait(lock, [this] { return !connectionPool.empty(); });
+
+            auto conn = std::move(connectionPool.front());
+            connectionPool.pop();
+
+            return {new LegacyConnection(std::move(conn)), [this](IDbConnection* dbc) {
+                auto pc = dynamic_cast<LegacyConnection*>(dbc);
+                {
+                    std::lock_guard<std::mutex> guard(connectionPoolMutex);
+                    connectionPool.push(std::move(pc->connection));
+                }
+                delete pc;
+                connectionPoolCondition.notify_one();
+            }};
+        }
+    };
+
+    struct Result {
+        double opsPerSecond;
+        double meanCheckoutNs;
+        double p99CheckoutNs;
+    };
+
+    template<typename Checkout>
+    Result Run(size_t threadCount, size_t iterations, Checkout checkout) {
+        std::vector<std::vector<long long>> latencies(threadCount);
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t t = 0; t < threadCount; t++) {
+            threads.emplace_back([&, t] {
+                auto& samples = latencies[t];
+                samples.reserve(iterations);
+                for (size_t i = 0; i < iterations; i++) {
+                    const auto before = std::chrono::steady_clock::now();
+                    checkout([&] {
+                        samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - before).count());
+                    });
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<long long> all;
+        all.reserve(threadCount * iterations);
+        for (const auto& samples : latencies) {
+            all.insert(all.end(), samples.begin(), samples.end());
+        }
+        std::sort(all.begin(), all.end());
+
+        double total = 0;
+        for (const auto sample : all) {
+            total += static_cast<double>(sample);
+        }
+
+        return {
+            static_cast<double>(all.size()) / elapsed,
+            total / static_cast<double>(all.size()),
+            static_cast<double>(all[all.size() * 99 / 100])
+        };
+    }
+
+    void Print(const std::string& name, size_t threadCount, const Result& result) {
+        std::println("{:<10} threads={:<3} ops/s={:>12.0f} mean checkout={:>10.0f} ns p99 checkout={:>10.0f} ns",
+                     name, threadCount, result.opsPerSecond, result.meanCheckoutNs, result.p99CheckoutNs);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const size_t poolSize = argc > 1 ? std::stoul(argv[1]) : 8;
+    const size_t iterations = argc > 2 ? std::stoul(argv[2]) : 200000;
+
+    std::println("pool size {}, {} checkouts per thread", poolSize, iterations);
+
+    for (const size_t threadCount : {4, 16, 64}) {
+        LegacyPool legacy(poolSize);
+        Print("legacy", threadCount, Run(threadCount, iterations, [&](auto&& onAcquired) {
+            auto pooled = legacy.Connection();
+            onAcquired();
+            dynamic_cast<LegacyConnection*>(&*pooled)->connection->Use();
+        }));
+
+        ConnectionPool<FakeConnection> sharded({.connect = [] { return std::make_unique<FakeConnection>(); }},
+                                               {.minSize = poolSize, .maxSize = poolSize, .acquireTimeout = std::chrono::seconds(30)});
+        Print("sharded", threadCount, Run(threadCount, iterations, [&](auto&& onAcquired) {
+            auto pooled = sharded.Acquire();
+            onAcquired();
+            pooled->Use();
+        }));
+    }
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+//
+// Created by developer on 10/16/26.
+//
+// Measures allocations and latency of serializing a match listing. It compares
+// the previous path, which builds a nlohmann::json DOM and then dumps it, with
+// the JsonWriter path, which writes the body string directly. No database needed.
+// Usage: json_listing_benchmark [matches] [iterations]
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <print>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "domain/Match.hpp"
+#include "domain/Utilities.hpp"
+
+namespace {
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> allocatedBytes{0};
+}
+
+// Every allocation in the process goes through here, so a run's count is the
+// difference between the counters before and after it.
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+namespace {
+    std::vector<std::shared_ptr<domain::Match>> CreateMatches(size_t count) {
+        std::vector<std::shared_ptr<domain::Match>> matches;
+        matches.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            const auto n = std::to_string(i);
+            auto match = std::make_shared<domain::Match>("6f1c0e6a-5b7d-4f3e-9a51-2d8c7b4e1f09",
+                domain::Home{"a1b2c3d4-0000-4000-8000-" + std::string(12 - n.size(), '0') + n, "Home Team " + n},
+                domain::Visitor{"d4c3b2a1-0000-4000-8000-" + std::string(12 - n.size(), '0') + n, "Visitor Team " + n});
+            match->Id() = "9e8d7c6b-0000-4000-8000-" + std::string(12 - n.size(), '0') + n;
+            if (i % 2 == 0) {
+                match->MatchScore() = domain::Score{static_cast<int>(i % 40), static_cast<int>(i % 31)};
+            }
+            matches.push_back(match);
+        }
+        return matches;
+    }
+
+    template<typename Serialize>
+    std::string Run(const std::string& name, size_t iterations, Serialize serialize) {
+        std::vector<double> wallMillis;
+        size_t totalAllocations = 0;
+        size_t totalBytes = 0;
+        std::string body;
+
+        for (size_t i = 0; i < iterations; i++) {
+            const auto allocationsBefore = allocations.load(std::memory_order_relaxed);
+            const auto bytesBefore = allocatedBytes.load(std::memory_order_relaxed);
+            const auto start = std::chrono::steady_clock::now();
+
+            body = serialize();
+
+            wallMillis.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            totalAllocations += allocations.load(std::memory_order_relaxed) - allocationsBefore;
+            totalBytes += allocatedBytes.load(std::memory_order_relaxed) - bytesBefore;
+        }
+        std::sort(wallMillis.begin(), wallMillis.end());
+
+        std::println("{:<10} body={:>8} B allocs/op={:>8} KiB/op={:>8} p50={:>7.2f} ms p99={:>7.2f} ms",
+                     name, body.size(), totalAllocations / iterations, totalBytes / iterations / 1024,
+                     wallMillis[wallMillis.size() / 2], wallMillis[wallMillis.size() * 99 / 100]);
+        return body;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const size_t matchCount = argc > 1 ? std::stoul(argv[1]) : 10000;
+    const size_t iterations = argc > 2 ? std::stoul(argv[2]) : 50;
+    const auto matches = CreateMatches(matchCount);
+
+    const auto dom = Run("dom", iterations, [&] {
+        const nlohmann::json body = matches;
+        return body.dump();
+    });
+    const auto streamed = Run("streaming", iterations, [&] {
+        return domain::ToJsonString(matches);
+    });
+
+    if (dom != streamed) {
+        std::println("bodies differ");
+        return 1;
+    }
+    return 0;
+}
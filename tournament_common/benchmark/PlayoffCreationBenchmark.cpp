@@ -0,0 +1,130 @@
+//
+// Created by developer on 10/15/26.
+//
+// Measures how long it takes to persist a 13-match playoff bracket. It compares
+// the previous flow (13 Create, 13 ReadById and 13 Update calls to link
+// winnerNextMatchId) with one CreateMany that uses client-generated ids.
+// Needs a database created with database/db_script.sql.
+// Usage: playoff_creation_benchmark <connectionString> [iterations]
+//
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <print>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "configuration/DatabaseConfiguration.hpp"
+#include "domain/Match.hpp"
+#include "domain/Uuid.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/repository/MatchRepository.hpp"
+
+namespace {
+    constexpr std::array<std::pair<size_t, size_t>, 12> advances = {{
+        {0, 6}, {1, 7}, {2, 7}, {3, 8}, {4, 9}, {5, 9},
+        {6, 10}, {7, 10}, {8, 11}, {9, 11}, {10, 12}, {11, 12}
+    }};
+
+    std::vector<domain::Match> Bracket(const std::string& tournamentId) {
+        std::vector<domain::Match> matches;
+        auto add = [&](domain::RoundType round, int count) {
+            for (int i = 0; i < count; i++) {
+                const auto n = std::to_string(matches.size());
+                matches.emplace_back(tournamentId, domain::Home{"home-" + n, "Home " + n},
+                                     domain::Visitor{"visitor-" + n, "Visitor " + n}, round);
+            }
+        };
+        add(domain::RoundType::WILDCARD, 6);
+        add(domain::RoundType::DIVISIONAL, 4);
+        add(domain::RoundType::CHAMPIONSHIP, 2);
+        add(domain::RoundType::SUPERBOWL, 1);
+        return matches;
+    }
+
+    bool Sequential(MatchRepository& repository, std::vector<domain::Match> matches) {
+        std::vector<std::shared_ptr<domain::Match>> created;
+        for (const auto& match : matches) {
+            auto id = repository.Create(match);
+            if (!id) {
+                return false;
+            }
+            auto read = repository.ReadById(*id);
+            if (!read) {
+                return false;
+            }
+            created.push_back(*read);
+        }
+        for (const auto& [from, to] : advances) {
+            created[from]->WinnerNextMatchId() = created[to]->Id();
+        }
+        for (const auto& match : created) {
+            if (!repository.Update(match->Id(), *match)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Batched(MatchRepository& repository, std::vector<domain::Match> matches) {
+        for (auto& match : matches) {
+            match.Id() = domain::GenerateUuid();
+        }
+        for (const auto& [from, to] : advances) {
+            matches[from].WinnerNextMatchId() = matches[to].Id();
+        }
+        return repository.CreateMany(matches).has_value();
+    }
+
+    template<typename Create>
+    void Run(const std::string& name, size_t iterations, Create create) {
+        std::vector<double> millis;
+        millis.reserve(iterations);
+        size_t failures = 0;
+        for (size_t i = 0; i < iterations; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            if (!create()) {
+                failures++;
+            }
+            millis.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        std::sort(millis.begin(), millis.end());
+
+        double total = 0;
+        for (const auto value : millis) {
+            total += value;
+        }
+        std::println("{:<10} brackets={:<5} mean={:>8.2f} ms p50={:>8.2f} ms p99={:>8.2f} ms failures={}",
+                     name, iterations, total / static_cast<double>(millis.size()),
+                     millis[millis.size() / 2], millis[millis.size() * 99 / 100], failures);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::println("usage: {} <connectionString> [iterations]", argv[0]);
+        return 1;
+    }
+    const size_t iterations = argc > 2 ? std::stoul(argv[2]) : 200;
+
+    config::DatabaseConfiguration configuration;
+    configuration.connectionString = argv[1];
+    auto provider = std::make_shared<PostgresConnectionProvider>(configuration);
+    MatchRepository repository(provider);
+
+    // All rows go under a throwaway tournament id and are removed at the end.
+    const std::string tournamentId = domain::GenerateUuid();
+    const auto bracket = Bracket(tournamentId);
+
+    Run("sequential", iterations, [&] { return Sequential(repository, bracket); });
+    Run("batched", iterations, [&] { return Batched(repository, bracket); });
+
+    auto pooled = provider->Connection();
+    pqxx::work tx(*pooled);
+    tx.exec("delete from MATCHES where tournament_id = " + tx.quote(tournamentId));
+    tx.commit();
+    return 0;
+}
@@ -0,0 +1,134 @@
+//
+// Created by developer on 10/15/26.
+//
+// Measures client CPU per row when reading matches. It compares the previous
+// path, which fetches the whole JSONB document and runs nlohmann::json::parse on
+// it, with the column projection that maps each row straight into domain::Match.
+// Needs a database created with database/db_script.sql.
+// Usage: projection_benchmark <connectionString> [matches] [iterations]
+//
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <print>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "configuration/DatabaseConfiguration.hpp"
+#include "domain/Match.hpp"
+#include "domain/Uuid.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/repository/MatchRepository.hpp"
+#include "persistence/repository/Projections.hpp"
+
+namespace {
+    // Replica of the decoder used before the projection.
+    std::shared_ptr<domain::Match> ParseDocument(const pqxx::row& row) {
+        nlohmann::json matchJson = nlohmann::json::parse(row["document"].as<std::string>());
+
+        auto match = std::make_shared<domain::Match>();
+        match->Id() = row["id"].as<std::string>();
+        match->TournamentId() = matchJson["tournamentId"];
+        match->getHome() = matchJson["home"];
+        match->getVisitor() = matchJson["visitor"];
+        match->Round() = static_cast<domain::RoundType>(matchJson["round"].get<int>());
+
+        if (matchJson.contains("score")) {
+            domain::Score score;
+            score.homeTeamScore = matchJson["score"]["home"];
+            score.visitorTeamScore = matchJson["score"]["visitor"];
+            match->MatchScore() = score;
+        }
+        if (matchJson.contains("winnerNextMatchId")) {
+            match->WinnerNextMatchId() = matchJson["winnerNextMatchId"];
+        }
+        return match;
+    }
+
+    double CpuNow() {
+        return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+    }
+
+    template<typename Decode>
+    void Run(const std::string& name, PostgresConnectionProvider& provider, const std::string& sql,
+             const std::string& tournamentId, size_t iterations, Decode decode) {
+        double totalCpu = 0;
+        double decodeCpu = 0;
+        std::vector<double> wallMillis;
+        size_t rows = 0;
+
+        for (size_t i = 0; i < iterations; i++) {
+            auto pooled = provider.Connection();
+            pqxx::work tx(*pooled);
+
+            const auto wallStart = std::chrono::steady_clock::now();
+            const auto cpuStart = CpuNow();
+            const pqxx::result result = tx.exec(sql, pqxx::params{tournamentId});
+            const auto decodeStart = CpuNow();
+
+            std::vector<std::shared_ptr<domain::Match>> matches;
+            matches.reserve(result.size());
+            for (const auto& row : result) {
+                matches.push_back(decode(row));
+            }
+
+            const auto cpuEnd = CpuNow();
+            wallMillis.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallStart).count());
+            totalCpu += cpuEnd - cpuStart;
+            decodeCpu += cpuEnd - decodeStart;
+            rows += matches.size();
+            tx.commit();
+        }
+        std::sort(wallMillis.begin(), wallMillis.end());
+
+        const auto perRow = [rows](double seconds) { return seconds * 1e9 / static_cast<double>(rows); };
+        std::println("{:<10} rows/query={:<6} cpu/row={:>8.0f} ns decode/row={:>8.0f} ns p50 query={:>8.2f} ms",
+                     name, rows / iterations, perRow(totalCpu), perRow(decodeCpu), wallMillis[wallMillis.size() / 2]);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::println("usage: {} <connectionString> [matches] [iterations]", argv[0]);
+        return 1;
+    }
+    const size_t matchCount = argc > 2 ? std::stoul(argv[2]) : 2000;
+    const size_t iterations = argc > 3 ? std::stoul(argv[3]) : 50;
+
+    config::DatabaseConfiguration configuration;
+    configuration.connectionString = argv[1];
+    auto provider = std::make_shared<PostgresConnectionProvider>(configuration);
+    MatchRepository repository(provider);
+
+    // All rows go under a throwaway tournament id and are removed at the end.
+    const std::string tournamentId = domain::GenerateUuid();
+    std::vector<domain::Match> matches;
+    matches.reserve(matchCount);
+    for (size_t i = 0; i < matchCount; i++) {
+        const auto n = std::to_string(i);
+        domain::Match match(tournamentId, domain::Home{domain::GenerateUuid(), "Home " + n},
+                            domain::Visitor{domain::GenerateUuid(), "Visitor " + n});
+        if (i % 2 == 0) {
+            match.MatchScore() = domain::Score{static_cast<int>(i % 40), static_cast<int>(i % 31)};
+        }
+        matches.push_back(match);
+    }
+    if (!repository.CreateMany(matches)) {
+        std::println("could not seed {} matches", matchCount);
+        return 1;
+    }
+
+    Run("document", *provider, "select id, document from MATCHES where tournament_id = $1",
+        tournamentId, iterations, ParseDocument);
+    Run("projected", *provider, std::string(projection::MATCH_SELECT) + " where tournament_id = $1",
+        tournamentId, iterations, projection::MatchFromRow<pqxx::row>);
+
+    auto pooled = provider->Connection();
+    pqxx::work tx(*pooled);
+    tx.exec("delete from MATCHES where tournament_id = " + tx.quote(tournamentId));
+    tx.commit();
+    return 0;
+}
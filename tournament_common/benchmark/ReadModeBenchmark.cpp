@@ -0,0 +1,80 @@
+//
+// Created by developer on 10/15/26.
+//
+// Measures one tournament lookup by id under each transaction mode. pqxx::work
+// and pqxx::read_transaction wrap the SELECT in BEGIN and COMMIT; a
+// nontransaction sends only the SELECT. Repository reads now use the last one.
+// Needs a database created with database/db_script.sql.
+// Usage: read_mode_benchmark <connectionString> [iterations]
+//
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "configuration/DatabaseConfiguration.hpp"
+#include "domain/Tournament.hpp"
+#include "domain/Uuid.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/repository/StatementCatalog.hpp"
+#include "persistence/repository/TournamentRepository.hpp"
+
+namespace {
+    template<typename Transaction>
+    void Run(const std::string& name, PostgresConnectionProvider& provider, const std::string& id, size_t iterations) {
+        std::vector<double> micros;
+        micros.reserve(iterations);
+
+        auto pooled = provider.Connection();
+        const auto& statement = statements::SELECT_TOURNAMENT_BY_ID;
+        pooled.PrepareOnce(statement.name, [&statement](pqxx::connection& connection) {
+            connection.prepare(statement.name, statement.sql);
+        });
+        for (size_t i = 0; i < iterations; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            Transaction tx(*pooled);
+            const pqxx::result result = tx.exec(pqxx::prepped{statement.name}, id);
+            tx.commit();
+            micros.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        }
+        std::sort(micros.begin(), micros.end());
+
+        double total = 0;
+        for (const auto value : micros) {
+            total += value;
+        }
+        std::println("{:<16} reads={:<6} mean={:>8.1f} us p50={:>8.1f} us p99={:>8.1f} us",
+                     name, iterations, total / static_cast<double>(micros.size()),
+                     micros[micros.size() / 2], micros[micros.size() * 99 / 100]);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::println("usage: {} <connectionString> [iterations]", argv[0]);
+        return 1;
+    }
+    const size_t iterations = argc > 2 ? std::stoul(argv[2]) : 5000;
+
+    config::DatabaseConfiguration configuration;
+    configuration.connectionString = argv[1];
+    auto provider = std::make_shared<PostgresConnectionProvider>(configuration);
+    TournamentRepository repository(provider);
+
+    // A throwaway tournament, removed at the end.
+    const auto id = repository.Create(domain::Tournament("read-mode-benchmark-" + domain::GenerateUuid(), 2026));
+    if (!id) {
+        std::println("could not create the tournament: {}", id.error());
+        return 1;
+    }
+
+    Run<pqxx::work>("work", *provider, *id, iterations);
+    Run<pqxx::read_transaction>("read_transaction", *provider, *id, iterations);
+    Run<pqxx::nontransaction>("nontransaction", *provider, *id, iterations);
+
+    repository.Delete(*id);
+    return 0;
+}
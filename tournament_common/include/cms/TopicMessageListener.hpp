@@ -0,0 +1,96 @@
+#ifndef COMMON_TOPIC_MESSAGE_LISTENER_HPP
+#define COMMON_TOPIC_MESSAGE_LISTENER_HPP
+
+#include <exception>
+#include <expected>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cms/MessageConsumer.h>
+#include <cms/MessageListener.h>
+#include <cms/Session.h>
+#include <cms/TextMessage.h>
+#include <cms/Topic.h>
+
+#include "cms/ConnectionManager.hpp"
+
+// Non-durable subscriber to one or more topics. Unlike QueueMessageListener it does
+// not block: the session delivers messages on its own thread, so it can run next to
+// the HTTP server. Messages published while the node is down are not replayed.
+class TopicMessageListener : public cms::MessageListener {
+    std::shared_ptr<ConnectionManager> connectionManager;
+    std::mutex mutex;
+    std::shared_ptr<cms::Session> session;
+    std::vector<std::unique_ptr<cms::MessageConsumer>> consumers;
+
+    virtual void processMessage(const std::string& message) = 0;
+    void CloseSubscriptions();
+public:
+    explicit TopicMessageListener(const std::shared_ptr<ConnectionManager>& connectionManager)
+        : connectionManager(connectionManager) {}
+    ~TopicMessageListener() override = default;
+
+    // Subscribes to every topic or to none: on failure the session is closed so a later
+    // call can retry. Calling it again after a successful start does nothing.
+    std::expected<void, std::string> Start(const std::vector<std::string>& topics);
+    void Stop();
+    void onMessage(const cms::Message* message) override;
+};
+
+inline std::expected<void, std::string> TopicMessageListener::Start(const std::vector<std::string>& topics) {
+    std::lock_guard lock(mutex);
+    if (session) {
+        return {};
+    }
+    try {
+        session = connectionManager->CreateSession();
+        for (const auto& topic : topics) {
+            const auto destination = std::unique_ptr<cms::Topic>(session->createTopic(topic));
+            auto consumer = std::unique_ptr<cms::MessageConsumer>(session->createConsumer(destination.get()));
+            consumer->setMessageListener(this);
+            consumers.push_back(std::move(consumer));
+        }
+        return {};
+    } catch (const std::exception& e) {
+        std::cerr << "Topic subscription failed: " << e.what() << std::endl;
+        CloseSubscriptions();
+        return std::unexpected(std::format("Topic subscription failed: {}", e.what()));
+    }
+}
+
+inline void TopicMessageListener::Stop() {
+    std::lock_guard lock(mutex);
+    CloseSubscriptions();
+}
+
+// Caller holds the mutex. Closing is best effort: a half-built subscription may fail
+// to close, and it is dropped anyway.
+inline void TopicMessageListener::CloseSubscriptions() {
+    for (const auto& consumer : consumers) {
+        try {
+            consumer->close();
+        } catch (const std::exception& e) {
+            std::cerr << "Topic consumer close failed: " << e.what() << std::endl;
+        }
+    }
+    consumers.clear();
+    if (session) {
+        try {
+            session->close();
+        } catch (const std::exception& e) {
+            std::cerr << "Topic session close failed: " << e.what() << std::endl;
+        }
+        session.reset();
+    }
+}
+
+inline void TopicMessageListener::onMessage(const cms::Message* message) {
+    if (const auto text = dynamic_cast<const cms::TextMessage*>(message)) {
+        processMessage(text->getText());
+    }
+}
+
+#endif //COMMON_TOPIC_MESSAGE_LISTENER_HPP
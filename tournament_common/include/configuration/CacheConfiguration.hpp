@@ -0,0 +1,25 @@
+#ifndef CACHE_CONFIGURATION_HPP
+#define CACHE_CONFIGURATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <nlohmann/json.hpp>
+
+namespace config {
+    // Settings of one CachedRepository, from an entry of "cacheConfig".
+    struct CacheConfiguration {
+        // Entries across all shards; each shard evicts its least recently used entry when full.
+        size_t capacity = 1024;
+        // Independent locks; reads of different ids rarely contend.
+        size_t shards = 16;
+        // Bounds how stale an entry can be when another process wrote it.
+        long ttlMs = 30000;
+    };
+
+    inline void from_json(const nlohmann::json& json, CacheConfiguration& cacheConfiguration) {
+        cacheConfiguration.capacity = json.value("capacity", cacheConfiguration.capacity);
+        cacheConfiguration.shards = std::max<size_t>(1, json.value("shards", cacheConfiguration.shards));
+        cacheConfiguration.ttlMs = json.value("ttlMs", cacheConfiguration.ttlMs);
+    }
+}
+#endif
@@ -1,15 +1,48 @@
 #ifndef DATA_BASE_CONFIGURATION_HPP
 #define DATA_BASE_CONFIGURATION_HPP
 
+#include <algorithm>
 #include <string>
+#include <nlohmann/json.hpp>
 
 namespace config {
     struct DatabaseConfiguration{
         std::string connectionString;
+        size_t minPoolSize = 1;
+        size_t maxPoolSize = 1;
+        long acquireTimeoutMs = 5000;
+        long growAfterWaitMs = 20;
+        long idleTimeoutMs = 60000;
+        long healthCheckIntervalMs = 5000;
+        long reconnectIntervalMs = 1000;
+        // Replica for read-only statements; empty sends every read to the primary.
+        std::string readConnectionString;
+        size_t minReadPoolSize = 1;
+        size_t maxReadPoolSize = 1;
+        // Async connections for the whole node, split evenly over the io_contexts
+        // (one per Crow worker thread), at least one each. Idle ones above the
+        // minimum close after idleTimeoutMs.
+        size_t minAsyncPoolSize = 0;
+        size_t maxAsyncPoolSize = 16;
     };
 
     inline void from_json(const nlohmann::json& json, DatabaseConfiguration& databaseConfiguration) {
         json.at("connectionString").get_to(databaseConfiguration.connectionString);
+        // A plain poolSize still works and means a fixed-size pool.
+        const size_t poolSize = json.value("poolSize", databaseConfiguration.minPoolSize);
+        databaseConfiguration.minPoolSize = json.value("minPoolSize", poolSize);
+        databaseConfiguration.maxPoolSize = json.value("maxPoolSize", std::max(poolSize, databaseConfiguration.minPoolSize));
+        databaseConfiguration.acquireTimeoutMs = json.value("acquireTimeoutMs", databaseConfiguration.acquireTimeoutMs);
+        databaseConfiguration.growAfterWaitMs = json.value("growAfterWaitMs", databaseConfiguration.growAfterWaitMs);
+        databaseConfiguration.idleTimeoutMs = json.value("idleTimeoutMs", databaseConfiguration.idleTimeoutMs);
+        databaseConfiguration.healthCheckIntervalMs = json.value("healthCheckIntervalMs", databaseConfiguration.healthCheckIntervalMs);
+        databaseConfiguration.reconnectIntervalMs = json.value("reconnectIntervalMs", databaseConfiguration.reconnectIntervalMs);
+        databaseConfiguration.readConnectionString = json.value("readConnectionString", std::string{});
+        databaseConfiguration.minReadPoolSize = json.value("minReadPoolSize", databaseConfiguration.minPoolSize);
+        databaseConfiguration.maxReadPoolSize = json.value("maxReadPoolSize",
+            std::max(databaseConfiguration.maxPoolSize, databaseConfiguration.minReadPoolSize));
+        databaseConfiguration.minAsyncPoolSize = json.value("minAsyncPoolSize", databaseConfiguration.minAsyncPoolSize);
+        databaseConfiguration.maxAsyncPoolSize = json.value("maxAsyncPoolSize", databaseConfiguration.maxAsyncPoolSize);
     }
 }
 #endif
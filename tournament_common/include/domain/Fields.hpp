@@ -0,0 +1,304 @@
+#ifndef DOMAIN_FIELDS_HPP
+#define DOMAIN_FIELDS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "domain/JsonWriter.hpp"
+
+// Serialización de los tipos del dominio a partir de una sola tabla de campos por tipo.
+// Cada tipo declara sus campos en Fields<T>::all (nombre, cómo llegar al valor, si es
+// obligatorio y cómo se codifica) y de esa tabla salen to_json/from_json, WriteJson para
+// el camino sin DOM y ToDocument para el JSONB que se guarda. Agregar un campo es
+// agregar una línea a la tabla.
+namespace domain {
+
+    namespace fields {
+
+        enum class Presence {
+            Required,   // se escribe siempre; leerlo sin el campo es error
+            Optional,   // se escribe siempre; al leer puede faltar
+            OmitEmpty   // se escribe solo si tiene valor (string no vacío, optional con valor)
+        };
+
+        // El valor tal cual: strings, enteros, bool, otro tipo con tabla, vectores y optionals de ellos
+        struct Plain {};
+
+        // El campo no va en el documento guardado; vive en su propia columna (el id de un match)
+        struct NotStored {};
+
+        // Enum como texto. Un texto desconocido se lee como fallback.
+        template<typename Enum, size_t N>
+        struct EnumText {
+            using Stored = std::string;
+
+            Enum fallback;
+            std::array<std::pair<Enum, std::string_view>, N> names;
+
+            [[nodiscard]] constexpr std::string_view Encode(Enum value) const {
+                for (const auto& [candidate, name] : names) {
+                    if (candidate == value) {
+                        return name;
+                    }
+                }
+                return Encode(fallback);
+            }
+
+            [[nodiscard]] constexpr Enum Decode(std::string_view text) const {
+                for (const auto& [candidate, name] : names) {
+                    if (name == text) {
+                        return candidate;
+                    }
+                }
+                return fallback;
+            }
+        };
+
+        template<typename Enum, size_t N>
+        constexpr EnumText<Enum, N> Names(Enum fallback, const std::pair<Enum, std::string_view> (&names)[N]) {
+            EnumText<Enum, N> text{fallback, {}};
+            std::copy(names, names + N, text.names.begin());
+            return text;
+        }
+
+        // Enum como su valor entero
+        template<typename Enum>
+        struct EnumNumber {
+            using Stored = int;
+
+            [[nodiscard]] constexpr int Encode(Enum value) const { return static_cast<int>(value); }
+            [[nodiscard]] constexpr Enum Decode(int value) const { return static_cast<Enum>(value); }
+        };
+
+        // Un campo de la tabla. codec es el formato de la API; storage, el del documento guardado.
+        template<typename Get, typename Codec, typename Storage>
+        struct Descriptor {
+            std::string_view name;
+            Get get;
+            Presence presence;
+            Codec codec;
+            Storage storage;
+        };
+
+        // get recibe el objeto (const o no) y devuelve el valor; sin const, una referencia para leer sobre ella
+        template<typename Get>
+        constexpr auto Field(std::string_view name, Get get, Presence presence = Presence::Required) {
+            return Descriptor<Get, Plain, Plain>{name, get, presence, {}, {}};
+        }
+
+        template<typename Get, typename Codec>
+        constexpr auto Field(std::string_view name, Get get, Presence presence, Codec codec) {
+            return Descriptor<Get, Codec, Codec>{name, get, presence, codec, codec};
+        }
+
+        template<typename Get, typename Codec, typename Storage>
+        constexpr auto Field(std::string_view name, Get get, Presence presence, Codec codec, Storage storage) {
+            return Descriptor<Get, Codec, Storage>{name, get, presence, codec, storage};
+        }
+    }
+
+    // Tabla de campos de cada tipo; se especializa junto al tipo (ver Match.hpp y Utilities.hpp)
+    template<typename T>
+    struct Fields {};
+
+    template<typename T>
+    concept Described = requires { Fields<T>::all; };
+
+    namespace detail {
+        template<typename T>
+        struct IsOptional : std::false_type {};
+        template<typename T>
+        struct IsOptional<std::optional<T>> : std::true_type {};
+
+        template<typename T>
+        struct IsVector : std::false_type {};
+        template<typename T, typename Allocator>
+        struct IsVector<std::vector<T, Allocator>> : std::true_type {};
+
+        template<typename Codec>
+        constexpr bool IS_PLAIN = std::is_same_v<Codec, fields::Plain>;
+
+        template<typename T, typename Visit>
+        constexpr void ForEachField(Visit&& visit) {
+            std::apply([&](const auto&... field) { (visit(field), ...); }, Fields<T>::all);
+        }
+
+        // WriteJson sale igual a dump() solo si las claves van como las ordena nlohmann
+        template<typename T>
+        consteval bool SortedByName() {
+            return std::apply([](const auto&... field) {
+                const std::array<std::string_view, sizeof...(field)> names{field.name...};
+                return std::ranges::is_sorted(names);
+            }, Fields<T>::all);
+        }
+
+        template<typename Value>
+        bool IsEmpty(const Value& value) {
+            if constexpr (IsOptional<Value>::value) {
+                return !value.has_value();
+            } else if constexpr (requires { value.empty(); }) {
+                return value.empty();
+            } else {
+                return false;
+            }
+        }
+
+        // La API usa el codec de cada campo; el documento guardado, su storage
+        enum class Target { Api, Document };
+
+        template<Target target, typename Field>
+        constexpr const auto& CodecOf(const Field& field) {
+            if constexpr (target == Target::Api) {
+                return field.codec;
+            } else {
+                return field.storage;
+            }
+        }
+
+        template<Target target, Described T>
+        nlohmann::json Encode(const T& value);
+
+        template<Target target, typename Codec, typename Value>
+        nlohmann::json EncodeValue(const Codec& codec, const Value& value) {
+            if constexpr (IsOptional<Value>::value) {
+                return EncodeValue<target>(codec, *value);
+            } else if constexpr (!IS_PLAIN<Codec>) {
+                return nlohmann::json(codec.Encode(value));
+            } else if constexpr (Described<Value>) {
+                return Encode<target>(value);
+            } else if constexpr (IsVector<Value>::value) {
+                auto array = nlohmann::json::array();
+                for (const auto& item : value) {
+                    array.push_back(EncodeValue<target>(codec, item));
+                }
+                return array;
+            } else {
+                return nlohmann::json(value);
+            }
+        }
+
+        template<Target target, Described T>
+        nlohmann::json Encode(const T& value) {
+            auto json = nlohmann::json::object();
+            ForEachField<T>([&](const auto& field) {
+                const auto& codec = CodecOf<target>(field);
+                if constexpr (!std::is_same_v<std::decay_t<decltype(codec)>, fields::NotStored>) {
+                    const auto& member = field.get(value);
+                    if (field.presence == fields::Presence::OmitEmpty && IsEmpty(member)) {
+                        return;
+                    }
+                    json[field.name] = EncodeValue<target>(codec, member);
+                }
+            });
+            return json;
+        }
+
+        template<typename Codec, typename Value>
+        void DecodeValue(const Codec& codec, const nlohmann::json& json, Value& value) {
+            if constexpr (IsOptional<Value>::value) {
+                typename Value::value_type decoded{};
+                DecodeValue(codec, json, decoded);
+                value = std::move(decoded);
+            } else if constexpr (!IS_PLAIN<Codec>) {
+                value = codec.Decode(json.get<typename Codec::Stored>());
+            } else {
+                json.get_to(value);
+            }
+        }
+
+        template<typename Codec, typename Value>
+        void WriteValue(JsonWriter& writer, const Codec& codec, const Value& value) {
+            if constexpr (IsOptional<Value>::value) {
+                WriteValue(writer, codec, *value);
+            } else if constexpr (!IS_PLAIN<Codec>) {
+                if constexpr (std::is_same_v<typename Codec::Stored, int>) {
+                    writer.Int(codec.Encode(value));
+                } else {
+                    writer.String(codec.Encode(value));
+                }
+            } else if constexpr (Described<Value>) {
+                WriteJson(writer, value);
+            } else if constexpr (IsVector<Value>::value) {
+                writer.BeginArray();
+                for (const auto& item : value) {
+                    WriteValue(writer, codec, item);
+                }
+                writer.EndArray();
+            } else if constexpr (std::is_same_v<Value, bool>) {
+                writer.Bool(value);
+            } else if constexpr (std::is_integral_v<Value>) {
+                writer.Int(value);
+            } else {
+                writer.String(value);
+            }
+        }
+    }
+
+    // ========== GENERATED SERIALIZATION ==========
+
+    template<Described T>
+    void to_json(nlohmann::json& json, const T& value) {
+        json = detail::Encode<detail::Target::Api>(value);
+    }
+
+    template<Described T>
+    void to_json(nlohmann::json& json, const std::shared_ptr<T>& value) {
+        json = detail::Encode<detail::Target::Api>(*value);
+    }
+
+    // Los obligatorios lanzan si faltan (json::at); un opcional ausente o null deja el valor como estaba
+    template<Described T>
+    void from_json(const nlohmann::json& json, T& value) {
+        detail::ForEachField<T>([&](const auto& field) {
+            if (field.presence == fields::Presence::Required) {
+                detail::DecodeValue(field.codec, json.at(field.name), field.get(value));
+                return;
+            }
+            if (const auto found = json.find(field.name); found != json.end() && !found->is_null()) {
+                detail::DecodeValue(field.codec, *found, field.get(value));
+            }
+        });
+    }
+
+    template<Described T>
+    void from_json(const nlohmann::json& json, std::shared_ptr<T>& value) {
+        if (!value) {
+            value = std::make_shared<T>();
+        }
+        from_json(json, *value);
+    }
+
+    // Mismo texto que dump() de to_json, escrito directo sobre el cuerpo sin armar el DOM
+    template<Described T>
+    void WriteJson(JsonWriter& writer, const T& value) {
+        static_assert(detail::SortedByName<T>(), "Fields<T>::all debe declararse en orden alfabético");
+        writer.BeginObject();
+        detail::ForEachField<T>([&](const auto& field) {
+            const auto& member = field.get(value);
+            if (field.presence == fields::Presence::OmitEmpty && detail::IsEmpty(member)) {
+                return;
+            }
+            writer.Key(field.name);
+            detail::WriteValue(writer, field.codec, member);
+        });
+        writer.EndObject();
+    }
+
+    // Documento JSONB que se guarda en la columna document: los codecs de storage de la tabla
+    template<Described T>
+    nlohmann::json ToDocument(const T& value) {
+        return detail::Encode<detail::Target::Document>(value);
+    }
+}
+
+#endif //DOMAIN_FIELDS_HPP
@@ -22,7 +22,7 @@ namespace domain {
         explicit Group(const std::string_view & name = "", const std::string_view & region = "", const std::string_view&  id = "", Conference conference = Conference::AFC) : id(id), name(name), region(region), conference(conference) {
         }
 
-        [[nodiscard]] std::string Id() const {
+        [[nodiscard]] const std::string& Id() const {
             return  id;
         }
 
@@ -30,7 +30,7 @@ namespace domain {
             return  id;
         }
 
-        [[nodiscard]] std::string Name() const {
+        [[nodiscard]] const std::string& Name() const {
             return  name;
         }
 
@@ -38,7 +38,7 @@ namespace domain {
             return  name;
         }
 
-        [[nodiscard]] std::string Region() const {
+        [[nodiscard]] const std::string& Region() const {
             return  region;
         }
 
@@ -54,7 +54,7 @@ namespace domain {
             return  conference;
         }
 
-        [[nodiscard]] std::string TournamentId() const {
+        [[nodiscard]] const std::string& TournamentId() const {
             return  tournamentId;
         }
 
@@ -62,7 +62,7 @@ namespace domain {
             return  tournamentId;
         }
 
-        [[nodiscard]] std::vector<Team> Teams() const {
+        [[nodiscard]] const std::vector<Team>& Teams() const {
             return this->teams;
         }
 
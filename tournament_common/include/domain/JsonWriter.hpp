@@ -0,0 +1,119 @@
+#ifndef DOMAIN_JSONWRITER_HPP
+#define DOMAIN_JSONWRITER_HPP
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace domain {
+
+    // Escribe JSON compacto directo sobre un std::string, sin armar un nlohmann::json.
+    // Las comas las pone el writer; quien serializa solo abre, cierra y escribe valores.
+    // Las claves van en el orden en que se escriben: para salir igual que
+    // nlohmann::json::dump() hay que escribirlas en orden alfabético, como las guarda él.
+    class JsonWriter {
+        std::string& out;
+        // Un bit por nivel abierto (hasta 64): ese nivel ya tiene un elemento y el siguiente lleva coma
+        uint64_t filled = 0;
+        int depth = 0;
+        bool afterKey = false;
+
+        void Separator() {
+            if (afterKey) {
+                afterKey = false;
+                return;
+            }
+            if (depth > 0) {
+                const uint64_t bit = uint64_t{1} << (depth - 1);
+                if (filled & bit) {
+                    out.push_back(',');
+                }
+                filled |= bit;
+            }
+        }
+
+        void Open(char bracket) {
+            Separator();
+            out.push_back(bracket);
+            filled &= ~(uint64_t{1} << depth);
+            depth++;
+        }
+
+        void Close(char bracket) {
+            depth--;
+            out.push_back(bracket);
+        }
+
+        // Mismos escapes que nlohmann::json::dump(): comillas, barra invertida y los
+        // caracteres de control; el resto (UTF-8 incluido) se copia tal cual, por tramos.
+        void Escaped(std::string_view value) {
+            static constexpr char HEX[] = "0123456789abcdef";
+            size_t start = 0;
+            for (size_t i = 0; i < value.size(); i++) {
+                const auto c = static_cast<unsigned char>(value[i]);
+                if (c >= 0x20 && c != '"' && c != '\\') {
+                    continue;
+                }
+                out.append(value.data() + start, i - start);
+                start = i + 1;
+                switch (c) {
+                    case '"': out.append("\\\""); break;
+                    case '\\': out.append("\\\\"); break;
+                    case '\b': out.append("\\b"); break;
+                    case '\f': out.append("\\f"); break;
+                    case '\n': out.append("\\n"); break;
+                    case '\r': out.append("\\r"); break;
+                    case '\t': out.append("\\t"); break;
+                    default: {
+                        const char unicode[] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0x0F]};
+                        out.append(unicode, sizeof(unicode));
+                    }
+                }
+            }
+            out.append(value.data() + start, value.size() - start);
+        }
+
+    public:
+        explicit JsonWriter(std::string& out) : out(out) {}
+
+        JsonWriter& BeginObject() { Open('{'); return *this; }
+        JsonWriter& EndObject() { Close('}'); return *this; }
+        JsonWriter& BeginArray() { Open('['); return *this; }
+        JsonWriter& EndArray() { Close(']'); return *this; }
+
+        // Las claves son literales del serializador y no llevan nada que escapar
+        JsonWriter& Key(std::string_view key) {
+            Separator();
+            out.push_back('"');
+            out.append(key);
+            out.append("\":");
+            afterKey = true;
+            return *this;
+        }
+
+        JsonWriter& String(std::string_view value) {
+            Separator();
+            out.push_back('"');
+            Escaped(value);
+            out.push_back('"');
+            return *this;
+        }
+
+        JsonWriter& Int(int64_t value) {
+            Separator();
+            char digits[24];
+            const auto end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+            out.append(digits, end - digits);
+            return *this;
+        }
+
+        JsonWriter& Bool(bool value) {
+            Separator();
+            out.append(value ? "true" : "false");
+            return *this;
+        }
+    };
+}
+
+#endif //DOMAIN_JSONWRITER_HPP
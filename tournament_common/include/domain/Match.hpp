@@ -3,7 +3,9 @@
 
 #include <string>
 #include <optional>
-#include <nlohmann/json.hpp>
+#include <tuple>
+
+#include "domain/Fields.hpp"
 
 namespace domain {
     enum class Winner { HOME, VISITOR };
@@ -46,6 +48,9 @@ namespace domain {
         // For tournament bracket tracking
         std::string winnerNextMatchId;
 
+        // Row version for optimistic concurrency; lives in its own column, not in the document
+        int version = 0;
+
     public:
         Match() = default;
 
@@ -56,14 +61,15 @@ namespace domain {
             this->round = roundType;
         }
 
-        // Getters const
-        [[nodiscard]] std::string Id() const { return id; }
-        [[nodiscard]] Home getHome() const { return home; }
-        [[nodiscard]] Visitor getVisitor() const { return visitor; }
+        // Getters const; por referencia para que serializar un listado no copie cada campo
+        [[nodiscard]] const std::string& Id() const { return id; }
+        [[nodiscard]] const Home& getHome() const { return home; }
+        [[nodiscard]] const Visitor& getVisitor() const { return visitor; }
         [[nodiscard]] std::optional<Score> MatchScore() const { return score; }
         [[nodiscard]] RoundType Round() const { return round; }
-        [[nodiscard]] std::string TournamentId() const { return tournamentId; }
-        [[nodiscard]] std::string WinnerNextMatchId() const { return winnerNextMatchId; }
+        [[nodiscard]] const std::string& TournamentId() const { return tournamentId; }
+        [[nodiscard]] const std::string& WinnerNextMatchId() const { return winnerNextMatchId; }
+        [[nodiscard]] int Version() const { return version; }
 
         // Getters no-const
         std::string& Id() { return id; }
@@ -73,150 +79,70 @@ namespace domain {
         RoundType& Round() { return round; }
         std::string& TournamentId() { return tournamentId; }
         std::string& WinnerNextMatchId() { return winnerNextMatchId; }
+        int& Version() { return version; }
 
         [[nodiscard]] bool IsPlayed() const { return score.has_value(); }
     };
 
-    // ========== SERIALIZATION FUNCTIONS (MUST BE IN domain NAMESPACE) ==========
-
-    // Score serialization
-    inline void to_json(nlohmann::json& j, const Score& s) {
-        j = nlohmann::json{{"home", s.homeTeamScore}, {"visitor", s.visitorTeamScore}};
-    }
-
-    inline void from_json(const nlohmann::json& j, Score& s) {
-        j.at("home").get_to(s.homeTeamScore);
-        j.at("visitor").get_to(s.visitorTeamScore);
-    }
-
-    // Home serialization
-    inline void to_json(nlohmann::json& j, const Home& h) {
-        j = nlohmann::json{{"id", h.id}, {"name", h.name}};
-    }
-
-    inline void from_json(const nlohmann::json& j, Home& h) {
-        j.at("id").get_to(h.id);
-        j.at("name").get_to(h.name);
-    }
-
-    // Visitor serialization
-    inline void to_json(nlohmann::json& j, const Visitor& v) {
-        j = nlohmann::json{{"id", v.id}, {"name", v.name}};
-    }
+    // ========== SERIALIZATION (tablas de campos, ver domain/Fields.hpp) ==========
 
-    inline void from_json(const nlohmann::json& j, Visitor& v) {
-        j.at("id").get_to(v.id);
-        j.at("name").get_to(v.name);
-    }
+    // La ronda viaja como texto en la API y se guarda como entero en el documento
+    inline constexpr auto ROUND_NAMES = fields::Names(RoundType::REGULAR, {
+        {RoundType::REGULAR, "regular"},
+        {RoundType::WILDCARD, "wild card"},
+        {RoundType::DIVISIONAL, "divisional"},
+        {RoundType::CHAMPIONSHIP, "championship"},
+        {RoundType::SUPERBOWL, "super bowl"}
+    });
+    inline constexpr fields::EnumNumber<RoundType> ROUND_NUMBERS{};
 
-    // RoundType helper functions
     inline std::string roundTypeToString(RoundType round) {
-        switch (round) {
-            case RoundType::REGULAR: return "regular";
-            case RoundType::WILDCARD: return "wild card";
-            case RoundType::DIVISIONAL: return "divisional";
-            case RoundType::CHAMPIONSHIP: return "championship";
-            case RoundType::SUPERBOWL: return "super bowl";
-        }
-        return "regular";
+        return std::string(ROUND_NAMES.Encode(round));
     }
 
     inline RoundType stringToRoundType(const std::string& str) {
-        if (str == "wild card") return RoundType::WILDCARD;
-        if (str == "divisional") return RoundType::DIVISIONAL;
-        if (str == "championship") return RoundType::CHAMPIONSHIP;
-        if (str == "super bowl") return RoundType::SUPERBOWL;
-        return RoundType::REGULAR;
+        return ROUND_NAMES.Decode(str);
     }
 
-    // Match serialization
-    inline void to_json(nlohmann::json& json, const Match& match) {
-        json = {
-            {"tournamentId", match.TournamentId()},
-            {"home", match.getHome()},
-            {"visitor", match.getVisitor()},
-            {"round", roundTypeToString(match.Round())}
+    template<>
+    struct Fields<Score> {
+        static constexpr auto all = std::tuple{
+            fields::Field("home", [](auto& score) -> auto& { return score.homeTeamScore; }),
+            fields::Field("visitor", [](auto& score) -> auto& { return score.visitorTeamScore; })
         };
+    };
 
-        if (!match.Id().empty()) {
-            json["id"] = match.Id();
-        }
-
-        if (match.IsPlayed()) {
-            json["score"] = match.MatchScore().value();
-        }
-
-        if (!match.WinnerNextMatchId().empty()) {
-            json["winnerNextMatchId"] = match.WinnerNextMatchId();
-        }
-    }
-
-    inline void from_json(const nlohmann::json& json, Match& match) {
-        if (json.contains("id")) {
-            match.Id() = json["id"].get<std::string>();
-        }
-        if (json.contains("tournamentId")) {
-            match.TournamentId() = json["tournamentId"].get<std::string>();
-        }
-
-        if (json.contains("home") && json["home"].is_object()) {
-            Home home;
-            json["home"].get_to(home);
-            match.getHome() = home;
-        }
-
-        if (json.contains("visitor") && json["visitor"].is_object()) {
-            Visitor visitor;
-            json["visitor"].get_to(visitor);
-            match.getVisitor() = visitor;
-        }
-        
-        if (json.contains("round")) {
-            match.Round() = stringToRoundType(json["round"].get<std::string>());
-        }
-
-        if (json.contains("score") && json["score"].is_object()) {
-            Score score;
-            json["score"].get_to(score);
-            match.MatchScore() = score;
-        }
-
-        if (json.contains("winnerNextMatchId")) {
-            match.WinnerNextMatchId() = json["winnerNextMatchId"].get<std::string>();
-        }
-    }
-
-    // Serialization for shared_ptr<Match>
-    inline void to_json(nlohmann::json& json, const std::shared_ptr<Match>& match) {
-        json = {
-            {"tournamentId", match->TournamentId()},
-            {"home", match->getHome()},
-            {"visitor", match->getVisitor()},
-            {"round", roundTypeToString(match->Round())}
+    template<>
+    struct Fields<Home> {
+        static constexpr auto all = std::tuple{
+            fields::Field("id", [](auto& home) -> auto& { return home.id; }),
+            fields::Field("name", [](auto& home) -> auto& { return home.name; })
         };
+    };
 
-        if (!match->Id().empty()) {
-            json["id"] = match->Id();
-        }
-
-        if (match->IsPlayed()) {
-            json["score"] = match->MatchScore().value();
-        }
-
-        if (!match->WinnerNextMatchId().empty()) {
-            json["winnerNextMatchId"] = match->WinnerNextMatchId();
-        }
-    }
+    template<>
+    struct Fields<Visitor> {
+        static constexpr auto all = std::tuple{
+            fields::Field("id", [](auto& visitor) -> auto& { return visitor.id; }),
+            fields::Field("name", [](auto& visitor) -> auto& { return visitor.name; })
+        };
+    };
 
-    // Serialization for vector of matches
-    inline void to_json(nlohmann::json& json, const std::vector<std::shared_ptr<Match>>& matches) {
-        json = nlohmann::json::array();
-        for (const auto& match : matches) {
-            nlohmann::json jsonMatch;
-            to_json(jsonMatch, match);
-            json.push_back(jsonMatch);
-        }
-    }
+    // El id y la versión viven en sus columnas: el id no va en el documento y la versión en ninguno
+    template<>
+    struct Fields<Match> {
+        static constexpr auto all = std::tuple{
+            fields::Field("home", [](auto& match) -> decltype(auto) { return match.getHome(); }, fields::Presence::Optional),
+            fields::Field("id", [](auto& match) -> decltype(auto) { return match.Id(); }, fields::Presence::OmitEmpty,
+                          fields::Plain{}, fields::NotStored{}),
+            fields::Field("round", [](auto& match) -> decltype(auto) { return match.Round(); }, fields::Presence::Optional,
+                          ROUND_NAMES, ROUND_NUMBERS),
+            fields::Field("score", [](auto& match) -> decltype(auto) { return match.MatchScore(); }, fields::Presence::OmitEmpty),
+            fields::Field("tournamentId", [](auto& match) -> decltype(auto) { return match.TournamentId(); }, fields::Presence::Optional),
+            fields::Field("visitor", [](auto& match) -> decltype(auto) { return match.getVisitor(); }, fields::Presence::Optional),
+            fields::Field("winnerNextMatchId", [](auto& match) -> decltype(auto) { return match.WinnerNextMatchId(); }, fields::Presence::OmitEmpty)
+        };
+    };
 
 } // namespace domain
 
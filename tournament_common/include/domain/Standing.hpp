@@ -0,0 +1,95 @@
+#ifndef DOMAIN_STANDING_HPP
+#define DOMAIN_STANDING_HPP
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "domain/Match.hpp"
+
+namespace domain {
+
+    // Fila de la tabla de posiciones de un equipo; solo cuentan los matches de fase regular
+    struct Standing {
+        std::string teamId;
+        std::string teamName;
+        std::string groupId;
+        std::string division;
+        std::string conference;
+        int wins = 0;
+        int losses = 0;
+        int ties = 0;
+        int pointsFor = 0;
+        int pointsAgainst = 0;
+    };
+
+    // Un match de fase regular con marcador, tal como lo cuenta la tabla
+    struct MatchResult {
+        std::string tournamentId;
+        std::string homeId;
+        std::string visitorId;
+        Score score;
+    };
+
+    // Lo que se suma (o resta, con valores negativos) a la fila de un equipo
+    struct StandingChange {
+        std::string teamId;
+        int wins = 0;
+        int losses = 0;
+        int ties = 0;
+        int pointsFor = 0;
+        int pointsAgainst = 0;
+
+        [[nodiscard]] bool IsEmpty() const {
+            return wins == 0 && losses == 0 && ties == 0 && pointsFor == 0 && pointsAgainst == 0;
+        }
+    };
+
+    namespace detail {
+        inline StandingChange& ChangeFor(std::vector<StandingChange>& changes, const std::string& teamId) {
+            for (auto& change : changes) {
+                if (change.teamId == teamId) {
+                    return change;
+                }
+            }
+            return changes.emplace_back(StandingChange{teamId});
+        }
+
+        inline void AddSide(std::vector<StandingChange>& changes, const std::string& teamId,
+                            int pointsFor, int pointsAgainst, int sign) {
+            auto& change = ChangeFor(changes, teamId);
+            change.pointsFor += sign * pointsFor;
+            change.pointsAgainst += sign * pointsAgainst;
+            if (pointsFor > pointsAgainst) {
+                change.wins += sign;
+            } else if (pointsFor < pointsAgainst) {
+                change.losses += sign;
+            } else {
+                change.ties += sign;
+            }
+        }
+
+        inline void AddResult(std::vector<StandingChange>& changes, const MatchResult& result, int sign) {
+            AddSide(changes, result.homeId, result.score.homeTeamScore, result.score.visitorTeamScore, sign);
+            AddSide(changes, result.visitorId, result.score.visitorTeamScore, result.score.homeTeamScore, sign);
+        }
+    }
+
+    // Cambios para pasar de lo que la tabla ya contó de un match (applied) a su resultado
+    // actual (current). Un evento repetido da una lista vacía y un marcador corregido
+    // resta el anterior antes de sumar el nuevo.
+    inline std::vector<StandingChange> StandingChanges(const std::optional<MatchResult>& applied,
+                                                       const std::optional<MatchResult>& current) {
+        std::vector<StandingChange> changes;
+        if (applied) {
+            detail::AddResult(changes, *applied, -1);
+        }
+        if (current) {
+            detail::AddResult(changes, *current, 1);
+        }
+        std::erase_if(changes, [](const StandingChange& change) { return change.IsEmpty(); });
+        return changes;
+    }
+}
+
+#endif //DOMAIN_STANDING_HPP
@@ -1,27 +1,60 @@
 #ifndef DOMAIN_UTILITIES_HPP
 #define DOMAIN_UTILITIES_HPP
 
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
 #include <nlohmann/json.hpp>
+#include "domain/Fields.hpp"
+#include "domain/JsonWriter.hpp"
 #include "domain/Team.hpp"
 #include "domain/Tournament.hpp"
 #include "domain/Group.hpp"
-#include "domain/Match.hpp"  // Incluimos Match.hpp que ahora tiene su propia serialización
+#include "domain/Match.hpp"
+#include "domain/Standing.hpp"
 
 namespace domain {
 
-    // ========== TEAM SERIALIZATION ==========
+    // Las tablas de campos de cada tipo (ver domain/Fields.hpp); de ellas salen to_json,
+    // from_json, WriteJson y ToDocument. Los nombres van en orden alfabético, como los
+    // ordena nlohmann, para que WriteJson escriba lo mismo que dump().
 
-    inline void to_json(nlohmann::json& json, const Team& team) {
-        json = {{"id", team.Id}, {"name", team.Name}};
+    inline constexpr auto CONFERENCE_NAMES = fields::Names(Conference::NFC, {
+        {Conference::AFC, "AFC"},
+        {Conference::NFC, "NFC"}
+    });
+
+    inline constexpr auto TOURNAMENT_TYPE_NAMES = fields::Names(TournamentType::ROUND_ROBIN, {
+        {TournamentType::ROUND_ROBIN, "ROUND_ROBIN"},
+        {TournamentType::NFL, "NFL"}
+    });
+
+    // La conferencia también se lee y escribe suelta, fuera de un grupo
+    inline void to_json(nlohmann::json& json, const Conference& conference) {
+        json = CONFERENCE_NAMES.Encode(conference);
     }
 
-    inline void from_json(const nlohmann::json& json, Team& team) {
-        if(json.contains("id")) {
-            json.at("id").get_to(team.Id);
-        }
-        json.at("name").get_to(team.Name);
+    inline void from_json(const nlohmann::json& json, Conference& conference) {
+        conference = CONFERENCE_NAMES.Decode(json.get<std::string>());
     }
 
+    inline TournamentType fromString(std::string_view type) {
+        return TOURNAMENT_TYPE_NAMES.Decode(type);
+    }
+
+    // ========== TEAM ==========
+
+    template<>
+    struct Fields<Team> {
+        static constexpr auto all = std::tuple{
+            fields::Field("id", [](auto& team) -> auto& { return team.Id; }, fields::Presence::OmitEmpty),
+            fields::Field("name", [](auto& team) -> auto& { return team.Name; })
+        };
+    };
+
+    // Los equipos dentro de un grupo se aceptan a medias: id y name son opcionales
     inline void from_json(const nlohmann::json& json, std::vector<Team>& teams) {
         for (auto j = json.begin(); j != json.end(); ++j) {
             Team team;
@@ -35,164 +68,77 @@ namespace domain {
         }
     }
 
-    inline void to_json(nlohmann::json& json, const std::shared_ptr<Team>& team) {
-        json = nlohmann::basic_json();
-        json["name"] = team->Name;
-
-        if (!team->Id.empty()) {
-            json["id"] = team->Id;
-        }
-    }
-
-    // ========== TOURNAMENT SERIALIZATION ==========
-
-    inline TournamentType fromString(std::string_view type) {
-        if (type == "ROUND_ROBIN")
-            return TournamentType::ROUND_ROBIN;
-        if (type == "NFL")
-            return TournamentType::NFL;
-
-        return TournamentType::ROUND_ROBIN;
-    }
-
-    inline void from_json(const nlohmann::json& json, TournamentFormat& format) {
-        if(json.contains("maxTeamsPerGroup"))
-            json.at("maxTeamsPerGroup").get_to(format.MaxTeamsPerGroup());
-        if(json.contains("maxGroupsPerConference"))
-            json.at("maxGroupsPerConference").get_to(format.MaxGroupsPerConference());
-        if(json.contains("numberOfGroups"))
-            json.at("numberOfGroups").get_to(format.NumberOfGroups());
-        if(json.contains("type"))
-            format.Type() = fromString(json["type"].get<std::string>());
-    }
-
-    inline void to_json(nlohmann::json& json, const TournamentFormat& format) {
-        json = {{"maxTeamsPerGroup", format.MaxTeamsPerGroup()}, {"maxGroupsPerConference", format.MaxGroupsPerConference()}, {"numberOfGroups", format.NumberOfGroups()}};
-        switch (format.Type()) {
-            case TournamentType::ROUND_ROBIN:
-                json["type"] = "ROUND_ROBIN";
-                break;
-            case TournamentType::NFL:
-                json["type"] = "NFL";
-                break;
-            default:
-                json["type"] = "ROUND_ROBIN";
-        }
-    }
+    // ========== TOURNAMENT ==========
 
-    inline void to_json(nlohmann::json& json, const std::shared_ptr<Tournament>& tournament) {
-        json = {
-            {"name", tournament->Name()},
-            {"year", tournament->Year()},
-            {"finished", tournament->Finished()}
+    template<>
+    struct Fields<TournamentFormat> {
+        static constexpr auto all = std::tuple{
+            fields::Field("maxGroupsPerConference", [](auto& format) -> decltype(auto) { return format.MaxGroupsPerConference(); }, fields::Presence::Optional),
+            fields::Field("maxTeamsPerGroup", [](auto& format) -> decltype(auto) { return format.MaxTeamsPerGroup(); }, fields::Presence::Optional),
+            fields::Field("numberOfGroups", [](auto& format) -> decltype(auto) { return format.NumberOfGroups(); }, fields::Presence::Optional),
+            fields::Field("type", [](auto& format) -> decltype(auto) { return format.Type(); }, fields::Presence::Optional, TOURNAMENT_TYPE_NAMES)
         };
-        if (!tournament->Id().empty()) {
-            json["id"] = tournament->Id();
-        }
-        json["format"] = tournament->Format();
-    }
-
-    inline void from_json(const nlohmann::json& json, std::shared_ptr<Tournament>& tournament) {
-        if(json.contains("id")) {
-            tournament->Id() = json["id"].get<std::string>();
-        }
-        json["name"].get_to(tournament->Name());
-        json["year"].get_to(tournament->Year());
-        json["finished"].get_to(tournament->Finished());
-        if (json.contains("format"))
-            json.at("format").get_to(tournament->Format());
-    }
-
-    inline void to_json(nlohmann::json& json, const Tournament& tournament) {
-        json = {
-            {"name", tournament.Name()},
-            {"year", tournament.Year()},
-            {"finished", tournament.Finished()}
+    };
+
+    template<>
+    struct Fields<Tournament> {
+        static constexpr auto all = std::tuple{
+            fields::Field("finished", [](auto& tournament) -> decltype(auto) { return tournament.Finished(); }),
+            fields::Field("format", [](auto& tournament) -> decltype(auto) { return tournament.Format(); }, fields::Presence::Optional),
+            fields::Field("id", [](auto& tournament) -> decltype(auto) { return tournament.Id(); }, fields::Presence::OmitEmpty),
+            fields::Field("name", [](auto& tournament) -> decltype(auto) { return tournament.Name(); }),
+            fields::Field("year", [](auto& tournament) -> decltype(auto) { return tournament.Year(); })
         };
-        if (!tournament.Id().empty()) {
-            json["id"] = tournament.Id();
-        }
-        json["format"] = tournament.Format();
-    }
-
-    inline void from_json(const nlohmann::json& json, Tournament& tournament) {
-        if(json.contains("id")) {
-            tournament.Id() = json["id"].get<std::string>();
-        }
-        json["name"].get_to(tournament.Name());
-        json["year"].get_to(tournament.Year());
-        json["finished"].get_to(tournament.Finished());
-        if (json.contains("format"))
-            json.at("format").get_to(tournament.Format());
-    }
-
-    // ========== GROUP SERIALIZATION ==========
-
-    // Conference enum serialization
-    inline void to_json(nlohmann::json& j, const Conference& c) {
-        j = (c == Conference::AFC) ? "AFC" : "NFC";
-    }
-
-    inline void from_json(const nlohmann::json& j, Conference& c) {
-        std::string str = j.get<std::string>();
-        c = (str == "AFC") ? Conference::AFC : Conference::NFC;
-    }
-
-    inline void from_json(const nlohmann::json& json, Group& group) {
-        if(json.contains("id")) {
-            group.Id() = json["id"].get<std::string>();
-        }
-        if(json.contains("tournamentId")) {
-            group.TournamentId() = json["tournamentId"].get<std::string>();
-        }
-        json["name"].get_to(group.Name());
-        json["region"].get_to(group.Region());
-        json["conference"].get_to(group.getConference());
-
-        if(json.contains("teams")) {
-            json["teams"].get_to(group.Teams());
-        }
-    }
-
-    inline void to_json(nlohmann::json& json, const std::shared_ptr<Group>& group) {
-        json["name"] = group->Name();
-        json["region"] = group->Region();
-        json["conference"] = group->getConference();
-        json["tournamentId"] = group->TournamentId();
-        if (!group->Id().empty()) {
-            json["id"] = group->Id();
-        }
-        json["teams"] = group->Teams();
-    }
-
-    inline void to_json(nlohmann::json& json, const std::vector<std::shared_ptr<Group>>& groups) {
-        json = nlohmann::json::array();
-        for (const auto& group : groups) {
-            auto jsonGroup = nlohmann::json();
-            jsonGroup["name"] = group->Name();
-            jsonGroup["region"] = group->Region();
-            jsonGroup["conference"] = group->getConference();
-            jsonGroup["tournamentId"] = group->TournamentId();
-            if (!group->Id().empty()) {
-                jsonGroup["id"] = group->Id();
-            }
-            jsonGroup["teams"] = group->Teams();
-            json.push_back(jsonGroup);
-        }
-    }
-
-    inline void to_json(nlohmann::json& json, const Group& group) {
-        json["name"] = group.Name();
-        json["region"] = group.Region();
-        json["conference"] = group.getConference();
-        json["tournamentId"] = group.TournamentId();
-        if (!group.Id().empty()) {
-            json["id"] = group.Id();
+    };
+
+    // ========== GROUP ==========
+
+    template<>
+    struct Fields<Group> {
+        static constexpr auto all = std::tuple{
+            fields::Field("conference", [](auto& group) -> decltype(auto) { return group.getConference(); }, fields::Presence::Required, CONFERENCE_NAMES),
+            fields::Field("id", [](auto& group) -> decltype(auto) { return group.Id(); }, fields::Presence::OmitEmpty),
+            fields::Field("name", [](auto& group) -> decltype(auto) { return group.Name(); }),
+            fields::Field("region", [](auto& group) -> decltype(auto) { return group.Region(); }),
+            fields::Field("teams", [](auto& group) -> decltype(auto) { return group.Teams(); }, fields::Presence::Optional),
+            fields::Field("tournamentId", [](auto& group) -> decltype(auto) { return group.TournamentId(); }, fields::Presence::Optional)
+        };
+    };
+
+    // ========== STANDING ==========
+
+    template<>
+    struct Fields<Standing> {
+        static constexpr auto all = std::tuple{
+            fields::Field("conference", [](auto& standing) -> auto& { return standing.conference; }),
+            fields::Field("division", [](auto& standing) -> auto& { return standing.division; }),
+            fields::Field("groupId", [](auto& standing) -> auto& { return standing.groupId; }),
+            fields::Field("losses", [](auto& standing) -> auto& { return standing.losses; }),
+            fields::Field("pointsAgainst", [](auto& standing) -> auto& { return standing.pointsAgainst; }),
+            fields::Field("pointsFor", [](auto& standing) -> auto& { return standing.pointsFor; }),
+            fields::Field("teamId", [](auto& standing) -> auto& { return standing.teamId; }),
+            fields::Field("teamName", [](auto& standing) -> auto& { return standing.teamName; }),
+            fields::Field("ties", [](auto& standing) -> auto& { return standing.ties; }),
+            fields::Field("wins", [](auto& standing) -> auto& { return standing.wins; })
+        };
+    };
+
+    // ========== STREAMING SERIALIZATION ==========
+
+    // El listado como arreglo JSON en un solo string; bytesPerItem solo ajusta la reserva
+    template<typename Type>
+    std::string ToJsonString(const std::vector<std::shared_ptr<Type>>& items, size_t bytesPerItem = 256) {
+        std::string body;
+        body.reserve(2 + items.size() * bytesPerItem);
+        JsonWriter writer(body);
+        writer.BeginArray();
+        for (const auto& item : items) {
+            WriteJson(writer, *item);
         }
-        json["teams"] = group.Teams();
+        writer.EndArray();
+        return body;
     }
 
-
 } // namespace domain
 
 #endif /* DOMAIN_UTILITIES_HPP */
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifndef DOMAIN_UUID_HPP
+#define DOMAIN_UUID_HPP
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace domain {
+
+    // UUID versión 4 generado en el cliente, para conocer los ids antes del INSERT
+    inline std::string GenerateUuid() {
+        thread_local std::mt19937_64 engine{[] {
+            std::random_device device;
+            return (static_cast<uint64_t>(device()) << 32) ^ device();
+        }()};
+
+        std::array<uint8_t, 16> bytes{};
+        for (size_t i = 0; i < bytes.size(); i += 8) {
+            const uint64_t value = engine();
+            for (size_t j = 0; j < 8; j++) {
+                bytes[i + j] = static_cast<uint8_t>(value >> (j * 8));
+            }
+        }
+        bytes[6] = (bytes[6] & 0x0F) | 0x40;
+        bytes[8] = (bytes[8] & 0x3F) | 0x80;
+
+        constexpr char hex[] = "0123456789abcdef";
+        std::string uuid;
+        uuid.reserve(36);
+        for (size_t i = 0; i < bytes.size(); i++) {
+            if (i == 4 || i == 6 || i == 8 || i == 10) {
+                uuid.push_back('-');
+            }
+            uuid.push_back(hex[bytes[i] >> 4]);
+            uuid.push_back(hex[bytes[i] & 0x0F]);
+        }
+        return uuid;
+    }
+}
+
+#endif //DOMAIN_UUID_HPP
@@ -0,0 +1,251 @@
+//
+// Created by developer on 10/15/26.
+//
+
+#ifndef TOURNAMENTS_ASYNCCONNECTIONPROVIDER_HPP
+#define TOURNAMENTS_ASYNCCONNECTIONPROVIDER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <expected>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <asio.hpp>
+
+#include "AsyncPgConnection.hpp"
+#include "configuration/DatabaseConfiguration.hpp"
+
+struct AsyncConnectionPoolOptions {
+    // Idle connections above minSize are closed after idleTimeout.
+    size_t minSize = 0;
+    size_t maxSize = 1;
+    std::chrono::milliseconds acquireTimeout{5000};
+    std::chrono::milliseconds idleTimeout{60000};
+    // Connections idle for this long are pinged before being lent again.
+    std::chrono::milliseconds healthCheckInterval{5000};
+};
+
+// Async connections for one io_context. Connections are opened on demand up to
+// maxSize; when all are busy a coroutine suspends on a timer until one comes
+// back or acquireTimeout passes. Like ConnectionPool, a connection that sat idle
+// past healthCheckInterval is pinged before it is lent, and idle connections
+// above minSize are closed after idleTimeout. Everything runs on the
+// io_context's thread, so there is no locking.
+class AsyncConnectionPool {
+    using Clock = std::chrono::steady_clock;
+
+    struct IdleConnection {
+        std::unique_ptr<AsyncPgConnection> connection;
+        Clock::time_point since;
+    };
+
+    asio::any_io_executor executor;
+    std::string connectionString;
+    AsyncConnectionPoolOptions options;
+
+    // Oldest first: Acquire takes the most recent from the back, reaping starts at the front.
+    std::deque<IdleConnection> idle;
+    size_t open = 0;
+    // Suspended Acquire calls; cancelling a timer wakes its waiter.
+    std::deque<asio::steady_timer*> waiters;
+    // Armed while there are idle connections above minSize.
+    asio::steady_timer reaper;
+    bool reaperArmed = false;
+
+    // A timer that already expired cancels nothing: its waiter is about to report a
+    // timeout and would take the wake-up with it, so the next waiter gets it instead.
+    void WakeOne() {
+        while (!waiters.empty()) {
+            auto* timer = waiters.front();
+            waiters.pop_front();
+            if (timer->cancel() > 0) {
+                return;
+            }
+        }
+    }
+
+    void Release(std::unique_ptr<AsyncPgConnection> connection) {
+        if (connection->IsOpen()) {
+            idle.push_back({std::move(connection), Clock::now()});
+            ScheduleReap();
+        } else {
+            --open;
+        }
+        WakeOne();
+    }
+
+    void ScheduleReap() {
+        if (reaperArmed || open <= options.minSize || idle.empty()) {
+            return;
+        }
+        reaperArmed = true;
+        reaper.expires_at(idle.front().since + options.idleTimeout);
+        reaper.async_wait([this](const asio::error_code& error) {
+            // Only the pool's destructor cancels the reaper; this is gone by then.
+            if (error) {
+                return;
+            }
+            reaperArmed = false;
+            Reap();
+        });
+    }
+
+    void Reap() {
+        const auto expiredBefore = Clock::now() - options.idleTimeout;
+        while (open > options.minSize && !idle.empty() && idle.front().since <= expiredBefore) {
+            idle.pop_front();
+            --open;
+        }
+        ScheduleReap();
+    }
+
+public:
+    // Returns its connection to the pool when destroyed.
+    class Lease {
+        AsyncConnectionPool* pool = nullptr;
+        std::unique_ptr<AsyncPgConnection> connection;
+
+    public:
+        Lease(AsyncConnectionPool* pool, std::unique_ptr<AsyncPgConnection> connection)
+            : pool(pool), connection(std::move(connection)) {}
+
+        Lease(Lease&& other) noexcept
+            : pool(std::exchange(other.pool, nullptr)), connection(std::move(other.connection)) {}
+
+        Lease& operator=(Lease&& other) noexcept {
+            if (this != &other) {
+                if (pool && connection) {
+                    pool->Release(std::move(connection));
+                }
+                pool = std::exchange(other.pool, nullptr);
+                connection = std::move(other.connection);
+            }
+            return *this;
+        }
+
+        ~Lease() {
+            if (pool && connection) {
+                pool->Release(std::move(connection));
+            }
+        }
+
+        AsyncPgConnection& operator*() const { return *connection; }
+        AsyncPgConnection* operator->() const { return connection.get(); }
+    };
+
+    AsyncConnectionPool(asio::any_io_executor executor, std::string connectionString,
+                        AsyncConnectionPoolOptions options)
+        : executor(executor),
+          connectionString(std::move(connectionString)),
+          options(options),
+          reaper(executor) {
+        this->options.maxSize = std::max<size_t>(options.maxSize, 1);
+    }
+
+    AsyncConnectionPool(const AsyncConnectionPool&) = delete;
+    AsyncConnectionPool& operator=(const AsyncConnectionPool&) = delete;
+
+    asio::awaitable<std::expected<Lease, std::string>> Acquire() {
+        const auto deadline = Clock::now() + options.acquireTimeout;
+        while (true) {
+            if (!idle.empty()) {
+                auto [connection, since] = std::move(idle.back());
+                idle.pop_back();
+                // The server or a proxy may have dropped a connection left idle for a while
+                if (Clock::now() - since < options.healthCheckInterval || co_await connection->Ping()) {
+                    co_return Lease(this, std::move(connection));
+                }
+                --open;
+                continue;
+            }
+
+            if (open < options.maxSize) {
+                ++open;
+                auto connection = std::make_unique<AsyncPgConnection>(executor);
+                std::expected<void, std::string> connected;
+                try {
+                    connected = co_await connection->Connect(connectionString);
+                } catch (const std::exception& e) {
+                    connected = std::unexpected(std::format("Database error: {}", e.what()));
+                }
+                if (!connected) {
+                    // The slot is free again; let a waiter try its own connection.
+                    --open;
+                    WakeOne();
+                    co_return std::unexpected(connected.error());
+                }
+                co_return Lease(this, std::move(connection));
+            }
+
+            asio::steady_timer timer(executor, deadline);
+            waiters.push_back(&timer);
+            asio::error_code error;
+            co_await timer.async_wait(asio::redirect_error(asio::use_awaitable, error));
+            std::erase(waiters, &timer);
+            if (error != asio::error::operation_aborted) {
+                co_return std::unexpected(std::format(
+                    "Database error: no connection available after {}ms", options.acquireTimeout.count()));
+            }
+        }
+    }
+};
+
+// Hands out async connections from a pool owned by the calling coroutine's
+// io_context. Crow runs one io_context per worker thread and a response has to
+// be completed from the io_context of its connection, so every pool only ever
+// serves coroutines on its own thread. minAsyncPoolSize and maxAsyncPoolSize are
+// budgets for the whole node; each io_context's pool gets an equal share of them.
+class AsyncConnectionProvider {
+    std::string connectionString;
+    // Sizes of each per-context pool.
+    AsyncConnectionPoolOptions options;
+
+    std::mutex mutex;
+    std::unordered_map<asio::execution_context*, std::unique_ptr<AsyncConnectionPool>> pools;
+
+public:
+    AsyncConnectionProvider(const config::DatabaseConfiguration& configuration, size_t contexts)
+        : connectionString(configuration.connectionString),
+          options{
+              .minSize = configuration.minAsyncPoolSize / std::max<size_t>(1, contexts),
+              .maxSize = std::max<size_t>(1, configuration.maxAsyncPoolSize / std::max<size_t>(1, contexts)),
+              .acquireTimeout = std::chrono::milliseconds(configuration.acquireTimeoutMs),
+              .idleTimeout = std::chrono::milliseconds(configuration.idleTimeoutMs),
+              .healthCheckInterval = std::chrono::milliseconds(configuration.healthCheckIntervalMs)
+          } {}
+
+    AsyncConnectionPool& PoolFor(const asio::any_io_executor& executor) {
+        auto* context = &asio::query(executor, asio::execution::context);
+        std::lock_guard lock(mutex);
+        auto& pool = pools[context];
+        if (!pool) {
+            pool = std::make_unique<AsyncConnectionPool>(executor, connectionString, options);
+        }
+        return *pool;
+    }
+
+    asio::awaitable<std::expected<AsyncConnectionPool::Lease, std::string>> Connection() {
+        const auto executor = co_await asio::this_coro::executor;
+        const auto started = std::chrono::steady_clock::now();
+        auto lease = co_await PoolFor(executor).Acquire();
+        if (lease) {
+            (*lease)->NotePoolWait(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started));
+        }
+        co_return lease;
+    }
+
+    // Closes every connection. Call it once the io_contexts have stopped and
+    // before they are destroyed.
+    void Shutdown() {
+        std::lock_guard lock(mutex);
+        pools.clear();
+    }
+};
+
+#endif //TOURNAMENTS_ASYNCCONNECTIONPROVIDER_HPP
@@ -0,0 +1,295 @@
+//
+// Created by developer on 10/15/26.
+//
+
+#ifndef TOURNAMENTS_ASYNCPGCONNECTION_HPP
+#define TOURNAMENTS_ASYNCPGCONNECTION_HPP
+
+#include <chrono>
+#include <cstdlib>
+#include <expected>
+#include <format>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+#include <asio.hpp>
+#include <libpq-fe.h>
+
+#include "StatementMetrics.hpp"
+
+// Result of one statement. Rows and fields expose the subset of the pqxx::result
+// interface the projections use, so the same decoders read both.
+class PgResult {
+    std::shared_ptr<PGresult> result;
+
+public:
+    class Field {
+        const PGresult* result;
+        int row;
+        int column;
+
+    public:
+        Field(const PGresult* result, int row, int column) : result(result), row(row), column(column) {}
+
+        [[nodiscard]] bool is_null() const {
+            return PQgetisnull(result, row, column) == 1;
+        }
+
+        template<typename T>
+        T as() const {
+            if (is_null()) {
+                throw std::domain_error(std::format("Null value in column {}", PQfname(result, column)));
+            }
+            const char* value = PQgetvalue(result, row, column);
+            if constexpr (std::is_same_v<T, std::string>) {
+                return std::string(value, PQgetlength(result, row, column));
+            } else if constexpr (std::is_same_v<T, bool>) {
+                return value[0] == 't';
+            } else {
+                static_assert(std::is_integral_v<T>, "Unsupported field type");
+                return static_cast<T>(std::strtoll(value, nullptr, 10));
+            }
+        }
+    };
+
+    class Row {
+        const PGresult* result;
+        int row;
+
+    public:
+        Row(const PGresult* result, int row) : result(result), row(row) {}
+
+        Field operator[](int column) const {
+            return {result, row, column};
+        }
+    };
+
+    PgResult() = default;
+    explicit PgResult(PGresult* result) : result(result, PQclear) {}
+
+    [[nodiscard]] size_t size() const {
+        return result ? static_cast<size_t>(PQntuples(result.get())) : 0;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return size() == 0;
+    }
+
+    Row operator[](size_t row) const {
+        return {result.get(), static_cast<int>(row)};
+    }
+
+    [[nodiscard]] Row at(size_t row) const {
+        if (row >= size()) {
+            throw std::out_of_range("Row out of range");
+        }
+        return (*this)[row];
+    }
+
+    [[nodiscard]] size_t affected_rows() const {
+        return result ? std::strtoull(PQcmdTuples(result.get()), nullptr, 10) : 0;
+    }
+};
+
+// One libpq connection in non-blocking mode, driven by an asio executor. Every
+// network wait is an async_wait on the libpq socket, so a coroutine awaiting
+// Execute gives its thread back to the io_context until Postgres answers.
+// Not thread safe: use it only from coroutines on its own executor.
+class AsyncPgConnection {
+    std::unique_ptr<PGconn, decltype(&PQfinish)> connection;
+    // Watches the socket libpq owns; released before PQfinish closes it.
+    asio::posix::stream_descriptor socket;
+    // Statements are prepared on this connection the first time they run.
+    std::unordered_set<std::string> prepared;
+    // Checkout wait not yet charged to a statement.
+    std::chrono::microseconds poolWait{0};
+
+    void WatchSocket() {
+        const int fd = PQsocket(connection.get());
+        if (socket.is_open() && socket.native_handle() == fd) {
+            return;
+        }
+        if (socket.is_open()) {
+            socket.release();
+        }
+        socket.assign(fd);
+    }
+
+    // libpq messages end with a newline.
+    static std::string Message(const char* text) {
+        std::string message = text;
+        while (!message.empty() && message.back() == '\n') {
+            message.pop_back();
+        }
+        return message;
+    }
+
+    std::string LastError() const {
+        return Message(PQerrorMessage(connection.get()));
+    }
+
+    asio::awaitable<void> Flush() {
+        while (true) {
+            const int pending = PQflush(connection.get());
+            if (pending == 0) {
+                co_return;
+            }
+            if (pending < 0) {
+                throw std::runtime_error(LastError());
+            }
+            co_await socket.async_wait(asio::posix::stream_descriptor::wait_write, asio::use_awaitable);
+        }
+    }
+
+    // Reads until the statement's last result arrives. Only the final result is kept;
+    // an error result wins over any that came before it.
+    asio::awaitable<std::expected<PgResult, std::string>> Collect() {
+        std::optional<PgResult> last;
+        std::optional<std::string> error;
+        while (true) {
+            while (PQisBusy(connection.get())) {
+                co_await socket.async_wait(asio::posix::stream_descriptor::wait_read, asio::use_awaitable);
+                if (!PQconsumeInput(connection.get())) {
+                    throw std::runtime_error(LastError());
+                }
+            }
+            PGresult* next = PQgetResult(connection.get());
+            if (next == nullptr) {
+                break;
+            }
+            PgResult result(next);
+            const auto status = PQresultStatus(next);
+            if (status != PGRES_TUPLES_OK && status != PGRES_COMMAND_OK && !error) {
+                error = Message(PQresultErrorMessage(next));
+            }
+            last = std::move(result);
+        }
+
+        if (error) {
+            co_return std::unexpected(std::format("SQL error: {}", *error));
+        }
+        if (!last) {
+            co_return std::unexpected("Database error: no result");
+        }
+        co_return std::move(*last);
+    }
+
+    asio::awaitable<std::expected<PgResult, std::string>> Run(const std::string& name, const std::string& sql,
+                                                              const std::vector<std::optional<std::string>>& params) {
+        if (!prepared.contains(name)) {
+            if (!PQsendPrepare(connection.get(), name.c_str(), sql.c_str(), 0, nullptr)) {
+                throw std::runtime_error(LastError());
+            }
+            co_await Flush();
+            auto preparation = co_await Collect();
+            if (!preparation) {
+                co_return std::unexpected(preparation.error());
+            }
+            prepared.insert(name);
+        }
+
+        std::vector<const char*> values;
+        values.reserve(params.size());
+        for (const auto& param : params) {
+            values.push_back(param ? param->c_str() : nullptr);
+        }
+        if (!PQsendQueryPrepared(connection.get(), name.c_str(), static_cast<int>(values.size()), values.data(),
+                                 nullptr, nullptr, 0)) {
+            throw std::runtime_error(LastError());
+        }
+        co_await Flush();
+        co_return co_await Collect();
+    }
+
+public:
+    explicit AsyncPgConnection(const asio::any_io_executor& executor)
+        : connection(nullptr, PQfinish), socket(executor) {}
+
+    ~AsyncPgConnection() {
+        if (socket.is_open()) {
+            socket.release();
+        }
+    }
+
+    AsyncPgConnection(const AsyncPgConnection&) = delete;
+    AsyncPgConnection& operator=(const AsyncPgConnection&) = delete;
+
+    [[nodiscard]] bool IsOpen() const {
+        return connection && PQstatus(connection.get()) == CONNECTION_OK;
+    }
+
+    asio::awaitable<std::expected<void, std::string>> Connect(const std::string& connectionString) {
+        connection.reset(PQconnectStart(connectionString.c_str()));
+        if (!connection || PQstatus(connection.get()) == CONNECTION_BAD) {
+            co_return std::unexpected(std::format("Database error: {}", connection ? LastError() : "out of memory"));
+        }
+        PQsetnonblocking(connection.get(), 1);
+
+        // libpq may switch sockets while it tries each host, so the watch is renewed every step.
+        auto polling = PGRES_POLLING_WRITING;
+        while (polling != PGRES_POLLING_OK) {
+            if (polling == PGRES_POLLING_FAILED) {
+                co_return std::unexpected(std::format("Database error: {}", LastError()));
+            }
+            WatchSocket();
+            co_await socket.async_wait(polling == PGRES_POLLING_READING
+                                           ? asio::posix::stream_descriptor::wait_read
+                                           : asio::posix::stream_descriptor::wait_write,
+                                       asio::use_awaitable);
+            polling = PQconnectPoll(connection.get());
+        }
+        WatchSocket();
+        co_return std::expected<void, std::string>{};
+    }
+
+    // Server round trip for a connection that has been idle a while. Not recorded
+    // in StatementMetrics.
+    asio::awaitable<bool> Ping() {
+        try {
+            if (!IsOpen() || !PQsendQuery(connection.get(), "SELECT 1")) {
+                co_return false;
+            }
+            co_await Flush();
+            co_return (co_await Collect()).has_value();
+        } catch (const std::exception&) {
+            co_return false;
+        }
+    }
+
+    // Runs a prepared statement; it is prepared on this connection on first use.
+    // Parameters go as text, nullopt meaning NULL. Network failures throw; statement
+    // failures come back as "SQL error: ...". Every run is recorded in StatementMetrics.
+    asio::awaitable<std::expected<PgResult, std::string>> Execute(const std::string& name, const std::string& sql,
+                                                                  const std::vector<std::optional<std::string>>& params) {
+        const auto started = std::chrono::steady_clock::now();
+        const auto record = [&](const std::expected<PgResult, std::string>* result) {
+            StatementMetrics::Global()->Record(
+                name,
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started),
+                result && *result ? static_cast<uint64_t>((*result)->affected_rows()) : 0,
+                !result || !*result,
+                std::exchange(poolWait, std::chrono::microseconds{0}));
+        };
+
+        std::expected<PgResult, std::string> result = std::unexpected(std::string{});
+        try {
+            result = co_await Run(name, sql, params);
+        } catch (...) {
+            record(nullptr);
+            throw;
+        }
+        record(&result);
+        co_return result;
+    }
+
+    // Checkout wait of the lease holding this connection, charged to its next statement.
+    void NotePoolWait(std::chrono::microseconds wait) {
+        poolWait += wait;
+    }
+};
+
+#endif //TOURNAMENTS_ASYNCPGCONNECTION_HPP
@@ -0,0 +1,100 @@
+#ifndef TOURNAMENTS_CACHEMETRICS_HPP
+#define TOURNAMENTS_CACHEMETRICS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+// Hit, miss, eviction and invalidation counters for every in-process cache, keyed
+// by cache name. A cache looks up its counters once and then only touches atomics.
+class CacheMetrics {
+public:
+    struct Counters {
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> evictions{0};
+        std::atomic<uint64_t> invalidations{0};
+    };
+
+    struct Totals {
+        std::string cache;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        uint64_t invalidations = 0;
+    };
+
+    // Process-wide instance the caches record into.
+    static const std::shared_ptr<CacheMetrics>& Global() {
+        static const auto instance = std::make_shared<CacheMetrics>();
+        return instance;
+    }
+
+    // Entries are never erased, so the reference stays valid for the life of the metrics.
+    Counters& For(std::string_view cache) {
+        {
+            std::shared_lock lock(mutex);
+            if (const auto found = counters.find(cache); found != counters.end()) {
+                return *found->second;
+            }
+        }
+        std::unique_lock lock(mutex);
+        auto& entry = counters[std::string(cache)];
+        if (!entry) {
+            entry = std::make_unique<Counters>();
+        }
+        return *entry;
+    }
+
+    // Current totals, by cache name.
+    [[nodiscard]] std::vector<Totals> Snapshot() const {
+        std::shared_lock lock(mutex);
+        std::vector<Totals> snapshot;
+        snapshot.reserve(counters.size());
+        for (const auto& [cache, entry] : counters) {
+            snapshot.push_back(Totals{
+                cache,
+                entry->hits.load(std::memory_order_relaxed),
+                entry->misses.load(std::memory_order_relaxed),
+                entry->evictions.load(std::memory_order_relaxed),
+                entry->invalidations.load(std::memory_order_relaxed)
+            });
+        }
+        return snapshot;
+    }
+
+    void Reset() {
+        std::shared_lock lock(mutex);
+        for (const auto& [cache, entry] : counters) {
+            entry->hits.store(0, std::memory_order_relaxed);
+            entry->misses.store(0, std::memory_order_relaxed);
+            entry->evictions.store(0, std::memory_order_relaxed);
+            entry->invalidations.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    mutable std::shared_mutex mutex;
+    std::map<std::string, std::unique_ptr<Counters>, std::less<>> counters;
+};
+
+inline void to_json(nlohmann::json& json, const CacheMetrics::Totals& totals) {
+    const uint64_t lookups = totals.hits + totals.misses;
+    json = {
+        {"cache", totals.cache},
+        {"hits", totals.hits},
+        {"misses", totals.misses},
+        {"hitRatio", lookups == 0 ? 0.0 : static_cast<double>(totals.hits) / static_cast<double>(lookups)},
+        {"evictions", totals.evictions},
+        {"invalidations", totals.invalidations}
+    };
+}
+
+#endif //TOURNAMENTS_CACHEMETRICS_HPP
@@ -0,0 +1,527 @@
+//
+// Created by developer on 10/15/26.
+//
+
+#ifndef TOURNAMENTS_CONNECTIONPOOL_HPP
+#define TOURNAMENTS_CONNECTIONPOOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <condition_variable>
+#include <exception>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+class ConnectionTimeoutError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+struct ConnectionPoolOptions {
+    // Connections kept open even when idle; the pool never grows past maxSize.
+    size_t minSize = 1;
+    size_t maxSize = 1;
+    std::chrono::milliseconds acquireTimeout{5000};
+    // A checkout that waits this long asks for one more connection, up to maxSize.
+    std::chrono::milliseconds growAfterWait{20};
+    // Connections above minSize that stay unused this long are closed.
+    std::chrono::milliseconds idleTimeout{60000};
+    // Idle connections unused for this long are pinged before being handed out again.
+    std::chrono::milliseconds healthCheckInterval{5000};
+    // Delay between attempts to reopen a broken connection.
+    std::chrono::milliseconds reconnectInterval{1000};
+    size_t shardCount = 0;
+};
+
+struct ConnectionPoolStats {
+    size_t size = 0;
+    size_t inUse = 0;
+    size_t minSize = 0;
+    size_t maxSize = 0;
+    uint64_t acquisitions = 0;
+    // Checkouts that found no free connection and had to wait, and for how long.
+    uint64_t waits = 0;
+    std::chrono::microseconds totalWait{0};
+    std::chrono::microseconds maxWait{0};
+    uint64_t timeouts = 0;
+    uint64_t grown = 0;
+    uint64_t reaped = 0;
+};
+
+// How the pool opens and checks a connection. Only connect is mandatory.
+template<typename Connection>
+struct ConnectionPoolCallbacks {
+    // Opens a new connection; throws if the server cannot be reached.
+    std::function<std::unique_ptr<Connection>()> connect;
+    // Cheap local check done on every checkout and return.
+    std::function<bool(const Connection&)> isOpen;
+    // Server round trip used for connections that have been idle for a while.
+    std::function<bool(Connection&)> ping;
+};
+
+// Pool of reusable connections. Free connections are spread over several
+// shards, each with its own small lock, so concurrent checkouts from different
+// threads rarely touch the same mutex. A counting semaphore tracks how many
+// connections are free in total and bounds how long a checkout may wait.
+//
+// The pool starts with minSize open connections. Checkouts that wait longer
+// than growAfterWait make the background thread open another one, up to
+// maxSize, and connections above minSize that stay idle past idleTimeout are
+// closed again.
+//
+// Connections found closed on checkout or return, or failing a ping while idle,
+// are taken out of circulation and reopened by a background thread; the
+// semaphore only counts healthy connections, so callers never receive one
+// that is known to be broken.
+template<typename Connection>
+class ConnectionPool {
+public:
+    using Callbacks = ConnectionPoolCallbacks<Connection>;
+    using Clock = std::chrono::steady_clock;
+
+    struct Slot {
+        std::unique_ptr<Connection> connection;
+        size_t shard = 0;
+        // lastUsed drives idle reaping, lastChecked the health check pings.
+        Clock::time_point lastUsed = Clock::now();
+        Clock::time_point lastChecked = Clock::now();
+        // Names passed to Handle::PrepareOnce on this physical connection.
+        std::unordered_set<std::string> preparedNames;
+    };
+
+    // RAII checkout. Gives direct access to the pooled connection and puts it
+    // back into its shard when destroyed. Does not allocate.
+    class Handle {
+        ConnectionPool* pool = nullptr;
+        Slot* slot = nullptr;
+    public:
+        Handle() = default;
+        Handle(ConnectionPool* pool, Slot* slot) : pool(pool), slot(slot) {}
+        ~Handle() { reset(); }
+
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+
+        Handle(Handle&& other) noexcept : pool(other.pool), slot(other.slot) {
+            other.slot = nullptr;
+        }
+
+        Handle& operator=(Handle&& other) noexcept {
+            if (this != &other) {
+                reset();
+                pool = other.pool;
+                slot = other.slot;
+                other.slot = nullptr;
+            }
+            return *this;
+        }
+
+        Connection& operator*() const { return *slot->connection; }
+        Connection* operator->() const { return slot->connection.get(); }
+        explicit operator bool() const { return slot != nullptr; }
+
+        // Runs prepare the first time name is seen on this physical connection.
+        // The record is dropped when the connection is reopened.
+        template<typename Prepare>
+        void PrepareOnce(const std::string& name, Prepare&& prepare) {
+            if (!slot->preparedNames.contains(name)) {
+                prepare(*slot->connection);
+                slot->preparedNames.insert(name);
+            }
+        }
+
+        void reset() {
+            if (slot != nullptr) {
+                pool->Return(slot);
+                slot = nullptr;
+            }
+        }
+    };
+
+private:
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::vector<Slot*> free;
+    };
+
+    Callbacks callbacks;
+    ConnectionPoolOptions options;
+    std::vector<std::unique_ptr<Slot>> slots;
+    std::vector<Shard> shards;
+    std::counting_semaphore<> available{0};
+
+    struct alignas(64) Counters {
+        std::atomic<size_t> size{0};
+        std::atomic<size_t> inUse{0};
+        std::atomic<uint64_t> acquisitions{0};
+        std::atomic<uint64_t> waits{0};
+        std::atomic<int64_t> totalWaitMicros{0};
+        std::atomic<int64_t> maxWaitMicros{0};
+        std::atomic<uint64_t> timeouts{0};
+        std::atomic<uint64_t> grown{0};
+        std::atomic<uint64_t> reaped{0};
+    };
+    Counters counters;
+
+    std::mutex maintenanceMutex;
+    std::condition_variable_any maintenanceCondition;
+    std::vector<Slot*> broken;
+    // Slots without a connection, available for growing the pool.
+    std::vector<Slot*> spare;
+    bool brokenPending = false;
+    size_t growRequests = 0;
+    // Declared last so the maintenance thread is stopped before the slots go away.
+    std::jthread maintenance;
+
+    static size_t ShardCount(size_t size, size_t requested) {
+        const size_t shardCount = requested == 0 ? std::max(1u, std::thread::hardware_concurrency()) : requested;
+        return std::max<size_t>(1, std::min(size, shardCount));
+    }
+
+    size_t HomeShard() const {
+        thread_local const size_t threadHash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        return threadHash % shards.size();
+    }
+
+    bool IsOpen(const Slot* slot) const {
+        return slot->connection != nullptr && (!callbacks.isOpen || callbacks.isOpen(*slot->connection));
+    }
+
+    bool Ping(Slot* slot) const {
+        return !callbacks.ping || callbacks.ping(*slot->connection);
+    }
+
+    void Release(Slot* slot) {
+        {
+            std::lock_guard lock(shards[slot->shard].mutex);
+            shards[slot->shard].free.push_back(slot);
+        }
+        available.release();
+    }
+
+    void Return(Slot* slot) {
+        counters.inUse.fetch_sub(1, std::memory_order_relaxed);
+        if (!IsOpen(slot)) {
+            MarkBroken(slot);
+            return;
+        }
+        slot->lastUsed = Clock::now();
+        Release(slot);
+    }
+
+    void MarkBroken(Slot* slot) {
+        {
+            std::lock_guard lock(maintenanceMutex);
+            broken.push_back(slot);
+            brokenPending = true;
+        }
+        maintenanceCondition.notify_one();
+    }
+
+    Slot* PopFree() {
+        // Holding a permit guarantees that at least one shard has a free slot.
+        const size_t home = HomeShard();
+        for (size_t i = 0;; i++) {
+            Shard& shard = shards[(home + i) % shards.size()];
+            std::lock_guard lock(shard.mutex);
+            if (!shard.free.empty()) {
+                Slot* slot = shard.free.back();
+                shard.free.pop_back();
+                return slot;
+            }
+        }
+    }
+
+    bool Reconnect(Slot* slot) {
+        try {
+            slot->connection.reset();
+            slot->preparedNames.clear();
+            slot->connection = callbacks.connect();
+            slot->lastUsed = slot->lastChecked = Clock::now();
+            return true;
+        } catch (const std::exception& e) {
+            std::cerr << "Connection pool: reconnect failed: " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    void ReconnectBroken() {
+        std::vector<Slot*> pending;
+        {
+            std::lock_guard lock(maintenanceMutex);
+            pending.swap(broken);
+            brokenPending = false;
+        }
+
+        std::vector<Slot*> failed;
+        for (Slot* slot : pending) {
+            if (Reconnect(slot)) {
+                Release(slot);
+            } else {
+                failed.push_back(slot);
+            }
+        }
+
+        if (!failed.empty()) {
+            std::lock_guard lock(maintenanceMutex);
+            broken.insert(broken.end(), failed.begin(), failed.end());
+        }
+    }
+
+    void RequestGrowth() {
+        {
+            std::lock_guard lock(maintenanceMutex);
+            growRequests++;
+        }
+        maintenanceCondition.notify_one();
+    }
+
+    void Grow() {
+        std::vector<Slot*> opening;
+        {
+            std::lock_guard lock(maintenanceMutex);
+            while (growRequests > 0 && !spare.empty()) {
+                opening.push_back(spare.back());
+                spare.pop_back();
+                growRequests--;
+            }
+            growRequests = 0;
+        }
+
+        for (Slot* slot : opening) {
+            if (Reconnect(slot)) {
+                counters.size.fetch_add(1, std::memory_order_relaxed);
+                counters.grown.fetch_add(1, std::memory_order_relaxed);
+                Release(slot);
+            } else {
+                std::lock_guard lock(maintenanceMutex);
+                spare.push_back(slot);
+            }
+        }
+    }
+
+    // Claims one connection for closing if the pool is still above minSize.
+    bool TryShrink() {
+        size_t size = counters.size.load(std::memory_order_relaxed);
+        while (size > options.minSize) {
+            if (counters.size.compare_exchange_weak(size, size - 1, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void RecordWait(Clock::duration waited) {
+        const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(waited).count();
+        counters.waits.fetch_add(1, std::memory_order_relaxed);
+        counters.totalWaitMicros.fetch_add(micros, std::memory_order_relaxed);
+        int64_t max = counters.maxWaitMicros.load(std::memory_order_relaxed);
+        while (micros > max && !counters.maxWaitMicros.compare_exchange_weak(max, micros, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Waits for a free connection until the deadline. Past growAfterWait the
+    // pool is asked for another connection, but any returned one is taken.
+    bool WaitForPermit(Clock::time_point deadline) {
+        const auto growAt = Clock::now() + options.growAfterWait;
+        if (growAt < deadline && counters.size.load(std::memory_order_relaxed) < options.maxSize) {
+            if (available.try_acquire_until(growAt)) {
+                return true;
+            }
+            RequestGrowth();
+        }
+        return available.try_acquire_until(deadline);
+    }
+
+    // Takes connections that have been idle longer than the health check
+    // interval out of their shards and pings them. A permit is consumed for each
+    // one removed, so checkouts never count on a slot that is being checked.
+    // Connections unused for longer than idleTimeout are closed while the pool
+    // is above minSize; the rest are pinged.
+    void CheckIdle() {
+        const auto now = Clock::now();
+        const auto staleBefore = now - options.healthCheckInterval;
+        const auto expiredBefore = now - options.idleTimeout;
+        std::vector<Slot*> idle;
+        std::vector<Slot*> expired;
+        for (Shard& shard : shards) {
+            std::lock_guard lock(shard.mutex);
+            for (auto it = shard.free.begin(); it != shard.free.end();) {
+                Slot* slot = *it;
+                const bool isExpired = slot->lastUsed <= expiredBefore;
+                if (!isExpired && std::max(slot->lastUsed, slot->lastChecked) > staleBefore) {
+                    ++it;
+                    continue;
+                }
+                if (!available.try_acquire()) {
+                    break;
+                }
+                if (isExpired && TryShrink()) {
+                    expired.push_back(slot);
+                } else {
+                    idle.push_back(slot);
+                }
+                it = shard.free.erase(it);
+            }
+        }
+
+        for (Slot* slot : expired) {
+            slot->connection.reset();
+            slot->preparedNames.clear();
+            counters.reaped.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (!expired.empty()) {
+            std::lock_guard lock(maintenanceMutex);
+            spare.insert(spare.end(), expired.begin(), expired.end());
+        }
+
+        for (Slot* slot : idle) {
+            if (IsOpen(slot) && Ping(slot)) {
+                slot->lastChecked = Clock::now();
+                Release(slot);
+            } else {
+                MarkBroken(slot);
+            }
+        }
+    }
+
+    void Maintain(std::stop_token stop) {
+        auto nextHealthCheck = Clock::now() + options.healthCheckInterval;
+        while (!stop.stop_requested()) {
+            bool hasBroken;
+            {
+                std::unique_lock lock(maintenanceMutex);
+                const auto wait = broken.empty()
+                    ? std::chrono::duration_cast<std::chrono::milliseconds>(nextHealthCheck - Clock::now())
+                    : options.reconnectInterval;
+                maintenanceCondition.wait_for(lock, stop, wait, [this] { return brokenPending || growRequests > 0; });
+                hasBroken = !broken.empty();
+            }
+            if (stop.stop_requested()) {
+                return;
+            }
+
+            Grow();
+            if (hasBroken) {
+                ReconnectBroken();
+            }
+            if (Clock::now() >= nextHealthCheck) {
+                CheckIdle();
+                nextHealthCheck = Clock::now() + options.healthCheckInterval;
+            }
+        }
+    }
+
+public:
+    ConnectionPool(Callbacks callbacks, ConnectionPoolOptions options)
+        : callbacks(std::move(callbacks)),
+          options(options),
+          shards(ShardCount(options.maxSize, options.shardCount)) {
+        this->options.maxSize = std::max<size_t>({1, options.minSize, options.maxSize});
+        slots.reserve(this->options.maxSize);
+        std::vector<Slot*> opening;
+        for (size_t i = 0; i < this->options.maxSize; i++) {
+            auto slot = std::make_unique<Slot>();
+            slot->shard = i % shards.size();
+            if (i >= options.minSize) {
+                spare.push_back(slot.get());
+            } else {
+                opening.push_back(slot.get());
+            }
+            slots.push_back(std::move(slot));
+        }
+
+        // Each connect is a network round trip plus authentication; opening the
+        // initial connections side by side makes startup cost about one of them.
+        std::vector<char> opened(opening.size(), 0);
+        {
+            std::vector<std::jthread> connecting;
+            connecting.reserve(opening.size());
+            for (size_t i = 0; i < opening.size(); i++) {
+                connecting.emplace_back([this, &opening, &opened, i] { opened[i] = Reconnect(opening[i]); });
+            }
+        }
+
+        size_t healthy = 0;
+        for (size_t i = 0; i < opening.size(); i++) {
+            if (opened[i]) {
+                shards[opening[i]->shard].free.push_back(opening[i]);
+                healthy++;
+            } else {
+                broken.push_back(opening[i]);
+            }
+        }
+        counters.size = options.minSize;
+        available.release(static_cast<std::ptrdiff_t>(healthy));
+        maintenance = std::jthread([this](std::stop_token stop) { Maintain(stop); });
+    }
+
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+    Handle Acquire() {
+        return Acquire(options.acquireTimeout);
+    }
+
+    Handle Acquire(std::chrono::milliseconds timeout) {
+        const auto start = Clock::now();
+        const auto deadline = start + timeout;
+        bool waited = false;
+        while (true) {
+            if (!available.try_acquire()) {
+                waited = true;
+                if (!WaitForPermit(deadline)) {
+                    counters.timeouts.fetch_add(1, std::memory_order_relaxed);
+                    RecordWait(Clock::now() - start);
+                    throw ConnectionTimeoutError(std::format("No database connection available after {} ms", timeout.count()));
+                }
+            }
+
+            Slot* slot = PopFree();
+            if (IsOpen(slot)) {
+                if (waited) {
+                    RecordWait(Clock::now() - start);
+                }
+                counters.acquisitions.fetch_add(1, std::memory_order_relaxed);
+                counters.inUse.fetch_add(1, std::memory_order_relaxed);
+                return Handle(this, slot);
+            }
+            MarkBroken(slot);
+        }
+    }
+
+    // Connections currently open or being reopened.
+    [[nodiscard]] size_t Size() const {
+        return counters.size.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] ConnectionPoolStats Stats() const {
+        return {
+            .size = counters.size.load(std::memory_order_relaxed),
+            .inUse = counters.inUse.load(std::memory_order_relaxed),
+            .minSize = options.minSize,
+            .maxSize = options.maxSize,
+            .acquisitions = counters.acquisitions.load(std::memory_order_relaxed),
+            .waits = counters.waits.load(std::memory_order_relaxed),
+            .totalWait = std::chrono::microseconds(counters.totalWaitMicros.load(std::memory_order_relaxed)),
+            .maxWait = std::chrono::microseconds(counters.maxWaitMicros.load(std::memory_order_relaxed)),
+            .timeouts = counters.timeouts.load(std::memory_order_relaxed),
+            .grown = counters.grown.load(std::memory_order_relaxed),
+            .reaped = counters.reaped.load(std::memory_order_relaxed)
+        };
+    }
+};
+
+#endif //TOURNAMENTS_CONNECTIONPOOL_HPP
@@ -5,37 +5,44 @@
 #ifndef TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
 #define TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
 
-#include <memory>
-#include <functional>
+#include <optional>
+#include <pqxx/pqxx>
 
-class IDbConnection {
-public:
-    virtual ~IDbConnection() = default;
-};
-
-
-class PooledConnection {
-    std::unique_ptr<IDbConnection, std::function<void(IDbConnection*)>> connection;
-public:
-    explicit PooledConnection(
-        IDbConnection* dbc,
-        std::function<void(IDbConnection*)> deleter) : connection(dbc, std::move(deleter)) {}
-
-    IDbConnection* operator->() { return connection.get(); }
-    IDbConnection& operator*() { return *connection; }
-       // disable copy
-    PooledConnection(const PooledConnection&) = delete;
-    PooledConnection& operator=(const PooledConnection&) = delete;
-
-    // allow move
-    PooledConnection(PooledConnection&&) noexcept = default;
-    PooledConnection& operator=(PooledConnection&&) noexcept = default;
-};
+#include "ConnectionPool.hpp"
 
+// Typed checkout handle: dereferences straight to the pooled pqxx::connection.
+using PooledConnection = ConnectionPool<pqxx::connection>::Handle;
 
 class IDbConnectionProvider {
 public:
     virtual ~IDbConnectionProvider() = default;
+
+    // Read-write connection on the primary.
     virtual PooledConnection Connection() = 0;
+
+    // Connection for read-only statements. Providers with a replica serve it from
+    // there; replicas may lag, so callers that must see their own writes open a
+    // ReadYourWrites scope.
+    virtual PooledConnection ReadConnection() {
+        return Connection();
+    }
+
+    // Counters of the primary pool, and of the replica pool when there is one.
+    [[nodiscard]] virtual ConnectionPoolStats PoolStats() const = 0;
+    [[nodiscard]] virtual std::optional<ConnectionPoolStats> ReadPoolStats() const {
+        return std::nullopt;
+    }
+};
+
+// While alive, ReadConnection() on this thread is served by the primary.
+class ReadYourWrites {
+    static inline thread_local int depth = 0;
+public:
+    ReadYourWrites() { ++depth; }
+    ~ReadYourWrites() { --depth; }
+    ReadYourWrites(const ReadYourWrites&) = delete;
+    ReadYourWrites& operator=(const ReadYourWrites&) = delete;
+
+    [[nodiscard]] static bool Active() { return depth > 0; }
 };
-#endif //TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
\ No newline at end of file
+#endif //TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
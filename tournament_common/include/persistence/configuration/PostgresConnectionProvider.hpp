@@ -4,97 +4,99 @@
 
 #ifndef TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
 #define TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
-#include <condition_variable>
-#include <queue>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
 #include <pqxx/pqxx>
 
 #include "IDbConnectionProvider.hpp"
-#include "PostgresConnection.hpp"
+#include "configuration/DatabaseConfiguration.hpp"
+#include "ConnectionPool.hpp"
+#include "StatementMetrics.hpp"
 
 class PostgresConnectionProvider : public IDbConnectionProvider{
-    std::string_view connectionString;
-    size_t poolSize = 1;
-    std::queue<std::unique_ptr<pqxx::connection>> connectionPool;
-    std::mutex connectionPoolMutex;
-    std::condition_variable connectionPoolCondition;
+    std::string connectionString;
+    std::string readConnectionString;
+    ConnectionPool<pqxx::connection> connectionPool;
+    // Only present when a replica is configured.
+    std::unique_ptr<ConnectionPool<pqxx::connection>> readPool;
 
-public:
-    PostgresConnectionProvider(std::string_view connectionString, size_t poolSize) : connectionString(connectionString), poolSize(poolSize) {
-        for (size_t i = 0; i < poolSize; i++) {
-            connectionPool.push(std::make_unique<pqxx::connection>(connectionString.data()));
-            connectionPool.back()->prepare("insert_tournament", "insert into TOURNAMENTS (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("select_tournament_by_id", "select * from TOURNAMENTS where id = $1");
-            connectionPool.back()->prepare("update_tournament_by_id", "update TOURNAMENTS set document = $2 where id = $1 RETURNING id");
-            connectionPool.back()->prepare("delete_tournament_by_id", "delete from TOURNAMENTS where id = $1");
+    static bool Ping(pqxx::connection& connection) {
+        try {
+            pqxx::nontransaction tx(connection);
+            tx.exec("SELECT 1");
+            return true;
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    static ConnectionPoolCallbacks<pqxx::connection> Callbacks(const std::string& connectionString) {
+        return {
+            .connect = [&connectionString] { return std::make_unique<pqxx::connection>(connectionString); },
+            .isOpen = [](const pqxx::connection& connection) { return connection.is_open(); },
+            .ping = Ping
+        };
+    }
 
-            connectionPool.back()->prepare("insert_team", "insert into TEAMS (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("select_team_by_id", "select * from TEAMS where id = $1");
-            connectionPool.back()->prepare("update_team_by_id", "update TEAMS set document = $2 where id = $1 RETURNING id");
-            connectionPool.back()->prepare("delete_team_by_id", "delete from TEAMS where id = $1");
+    static ConnectionPoolOptions Options(size_t minSize, size_t maxSize, const config::DatabaseConfiguration& configuration) {
+        return {
+            .minSize = minSize,
+            .maxSize = maxSize,
+            .acquireTimeout = std::chrono::milliseconds(configuration.acquireTimeoutMs),
+            .growAfterWait = std::chrono::milliseconds(configuration.growAfterWaitMs),
+            .idleTimeout = std::chrono::milliseconds(configuration.idleTimeoutMs),
+            .healthCheckInterval = std::chrono::milliseconds(configuration.healthCheckIntervalMs),
+            .reconnectInterval = std::chrono::milliseconds(configuration.reconnectIntervalMs)
+        };
+    }
 
-            connectionPool.back()->prepare("insert_group", "insert into GROUPS (tournament_id, document) values($1, $2) RETURNING id");
-            connectionPool.back()->prepare("select_group_by_tournamentid_groupid", "select * from GROUPS where tournament_id = $1 and id = $2");
-            connectionPool.back()->prepare("select_groups_by_tournament", "select * from GROUPS where tournament_id = $1");
-            connectionPool.back()->prepare("select_groups_by_tournament_conference", 
-                "select * from GROUPS where tournament_id = $1 and document->>'conference' = $2");
-            connectionPool.back()->prepare("select_group_in_tournament", R"(
-                select * from GROUPS
-                where tournament_id = $1
-                and document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', $2::text)))
-            )");
-            connectionPool.back()->prepare("update_group_by_id", "update GROUPS set tournament_id = $1, document = $2 where id = $3 RETURNING id");
-            connectionPool.back()->prepare("delete_group_by_id", "delete from GROUPS where id = $1");;
-            connectionPool.back()->prepare("update_group_add_team", R"(
-                update GROUPS
-                    set document = jsonb_insert(document, '{teams,-1}', $2),
-                        last_update_date = CURRENT_TIMESTAMP
-                    where id = $1
-                RETURNING id
-            )");
+    // The checkout time is charged to the next statement this thread runs.
+    static PooledConnection TimedAcquire(ConnectionPool<pqxx::connection>& pool) {
+        const auto started = std::chrono::steady_clock::now();
+        auto pooled = pool.Acquire();
+        StatementMetrics::NotePoolWait(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started));
+        return pooled;
+    }
 
-            connectionPool.back()->prepare("insert_match",
-                "insert into MATCHES (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("select_match_by_id",
-                "select * from MATCHES where id = $1");
-            connectionPool.back()->prepare("update_match_by_id",
-                "update MATCHES set document = $2 where id = $1 RETURNING id");
-            connectionPool.back()->prepare("select_matches_by_tournament",
-                "select * from MATCHES where document->>'tournamentId' = $1");
-            connectionPool.back()->prepare("select_played_matches_by_tournament",
-                "select * from MATCHES where document->>'tournamentId' = $1 AND document->'score' IS NOT NULL");
-            connectionPool.back()->prepare("select_pending_matches_by_tournament",
-                "select * from MATCHES where document->>'tournamentId' = $1 AND document->'score' IS NULL");
+public:
+    explicit PostgresConnectionProvider(const config::DatabaseConfiguration& configuration)
+        : connectionString(configuration.connectionString),
+          readConnectionString(configuration.readConnectionString),
+          connectionPool(Callbacks(connectionString),
+                         Options(configuration.minPoolSize, configuration.maxPoolSize, configuration)) {
+        if (!readConnectionString.empty()) {
+            readPool = std::make_unique<ConnectionPool<pqxx::connection>>(
+                Callbacks(readConnectionString),
+                Options(configuration.minReadPoolSize, configuration.maxReadPoolSize, configuration));
         }
     }
 
+    // Waits at most acquireTimeout for a healthy connection, then throws ConnectionTimeoutError.
     PooledConnection Connection() override {
-        std::unique_lock lock(connectionPoolMutex);
-
-        // wait until a connection is available
-        connectionPoolCondition.wait(lock, [this] { return !connectionPool.empty(); });
-
-        // take one out
-        auto conn = std::move(connectionPool.front());
-        connectionPool.pop();
-
-        // build PostgresConnection wrapper (adapts pqxx::connection -> IDbConnection)
-        auto dbc = new PostgresConnection(std::move(conn));
+        return TimedAcquire(connectionPool);
+    }
 
-        // return a RAII PooledConnection
-        return PooledConnection(
-            dbc,
-            [this](IDbConnection* dbc) {
-                auto pc = dynamic_cast<PostgresConnection*>(dbc);
+    // Replica connection, or the primary when no replica is configured or a
+    // ReadYourWrites scope is active.
+    PooledConnection ReadConnection() override {
+        if (!readPool || ReadYourWrites::Active()) {
+            return TimedAcquire(connectionPool);
+        }
+        return TimedAcquire(*readPool);
+    }
 
-                {
-                    std::lock_guard<std::mutex> lock(connectionPoolMutex);
-                    connectionPool.push(std::move(pc->connection));
-                }
+    [[nodiscard]] ConnectionPoolStats PoolStats() const override {
+        return connectionPool.Stats();
+    }
 
-                delete pc;
-                connectionPoolCondition.notify_one();
-            }
-        );
+    [[nodiscard]] std::optional<ConnectionPoolStats> ReadPoolStats() const override {
+        if (!readPool) {
+            return std::nullopt;
+        }
+        return readPool->Stats();
     }
 };
-#endif //TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
\ No newline at end of file
+#endif //TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
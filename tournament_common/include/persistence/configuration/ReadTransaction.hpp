@@ -0,0 +1,97 @@
+#ifndef TOURNAMENTS_READTRANSACTION_HPP
+#define TOURNAMENTS_READTRANSACTION_HPP
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <pqxx/pqxx>
+
+#include "IDbConnectionProvider.hpp"
+#include "UnitOfWork.hpp"
+
+// Repository reads run in autocommit mode by default: one SELECT is one round
+// trip, with no BEGIN/COMMIT around it. Callers that need several reads to see
+// the same data open a SnapshotRead; until it goes out of scope, every read on
+// this thread shares one connection and one read-only REPEATABLE READ transaction.
+// As in UnitOfWork, once a read fails every later read in the scope fails as well.
+class SnapshotRead {
+    using Transaction = pqxx::transaction<pqxx::isolation_level::repeatable_read, pqxx::write_policy::read_only>;
+
+    static inline thread_local SnapshotRead* active = nullptr;
+
+    // A nested SnapshotRead keeps using the outer one.
+    bool owner;
+    bool failed = false;
+    // Declared before the transaction so the transaction ends first.
+    std::optional<PooledConnection> connection;
+    std::unique_ptr<Transaction> transaction;
+
+public:
+    SnapshotRead() : owner(active == nullptr) {
+        if (owner) {
+            active = this;
+        }
+    }
+
+    ~SnapshotRead() {
+        if (!owner) {
+            return;
+        }
+        active = nullptr;
+        if (transaction) {
+            try {
+                transaction->commit();
+            } catch (const std::exception&) {
+                // Nothing was written; a failed COMMIT only means the snapshot is gone.
+            }
+        }
+    }
+
+    SnapshotRead(const SnapshotRead&) = delete;
+    SnapshotRead& operator=(const SnapshotRead&) = delete;
+
+    [[nodiscard]] static SnapshotRead* Active() { return active; }
+
+    // The connection and transaction are taken on the first read, not when the scope opens.
+    template<typename Body>
+    auto Execute(IDbConnectionProvider& provider, Body&& body) {
+        if (failed) {
+            // A new transaction would read from a different snapshot than the earlier
+            // reads, which is what the scope exists to prevent.
+            throw std::runtime_error("snapshot read aborted by an earlier statement");
+        }
+        if (!connection) {
+            connection.emplace(provider.ReadConnection());
+        }
+        if (!transaction) {
+            transaction = std::make_unique<Transaction>(**connection);
+        }
+        try {
+            return body(*connection, static_cast<pqxx::transaction_base&>(*transaction));
+        } catch (...) {
+            // A failed statement aborts the transaction; later reads in the scope fail too.
+            failed = true;
+            transaction.reset();
+            throw;
+        }
+    }
+};
+
+// Runs body(PooledConnection&, pqxx::transaction_base&) for a read-only statement,
+// inside the active UnitOfWork or SnapshotRead if there is one, otherwise as a
+// nontransaction. An open UnitOfWork wins so reads see its uncommitted writes.
+template<typename Body>
+auto ExecuteRead(IDbConnectionProvider& provider, Body&& body) {
+    if (auto* unit = UnitOfWork::Active()) {
+        return unit->Execute(provider, std::forward<Body>(body));
+    }
+    if (auto* snapshot = SnapshotRead::Active()) {
+        return snapshot->Execute(provider, std::forward<Body>(body));
+    }
+    auto pooled = provider.ReadConnection();
+    pqxx::nontransaction tx(*pooled);
+    return body(pooled, static_cast<pqxx::transaction_base&>(tx));
+}
+
+#endif //TOURNAMENTS_READTRANSACTION_HPP
@@ -0,0 +1,181 @@
+#ifndef TOURNAMENTS_STATEMENTMETRICS_HPP
+#define TOURNAMENTS_STATEMENTMETRICS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+// Counters for every prepared statement, keyed by statement name. Each run adds
+// its latency to a fixed-bucket histogram, plus the rows it returned or touched,
+// whether it failed, and how long the thread waited on the pool for the connection.
+// The counters are atomics and the name map sits behind a shared lock, so statements
+// running on different threads never block each other to record.
+class StatementMetrics {
+public:
+    // Upper bound of each latency bucket; one extra bucket counts everything slower.
+    static constexpr std::array<std::chrono::microseconds, 12> LATENCY_BOUNDS{
+        std::chrono::microseconds(100), std::chrono::microseconds(250), std::chrono::microseconds(500),
+        std::chrono::milliseconds(1), std::chrono::microseconds(2500), std::chrono::milliseconds(5),
+        std::chrono::milliseconds(10), std::chrono::milliseconds(25), std::chrono::milliseconds(50),
+        std::chrono::milliseconds(100), std::chrono::milliseconds(250), std::chrono::seconds(1)
+    };
+    static constexpr size_t BUCKET_COUNT = LATENCY_BOUNDS.size() + 1;
+
+    struct Totals {
+        std::string statement;
+        uint64_t calls = 0;
+        uint64_t errors = 0;
+        uint64_t rows = 0;
+        std::chrono::microseconds totalLatency{0};
+        std::chrono::microseconds maxLatency{0};
+        std::chrono::microseconds poolWait{0};
+        std::array<uint64_t, BUCKET_COUNT> buckets{};
+    };
+
+    // Process-wide instance the repositories record into.
+    static const std::shared_ptr<StatementMetrics>& Global() {
+        static const auto instance = std::make_shared<StatementMetrics>();
+        return instance;
+    }
+
+    // Called by the connection provider after a checkout; the wait is charged to
+    // the next statement this thread records.
+    static void NotePoolWait(std::chrono::microseconds wait) {
+        pendingPoolWait += wait;
+    }
+
+    // Charges the pool wait noted on this thread since its last statement.
+    void Record(std::string_view statement, std::chrono::microseconds latency, uint64_t rows, bool failed) {
+        Record(statement, latency, rows, failed, std::exchange(pendingPoolWait, std::chrono::microseconds{0}));
+    }
+
+    // For callers that track the wait themselves, like the async connections, whose
+    // coroutines interleave on one thread.
+    void Record(std::string_view statement, std::chrono::microseconds latency, uint64_t rows, bool failed,
+                std::chrono::microseconds poolWait) {
+        auto& counters = CountersFor(statement);
+        const auto latencyUs = static_cast<uint64_t>(latency.count());
+
+        counters.calls.fetch_add(1, std::memory_order_relaxed);
+        counters.rows.fetch_add(rows, std::memory_order_relaxed);
+        if (failed) {
+            counters.errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        counters.latencyUs.fetch_add(latencyUs, std::memory_order_relaxed);
+        auto max = counters.maxLatencyUs.load(std::memory_order_relaxed);
+        while (latencyUs > max && !counters.maxLatencyUs.compare_exchange_weak(max, latencyUs, std::memory_order_relaxed)) {
+        }
+        const auto bucket = std::ranges::lower_bound(LATENCY_BOUNDS, latency) - LATENCY_BOUNDS.begin();
+        counters.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        counters.poolWaitUs.fetch_add(static_cast<uint64_t>(poolWait.count()), std::memory_order_relaxed);
+    }
+
+    // Current totals, slowest statement (by accumulated latency) first.
+    [[nodiscard]] std::vector<Totals> Snapshot() const {
+        std::vector<Totals> snapshot;
+        {
+            std::shared_lock lock(mutex);
+            snapshot.reserve(counters.size());
+            for (const auto& [statement, entry] : counters) {
+                Totals totals;
+                totals.statement = statement;
+                totals.calls = entry->calls.load(std::memory_order_relaxed);
+                totals.errors = entry->errors.load(std::memory_order_relaxed);
+                totals.rows = entry->rows.load(std::memory_order_relaxed);
+                totals.totalLatency = std::chrono::microseconds(entry->latencyUs.load(std::memory_order_relaxed));
+                totals.maxLatency = std::chrono::microseconds(entry->maxLatencyUs.load(std::memory_order_relaxed));
+                totals.poolWait = std::chrono::microseconds(entry->poolWaitUs.load(std::memory_order_relaxed));
+                for (size_t i = 0; i < BUCKET_COUNT; i++) {
+                    totals.buckets[i] = entry->buckets[i].load(std::memory_order_relaxed);
+                }
+                snapshot.push_back(std::move(totals));
+            }
+        }
+        std::ranges::sort(snapshot, std::ranges::greater{}, &Totals::totalLatency);
+        return snapshot;
+    }
+
+    // Zeroes the counters; entries stay so a statement recording right now never loses its slot.
+    void Reset() {
+        std::shared_lock lock(mutex);
+        for (const auto& [statement, entry] : counters) {
+            entry->calls.store(0, std::memory_order_relaxed);
+            entry->errors.store(0, std::memory_order_relaxed);
+            entry->rows.store(0, std::memory_order_relaxed);
+            entry->latencyUs.store(0, std::memory_order_relaxed);
+            entry->maxLatencyUs.store(0, std::memory_order_relaxed);
+            entry->poolWaitUs.store(0, std::memory_order_relaxed);
+            for (auto& bucket : entry->buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct Counters {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> errors{0};
+        std::atomic<uint64_t> rows{0};
+        std::atomic<uint64_t> latencyUs{0};
+        std::atomic<uint64_t> maxLatencyUs{0};
+        std::atomic<uint64_t> poolWaitUs{0};
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets{};
+    };
+
+    static inline thread_local std::chrono::microseconds pendingPoolWait{0};
+
+    mutable std::shared_mutex mutex;
+    // Entries are never erased, so a reference taken under the lock stays valid while recording.
+    std::map<std::string, std::unique_ptr<Counters>, std::less<>> counters;
+
+    Counters& CountersFor(std::string_view statement) {
+        {
+            std::shared_lock lock(mutex);
+            if (const auto found = counters.find(statement); found != counters.end()) {
+                return *found->second;
+            }
+        }
+        std::unique_lock lock(mutex);
+        auto& entry = counters[std::string(statement)];
+        if (!entry) {
+            entry = std::make_unique<Counters>();
+        }
+        return *entry;
+    }
+};
+
+inline void to_json(nlohmann::json& json, const StatementMetrics::Totals& totals) {
+    nlohmann::json buckets = nlohmann::json::array();
+    for (size_t i = 0; i < StatementMetrics::BUCKET_COUNT; i++) {
+        buckets.push_back({
+            {"leUs", i < StatementMetrics::LATENCY_BOUNDS.size()
+                ? nlohmann::json(StatementMetrics::LATENCY_BOUNDS[i].count())
+                : nlohmann::json("inf")},
+            {"count", totals.buckets[i]}
+        });
+    }
+    json = {
+        {"statement", totals.statement},
+        {"calls", totals.calls},
+        {"errors", totals.errors},
+        {"rows", totals.rows},
+        {"totalLatencyUs", totals.totalLatency.count()},
+        {"meanLatencyUs", totals.calls == 0 ? 0 : totals.totalLatency.count() / static_cast<int64_t>(totals.calls)},
+        {"maxLatencyUs", totals.maxLatency.count()},
+        {"poolWaitUs", totals.poolWait.count()},
+        {"latencyBuckets", buckets}
+    };
+}
+
+#endif //TOURNAMENTS_STATEMENTMETRICS_HPP
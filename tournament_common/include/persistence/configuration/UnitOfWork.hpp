@@ -0,0 +1,133 @@
+#ifndef TOURNAMENTS_UNITOFWORK_HPP
+#define TOURNAMENTS_UNITOFWORK_HPP
+
+#include <expected>
+#include <format>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <pqxx/pqxx>
+
+#include "IDbConnectionProvider.hpp"
+
+// Request-scoped unit of work. While one is open, every repository statement on
+// this thread (reads included) runs on the same primary connection and inside one
+// read-write transaction, so a multi-step write checks out the pool once and either
+// lands completely or not at all. Commit() makes the writes durable; leaving the
+// scope without committing rolls them back.
+class UnitOfWork {
+    static inline thread_local UnitOfWork* active = nullptr;
+
+    // A nested UnitOfWork joins the outer one; only the outermost commits.
+    bool owner;
+    bool failed = false;
+    // Declared before the transaction so the transaction ends first.
+    std::optional<PooledConnection> connection;
+    std::unique_ptr<pqxx::work> transaction;
+    std::vector<std::function<void()>> afterCompletion;
+
+    void RunAfterCompletion() {
+        auto hooks = std::move(afterCompletion);
+        afterCompletion.clear();
+        for (auto& hook : hooks) {
+            hook();
+        }
+    }
+
+public:
+    UnitOfWork() : owner(active == nullptr) {
+        if (owner) {
+            active = this;
+        }
+    }
+
+    ~UnitOfWork() {
+        if (owner) {
+            active = nullptr;
+            // pqxx::work aborts in its destructor when Commit() was not reached.
+            transaction.reset();
+            RunAfterCompletion();
+        }
+    }
+
+    UnitOfWork(const UnitOfWork&) = delete;
+    UnitOfWork& operator=(const UnitOfWork&) = delete;
+
+    [[nodiscard]] static UnitOfWork* Active() { return active; }
+
+    // Runs hook once the outermost scope has committed or rolled back. Caches evict
+    // from it: before that point another thread would re-read the old row, and a
+    // read inside the unit may have cached rows that a rollback discards.
+    void AfterCompletion(std::function<void()> hook) {
+        afterCompletion.push_back(std::move(hook));
+    }
+
+    // The connection and transaction are taken on the first statement, not when the
+    // scope opens, so a request rejected by validation never touches the pool.
+    template<typename Body>
+    auto Execute(IDbConnectionProvider& provider, Body&& body) {
+        if (failed) {
+            // Postgres rejects everything after an error until rollback; starting a
+            // fresh transaction here would commit only part of the unit.
+            throw std::runtime_error("unit of work aborted by an earlier statement");
+        }
+        if (!connection) {
+            connection.emplace(provider.Connection());
+        }
+        if (!transaction) {
+            transaction = std::make_unique<pqxx::work>(**connection);
+        }
+        try {
+            return body(*connection, static_cast<pqxx::transaction_base&>(*transaction));
+        } catch (...) {
+            failed = true;
+            transaction.reset();
+            throw;
+        }
+    }
+
+    // Commits what the scope wrote. A no-op in a nested scope and when nothing ran.
+    std::expected<void, std::string> Commit() {
+        if (!owner) {
+            return {};
+        }
+        if (failed) {
+            return std::unexpected("Database error: unit of work was rolled back");
+        }
+        if (!transaction) {
+            RunAfterCompletion();
+            return {};
+        }
+        try {
+            transaction->commit();
+            transaction.reset();
+            RunAfterCompletion();
+            return {};
+        } catch (const std::exception& e) {
+            failed = true;
+            transaction.reset();
+            RunAfterCompletion();
+            return std::unexpected(std::format("Database error: {}", e.what()));
+        }
+    }
+};
+
+// Runs body(PooledConnection&, pqxx::transaction_base&) for a write, inside the
+// active UnitOfWork if there is one, otherwise in its own committed transaction.
+template<typename Body>
+auto ExecuteWrite(IDbConnectionProvider& provider, Body&& body) {
+    if (auto* unit = UnitOfWork::Active()) {
+        return unit->Execute(provider, std::forward<Body>(body));
+    }
+    auto pooled = provider.Connection();
+    pqxx::work tx(*pooled);
+    auto result = body(pooled, static_cast<pqxx::transaction_base&>(tx));
+    tx.commit();
+    return result;
+}
+
+#endif //TOURNAMENTS_UNITOFWORK_HPP
@@ -0,0 +1,38 @@
+//
+// Created by developer on 10/15/26.
+//
+
+#ifndef TOURNAMENTS_ASYNCMATCHREPOSITORY_HPP
+#define TOURNAMENTS_ASYNCMATCHREPOSITORY_HPP
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <string>
+#include <vector>
+#include <asio.hpp>
+
+#include "IAsyncMatchRepository.hpp"
+#include "MatchQuery.hpp"
+#include "domain/Match.hpp"
+#include "persistence/configuration/AsyncConnectionProvider.hpp"
+
+// Versión asíncrona de las operaciones de MatchRepository que usan los handlers
+// asíncronos. Usa los mismos statements y el mismo documento que MatchRepository.
+class AsyncMatchRepository : public IAsyncMatchRepository {
+    std::shared_ptr<AsyncConnectionProvider> connectionProvider;
+
+public:
+    explicit AsyncMatchRepository(std::shared_ptr<AsyncConnectionProvider> connectionProvider);
+
+    asio::awaitable<std::expected<ScoreUpdate, std::string>>
+        UpdateScore(std::string tournamentId, std::string matchId, domain::Score score,
+                    std::vector<domain::RoundType> validRounds) override;
+
+    asio::awaitable<std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>>
+        Find(MatchQuery query) override;
+
+    asio::awaitable<std::expected<int64_t, std::string>> ReadChangeVersion(std::string tournamentId) override;
+};
+
+#endif //TOURNAMENTS_ASYNCMATCHREPOSITORY_HPP
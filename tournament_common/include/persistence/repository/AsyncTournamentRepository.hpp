@@ -0,0 +1,29 @@
+//
+// Created by developer on 10/15/26.
+//
+
+#ifndef TOURNAMENTS_ASYNCTOURNAMENTREPOSITORY_HPP
+#define TOURNAMENTS_ASYNCTOURNAMENTREPOSITORY_HPP
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <asio.hpp>
+
+#include "IAsyncTournamentRepository.hpp"
+#include "domain/Tournament.hpp"
+#include "persistence/configuration/AsyncConnectionProvider.hpp"
+
+// Versión asíncrona de las operaciones de TournamentRepository que usan los
+// handlers asíncronos. Los parámetros van por valor porque la corrutina los
+// necesita después de cada suspensión.
+class AsyncTournamentRepository : public IAsyncTournamentRepository {
+    std::shared_ptr<AsyncConnectionProvider> connectionProvider;
+
+public:
+    explicit AsyncTournamentRepository(std::shared_ptr<AsyncConnectionProvider> connectionProvider);
+
+    asio::awaitable<std::expected<std::shared_ptr<domain::Tournament>, std::string>> ReadById(std::string id) override;
+};
+
+#endif //TOURNAMENTS_ASYNCTOURNAMENTREPOSITORY_HPP
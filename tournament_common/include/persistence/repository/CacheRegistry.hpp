@@ -0,0 +1,38 @@
+#ifndef TOURNAMENTS_CACHEREGISTRY_HPP
+#define TOURNAMENTS_CACHEREGISTRY_HPP
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Los cachés en proceso por nombre, para que quien recibe un evento de otro nodo
+// pueda sacar una entrada sin conocer el tipo de cada caché.
+class CacheRegistry {
+    std::mutex mutex;
+    std::map<std::string, std::vector<std::function<void(const std::string&)>>, std::less<>> evictors;
+public:
+    void Register(std::string_view cache, std::function<void(const std::string& id)> evict) {
+        std::lock_guard lock(mutex);
+        evictors[std::string(cache)].push_back(std::move(evict));
+    }
+
+    // Sin caché con ese nombre no hace nada
+    void Evict(std::string_view cache, const std::string& id) {
+        std::vector<std::function<void(const std::string&)>> targets;
+        {
+            std::lock_guard lock(mutex);
+            if (const auto found = evictors.find(cache); found != evictors.end()) {
+                targets = found->second;
+            }
+        }
+        for (const auto& evict : targets) {
+            evict(id);
+        }
+    }
+};
+
+#endif //TOURNAMENTS_CACHEREGISTRY_HPP
@@ -0,0 +1,157 @@
+#ifndef TOURNAMENTS_CACHEDREPOSITORY_HPP
+#define TOURNAMENTS_CACHEDREPOSITORY_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "IRepository.hpp"
+#include "configuration/CacheConfiguration.hpp"
+#include "persistence/configuration/CacheMetrics.hpp"
+#include "persistence/configuration/UnitOfWork.hpp"
+
+// Decorador read-through de ReadById para entidades que casi no cambian. Las entradas
+// viven en shards con su propio lock, cada uno con tope de tamaño (sale la menos usada)
+// y TTL. Update y Delete de este proceso invalidan la entrada; las escrituras de otros
+// procesos llegan por Evict (ver CacheRegistry) y el TTL acota lo que tarde ese aviso.
+// Lo demás pasa directo al repositorio.
+template<typename Type>
+class CachedRepository : public IRepository<Type, std::string, std::expected<std::string, std::string>> {
+    using Repository = IRepository<Type, std::string, std::expected<std::string, std::string>>;
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        std::shared_ptr<const Type> value;
+        Clock::time_point expiresAt;
+        std::list<std::string>::iterator recency;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<std::string, Entry> entries;
+        // Más reciente al frente
+        std::list<std::string> recency;
+        // Sube con cada invalidación; una lectura que empezó antes no guarda su resultado
+        uint64_t generation = 0;
+    };
+
+    std::shared_ptr<Repository> repository;
+    std::chrono::milliseconds ttl;
+    std::vector<std::unique_ptr<Shard>> shards;
+    size_t shardCapacity = 1;
+    CacheMetrics::Counters& counters;
+
+    Shard& ShardFor(const std::string& id) {
+        return *shards[std::hash<std::string>{}(id) % shards.size()];
+    }
+
+public:
+    CachedRepository(std::shared_ptr<Repository> repository, std::string_view name,
+                     const config::CacheConfiguration& configuration,
+                     const std::shared_ptr<CacheMetrics>& metrics = CacheMetrics::Global())
+        : repository(std::move(repository)),
+          ttl(configuration.ttlMs),
+          shards(std::max<size_t>(1, configuration.shards)),
+          counters(metrics->For(name)) {
+        for (auto& shard : shards) {
+            shard = std::make_unique<Shard>();
+        }
+        shardCapacity = std::max<size_t>(1, (configuration.capacity + shards.size() - 1) / shards.size());
+    }
+
+    // La usan Update y Delete, y los eventos de escrituras hechas en otro nodo
+    void Evict(const std::string& id) {
+        auto& shard = ShardFor(id);
+        std::lock_guard lock(shard.mutex);
+        shard.generation++;
+        if (const auto found = shard.entries.find(id); found != shard.entries.end()) {
+            shard.recency.erase(found->second.recency);
+            shard.entries.erase(found);
+            counters.invalidations.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::expected<std::string, std::string> Create(const Type& entity) override {
+        return repository->Create(entity);
+    }
+
+    std::expected<std::vector<std::shared_ptr<Type>>, std::string> ReadAll() override {
+        return repository->ReadAll();
+    }
+
+    std::expected<std::shared_ptr<Type>, std::string> ReadById(std::string id) override {
+        auto& shard = ShardFor(id);
+        uint64_t generation;
+        {
+            std::lock_guard lock(shard.mutex);
+            if (const auto found = shard.entries.find(id); found != shard.entries.end()) {
+                if (Clock::now() < found->second.expiresAt) {
+                    shard.recency.splice(shard.recency.begin(), shard.recency, found->second.recency);
+                    counters.hits.fetch_add(1, std::memory_order_relaxed);
+                    // Copia: quien llama puede modificar la entidad sin tocar la del caché
+                    return std::make_shared<Type>(*found->second.value);
+                }
+                shard.recency.erase(found->second.recency);
+                shard.entries.erase(found);
+            }
+            generation = shard.generation;
+        }
+        counters.misses.fetch_add(1, std::memory_order_relaxed);
+
+        // Los errores (incluido "no encontrado") no se guardan
+        auto result = repository->ReadById(id);
+        if (!result || !*result) {
+            return result;
+        }
+
+        auto value = std::make_shared<const Type>(**result);
+        std::lock_guard lock(shard.mutex);
+        if (shard.generation != generation || shard.entries.contains(id)) {
+            return result;
+        }
+        if (shard.entries.size() >= shardCapacity) {
+            shard.entries.erase(shard.recency.back());
+            shard.recency.pop_back();
+            counters.evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+        shard.recency.push_front(id);
+        shard.entries.emplace(id, Entry{std::move(value), Clock::now() + ttl, shard.recency.begin()});
+        return result;
+    }
+
+    std::expected<std::string, std::string> Update(std::string id, const Type& entity) override {
+        return EvictAround(id, [&] { return repository->Update(id, entity); });
+    }
+
+    std::expected<void, std::string> Delete(std::string id) override {
+        return EvictAround(id, [&] { return repository->Delete(id); });
+    }
+
+private:
+    // Sin UnitOfWork la escritura ya está confirmada al volver: se invalida antes y después.
+    // Dentro de una, la entrada se invalida cuando la unidad termina; invalidar antes dejaría
+    // que otro hilo vuelva a guardar la versión anterior mientras la escritura no es visible.
+    template<typename Write>
+    auto EvictAround(const std::string& id, Write&& write) {
+        if (auto* unit = UnitOfWork::Active()) {
+            unit->AfterCompletion([this, id] { Evict(id); });
+            return write();
+        }
+        Evict(id);
+        auto result = write();
+        Evict(id);
+        return result;
+    }
+};
+
+#endif //TOURNAMENTS_CACHEDREPOSITORY_HPP
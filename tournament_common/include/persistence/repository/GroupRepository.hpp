@@ -10,7 +10,6 @@
 
 #include "IGroupRepository.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
-#include "persistence/configuration/PostgresConnection.hpp"
 #include "domain/Group.hpp"
 
 class GroupRepository : public IGroupRepository {
@@ -25,8 +24,10 @@ public:
     std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> FindByTournamentId(const std::string_view& tournamentId) override;
     std::expected<std::shared_ptr<domain::Group>, std::string> FindByTournamentIdAndGroupId(const std::string_view& tournamentId, const std::string_view& groupId) override;
     std::expected<std::shared_ptr<domain::Group>, std::string> FindByTournamentIdAndTeamId(const std::string_view& tournamentId, const std::string_view& teamId) override;
+    std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> FindGroupsContainingAnyTeam(const std::string_view& tournamentId, std::span<const std::string> teamIds) override;
     std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> FindByTournamentIdAndConference(const std::string_view& tournamentId, const std::string_view& conference) override;
     std::expected<void, std::string> UpdateGroupAddTeam(const std::string_view& groupId, const std::shared_ptr<domain::Team> & team) override;
+    std::expected<int64_t, std::string> ReadChangeVersion(const std::string_view& tournamentId) override;
 };
 
 #endif //TOURNAMENTS_GROUPREPOSITORY_HPP
\ No newline at end of file
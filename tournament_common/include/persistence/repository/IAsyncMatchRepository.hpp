@@ -0,0 +1,37 @@
+//
+// Created by developer on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_IASYNCMATCHREPOSITORY_HPP
+#define TOURNAMENTS_IASYNCMATCHREPOSITORY_HPP
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <string>
+#include <vector>
+#include <asio.hpp>
+
+#include "IMatchRepository.hpp"
+#include "MatchQuery.hpp"
+#include "domain/Match.hpp"
+
+// Operaciones de matches para los handlers asíncronos. Los parámetros van por valor
+// porque la corrutina los necesita después de cada suspensión.
+class IAsyncMatchRepository {
+public:
+    virtual ~IAsyncMatchRepository() = default;
+
+    // Mismo contrato que IMatchRepository::UpdateScore
+    virtual asio::awaitable<std::expected<ScoreUpdate, std::string>>
+        UpdateScore(std::string tournamentId, std::string matchId, domain::Score score,
+                    std::vector<domain::RoundType> validRounds) = 0;
+
+    virtual asio::awaitable<std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>>
+        Find(MatchQuery query) = 0;
+
+    // Versión de cambios de los matches del torneo; "Tournament not found" si no existe
+    virtual asio::awaitable<std::expected<int64_t, std::string>> ReadChangeVersion(std::string tournamentId) = 0;
+};
+
+#endif //TOURNAMENTS_IASYNCMATCHREPOSITORY_HPP
@@ -0,0 +1,23 @@
+//
+// Created by developer on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_IASYNCTOURNAMENTREPOSITORY_HPP
+#define TOURNAMENTS_IASYNCTOURNAMENTREPOSITORY_HPP
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <asio.hpp>
+
+#include "domain/Tournament.hpp"
+
+// Operaciones de torneos para los handlers asíncronos
+class IAsyncTournamentRepository {
+public:
+    virtual ~IAsyncTournamentRepository() = default;
+
+    virtual asio::awaitable<std::expected<std::shared_ptr<domain::Tournament>, std::string>> ReadById(std::string id) = 0;
+};
+
+#endif //TOURNAMENTS_IASYNCTOURNAMENTREPOSITORY_HPP
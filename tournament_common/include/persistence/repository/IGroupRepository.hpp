@@ -5,7 +5,10 @@
 #ifndef COMMON_IGROUPREPOSITORY_HPP
 #define COMMON_IGROUPREPOSITORY_HPP
 
+#include <cstdint>
 #include <expected>
+#include <span>
+#include <string>
 
 #include "domain/Group.hpp"
 #include "IRepository.hpp"
@@ -15,7 +18,10 @@ public:
     virtual std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> FindByTournamentId(const std::string_view& tournamentId) = 0;
     virtual std::expected<std::shared_ptr<domain::Group>, std::string> FindByTournamentIdAndGroupId(const std::string_view& tournamentId, const std::string_view& groupId) = 0;
     virtual std::expected<std::shared_ptr<domain::Group>, std::string> FindByTournamentIdAndTeamId(const std::string_view& tournamentId, const std::string_view& teamId) = 0;
+    virtual std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> FindGroupsContainingAnyTeam(const std::string_view& tournamentId, std::span<const std::string> teamIds) = 0;
     virtual std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> FindByTournamentIdAndConference(const std::string_view& tournamentId, const std::string_view& conference) = 0;
     virtual std::expected<void, std::string> UpdateGroupAddTeam(const std::string_view& groupId, const std::shared_ptr<domain::Team> & team) = 0;
+    // Versión de cambios de los grupos del torneo; "Tournament not found" si no existe
+    virtual std::expected<int64_t, std::string> ReadChangeVersion(const std::string_view& tournamentId) = 0;
 };
 #endif //COMMON_IGROUPREPOSITORY_HPP
\ No newline at end of file
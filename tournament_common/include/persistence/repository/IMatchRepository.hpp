@@ -10,6 +10,19 @@
 #include <memory>
 #include <expected>
 #include "domain/Match.hpp"
+#include "MatchQuery.hpp"
+
+// Error de Update cuando el match cambió desde que se leyó (Version() distinta a la de la base).
+// Quien llama vuelve a leer, reaplica su cambio y reintenta hasta MATCH_UPDATE_ATTEMPTS veces.
+inline constexpr std::string_view MATCH_VERSION_CONFLICT = "Match was modified concurrently";
+inline constexpr int MATCH_UPDATE_ATTEMPTS = 5;
+
+// Resultado de UpdateScore. Con written el match ya trae el marcador nuevo; sin él viene
+// como está guardado, para que quien llama vea qué regla impidió escribirlo.
+struct ScoreUpdate {
+    std::shared_ptr<domain::Match> match;
+    bool written = false;
+};
 
 class IMatchRepository {
 public:
@@ -17,9 +30,28 @@ public:
 
     virtual std::expected<std::string, std::string> Create(const domain::Match& match) = 0;
     virtual std::expected<std::shared_ptr<domain::Match>, std::string> ReadById(const std::string& id) = 0;
+    // Falla con MATCH_VERSION_CONFLICT si match.Version() ya no es la versión guardada
     virtual std::expected<std::string, std::string> Update(const std::string& id, const domain::Match& match) = 0;
     virtual std::expected<void, std::string> Delete(const std::string& id) = 0;
 
+    // Escribe solo el marcador, en un único UPDATE que exige que el match sea del torneo,
+    // tenga ambos equipos, no sea un playoff ya jugado y su ronda esté en validRounds.
+    // Si es el Super Bowl, el mismo statement marca el torneo como terminado.
+    virtual std::expected<ScoreUpdate, std::string> UpdateScore(const std::string& tournamentId,
+                                                                const std::string& matchId,
+                                                                const domain::Score& score,
+                                                                const std::vector<domain::RoundType>& validRounds) = 0;
+
+    // Inserta todos los matches en una sola transacción; los ids vienen en el mismo orden.
+    // Si un match ya trae Id() se usa ese id en lugar de generar uno.
+    virtual std::expected<std::vector<std::string>, std::string> CreateMany(const std::vector<domain::Match>& matches) = 0;
+
+    // Búsqueda general; los filtros de MatchQuery se resuelven en SQL
+    virtual std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>
+        Find(const MatchQuery& query) = 0;
+
+    virtual std::expected<size_t, std::string> Count(const MatchQuery& query) = 0;
+
     // Búsquedas específicas para matches
     virtual std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>
         FindByTournamentId(const std::string_view& tournamentId) = 0;
@@ -0,0 +1,23 @@
+//
+// Created by developer on 10/16/26.
+//
+
+#ifndef RESTAPI_IPAGEDREPOSITORY_HPP
+#define RESTAPI_IPAGEDREPOSITORY_HPP
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Paginación por llave, aparte de IRepository: solo la implementan los repositorios
+// que tienen un listado paginado (equipos y torneos).
+template<typename Type, typename Id>
+class IPagedRepository {
+public:
+    virtual ~IPagedRepository() = default;
+    // Hasta limit elementos ordenados por id, con id mayor que after
+    virtual std::expected<std::vector<std::shared_ptr<Type>>, std::string> ReadPage(const std::optional<Id>& after, size_t limit) = 0;
+};
+#endif //RESTAPI_IPAGEDREPOSITORY_HPP
@@ -7,6 +7,7 @@
 #include <vector>
 #include <memory>
 #include <expected>
+#include <string>
 
 template<typename Type, typename Id, typename expectedId>
 class IRepository {
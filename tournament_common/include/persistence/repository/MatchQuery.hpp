@@ -0,0 +1,54 @@
+#ifndef TOURNAMENTS_MATCHQUERY_HPP
+#define TOURNAMENTS_MATCHQUERY_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "domain/Match.hpp"
+
+// Filtros combinables para buscar matches. Cada combinación de filtros activos
+// corresponde a un prepared statement distinto en MatchRepository.
+class MatchQuery {
+    std::optional<std::string> tournamentId;
+    std::optional<domain::RoundType> round;
+    std::optional<bool> played;
+    std::optional<std::string> teamId;
+    std::optional<size_t> limit;
+
+public:
+    MatchQuery& WithTournament(std::string_view id) {
+        tournamentId = std::string(id);
+        return *this;
+    }
+
+    MatchQuery& WithRound(domain::RoundType roundType) {
+        round = roundType;
+        return *this;
+    }
+
+    MatchQuery& WithPlayed(bool isPlayed) {
+        played = isPlayed;
+        return *this;
+    }
+
+    // Matches donde el equipo juega como local o visitante
+    MatchQuery& WithTeam(std::string_view id) {
+        teamId = std::string(id);
+        return *this;
+    }
+
+    MatchQuery& WithLimit(size_t maxRows) {
+        limit = maxRows;
+        return *this;
+    }
+
+    [[nodiscard]] const std::optional<std::string>& Tournament() const { return tournamentId; }
+    [[nodiscard]] const std::optional<domain::RoundType>& Round() const { return round; }
+    [[nodiscard]] const std::optional<bool>& Played() const { return played; }
+    [[nodiscard]] const std::optional<std::string>& Team() const { return teamId; }
+    [[nodiscard]] const std::optional<size_t>& Limit() const { return limit; }
+};
+
+#endif //TOURNAMENTS_MATCHQUERY_HPP
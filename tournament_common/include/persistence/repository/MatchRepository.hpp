@@ -15,6 +15,16 @@ public:
     std::expected<std::shared_ptr<domain::Match>, std::string> ReadById(const std::string& id) override;
     std::expected<std::string, std::string> Update(const std::string& id, const domain::Match& match) override;
     std::expected<void, std::string> Delete(const std::string& id) override;
+    std::expected<ScoreUpdate, std::string> UpdateScore(const std::string& tournamentId,
+                                                        const std::string& matchId,
+                                                        const domain::Score& score,
+                                                        const std::vector<domain::RoundType>& validRounds) override;
+    std::expected<std::vector<std::string>, std::string> CreateMany(const std::vector<domain::Match>& matches) override;
+
+    std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>
+        Find(const MatchQuery& query) override;
+
+    std::expected<size_t, std::string> Count(const MatchQuery& query) override;
 
     std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>
         FindByTournamentId(const std::string_view& tournamentId) override;
@@ -0,0 +1,42 @@
+#ifndef TOURNAMENTS_MATCHSTORAGE_HPP
+#define TOURNAMENTS_MATCHSTORAGE_HPP
+
+#include <expected>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "IMatchRepository.hpp"
+#include "MatchQuery.hpp"
+#include "Projections.hpp"
+#include "StatementCatalog.hpp"
+#include "domain/Match.hpp"
+
+// Cómo se guarda un match en MATCHES. Lo comparten MatchRepository y AsyncMatchRepository;
+// el documento JSONB sale de domain::ToDocument (la ronda va como entero).
+
+// Prepared statement para la combinación de filtros de la consulta
+const Statement& MatchStatementFor(const MatchQuery& query, bool count);
+
+// Rondas como arreglo de Postgres en texto ("{0,3}"), el $5 de UPDATE_MATCH_SCORE
+std::string RoundsArray(const std::vector<domain::RoundType>& rounds);
+
+// Columnas que UPDATE_MATCH_SCORE agrega después de las de projection::MATCH_SELECT
+enum MatchScoreColumn : int {
+    MATCH_SCORE_WRITTEN = projection::MATCH_VERSION + 1,
+    MATCH_TOURNAMENT_FOUND
+};
+
+// Interpreta la fila de UPDATE_MATCH_SCORE; acepta filas de pqxx y de PgResult
+template<typename Row>
+std::expected<ScoreUpdate, std::string> ScoreUpdateFromRow(const Row& row) {
+    if (!row[MATCH_TOURNAMENT_FOUND].template as<bool>()) {
+        return std::unexpected("Tournament not found");
+    }
+    if (row[projection::MATCH_ID].is_null()) {
+        return std::unexpected("Match not found");
+    }
+    return ScoreUpdate{projection::MatchFromRow(row), row[MATCH_SCORE_WRITTEN].template as<bool>()};
+}
+
+#endif //TOURNAMENTS_MATCHSTORAGE_HPP
@@ -0,0 +1,158 @@
+#ifndef TOURNAMENTS_PROJECTIONS_HPP
+#define TOURNAMENTS_PROJECTIONS_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <pqxx/pqxx>
+
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Tournament.hpp"
+#include "domain/Utilities.hpp"
+
+// Proyecciones de columnas para las lecturas frecuentes. Postgres extrae los
+// campos del JSONB y cada fila se copia directo al objeto de dominio, sin
+// transferir el documento completo ni pasarlo por nlohmann::json::parse.
+// El orden de cada SELECT corresponde al enum de columnas que lo acompaña.
+// TournamentFromRow y MatchFromRow aceptan filas de pqxx y de PgResult.
+namespace projection {
+
+    inline constexpr const char* TOURNAMENT_SELECT = R"(
+        select id,
+               document->>'name' as name,
+               (document->>'year')::int as year,
+               document->>'finished' as finished,
+               (document->'format'->>'numberOfGroups')::int as number_of_groups,
+               (document->'format'->>'maxTeamsPerGroup')::int as max_teams_per_group,
+               (document->'format'->>'maxGroupsPerConference')::int as max_groups_per_conference,
+               document->'format'->>'type' as format_type
+        from TOURNAMENTS)";
+
+    enum TournamentColumn : int {
+        TOURNAMENT_ID, TOURNAMENT_NAME, TOURNAMENT_YEAR, TOURNAMENT_FINISHED,
+        TOURNAMENT_NUMBER_OF_GROUPS, TOURNAMENT_MAX_TEAMS_PER_GROUP,
+        TOURNAMENT_MAX_GROUPS_PER_CONFERENCE, TOURNAMENT_FORMAT_TYPE
+    };
+
+    // Versiones de cambios de un torneo (TOURNAMENT_CHANGES en db_script.sql); 0 si
+    // nunca cambió. Sin fila si el torneo no existe.
+    inline constexpr const char* TOURNAMENT_CHANGES_SELECT = R"(
+        select coalesce(c.groups_version, 0) as groups_version,
+               coalesce(c.matches_version, 0) as matches_version
+        from TOURNAMENTS t
+        left join TOURNAMENT_CHANGES c on c.tournament_id = t.id)";
+
+    enum TournamentChangesColumn : int {
+        CHANGES_GROUPS_VERSION, CHANGES_MATCHES_VERSION
+    };
+
+    // Una fila por equipo (o una sola con equipo nulo si el grupo está vacío);
+    // las consultas deben terminar con GROUP_ORDER para que las filas de un grupo queden juntas.
+    inline constexpr const char* GROUP_SELECT = R"(
+        select g.id,
+               g.tournament_id,
+               g.document->>'name' as name,
+               g.document->>'region' as region,
+               g.document->>'conference' as conference,
+               t.team->>'id' as team_id,
+               t.team->>'name' as team_name
+        from GROUPS g
+        left join lateral jsonb_array_elements(g.document->'teams') with ordinality as t(team, ord) on true)";
+
+    inline constexpr const char* GROUP_ORDER = " order by g.created_at, g.id, t.ord";
+
+    enum GroupColumn : int {
+        GROUP_ID, GROUP_TOURNAMENT_ID, GROUP_NAME, GROUP_REGION, GROUP_CONFERENCE,
+        GROUP_TEAM_ID, GROUP_TEAM_NAME
+    };
+
+    // tournament_id y round salen de las columnas generadas de MATCHES
+    inline constexpr const char* MATCH_SELECT = R"(
+        select id,
+               tournament_id,
+               round,
+               document->'home'->>'id' as home_id,
+               document->'home'->>'name' as home_name,
+               document->'visitor'->>'id' as visitor_id,
+               document->'visitor'->>'name' as visitor_name,
+               (document->'score'->>'home')::int as home_score,
+               (document->'score'->>'visitor')::int as visitor_score,
+               document->>'winnerNextMatchId' as winner_next_match_id,
+               version
+        from MATCHES)";
+
+    enum MatchColumn : int {
+        MATCH_ID, MATCH_TOURNAMENT_ID, MATCH_ROUND, MATCH_HOME_ID, MATCH_HOME_NAME,
+        MATCH_VISITOR_ID, MATCH_VISITOR_NAME, MATCH_HOME_SCORE, MATCH_VISITOR_SCORE,
+        MATCH_WINNER_NEXT_MATCH_ID, MATCH_VERSION
+    };
+
+    template<typename Row>
+    std::shared_ptr<domain::Tournament> TournamentFromRow(const Row& row) {
+        auto tournament = std::make_shared<domain::Tournament>();
+        tournament->Id() = row[TOURNAMENT_ID].template as<std::string>();
+        tournament->Name() = row[TOURNAMENT_NAME].template as<std::string>();
+        tournament->Year() = row[TOURNAMENT_YEAR].template as<int>();
+        tournament->Finished() = row[TOURNAMENT_FINISHED].template as<std::string>();
+
+        auto& format = tournament->Format();
+        if (!row[TOURNAMENT_NUMBER_OF_GROUPS].is_null()) {
+            format.NumberOfGroups() = row[TOURNAMENT_NUMBER_OF_GROUPS].template as<int>();
+        }
+        if (!row[TOURNAMENT_MAX_TEAMS_PER_GROUP].is_null()) {
+            format.MaxTeamsPerGroup() = row[TOURNAMENT_MAX_TEAMS_PER_GROUP].template as<int>();
+        }
+        if (!row[TOURNAMENT_MAX_GROUPS_PER_CONFERENCE].is_null()) {
+            format.MaxGroupsPerConference() = row[TOURNAMENT_MAX_GROUPS_PER_CONFERENCE].template as<int>();
+        }
+        if (!row[TOURNAMENT_FORMAT_TYPE].is_null()) {
+            format.Type() = domain::TOURNAMENT_TYPE_NAMES.Decode(row[TOURNAMENT_FORMAT_TYPE].template as<std::string>());
+        }
+        return tournament;
+    }
+
+    inline std::vector<std::shared_ptr<domain::Group>> GroupsFromResult(const pqxx::result& result) {
+        std::vector<std::shared_ptr<domain::Group>> groups;
+        for (const auto& row : result) {
+            const auto id = row[GROUP_ID].as<std::string>();
+            if (groups.empty() || groups.back()->Id() != id) {
+                auto group = std::make_shared<domain::Group>(
+                    row[GROUP_NAME].as<std::string>(),
+                    row[GROUP_REGION].as<std::string>(),
+                    id,
+                    domain::CONFERENCE_NAMES.Decode(row[GROUP_CONFERENCE].as<std::string>()));
+                group->TournamentId() = row[GROUP_TOURNAMENT_ID].as<std::string>();
+                groups.push_back(group);
+            }
+            if (!row[GROUP_TEAM_ID].is_null()) {
+                groups.back()->Teams().push_back(domain::Team{
+                    row[GROUP_TEAM_ID].as<std::string>(),
+                    row[GROUP_TEAM_NAME].is_null() ? std::string{} : row[GROUP_TEAM_NAME].as<std::string>()
+                });
+            }
+        }
+        return groups;
+    }
+
+    template<typename Row>
+    std::shared_ptr<domain::Match> MatchFromRow(const Row& row) {
+        auto match = std::make_shared<domain::Match>();
+        match->Id() = row[MATCH_ID].template as<std::string>();
+        match->TournamentId() = row[MATCH_TOURNAMENT_ID].template as<std::string>();
+        match->Round() = domain::ROUND_NUMBERS.Decode(row[MATCH_ROUND].template as<int>());
+        match->getHome() = domain::Home{row[MATCH_HOME_ID].template as<std::string>(), row[MATCH_HOME_NAME].template as<std::string>()};
+        match->getVisitor() = domain::Visitor{row[MATCH_VISITOR_ID].template as<std::string>(), row[MATCH_VISITOR_NAME].template as<std::string>()};
+
+        if (!row[MATCH_HOME_SCORE].is_null()) {
+            match->MatchScore() = domain::Score{row[MATCH_HOME_SCORE].template as<int>(), row[MATCH_VISITOR_SCORE].template as<int>()};
+        }
+        if (!row[MATCH_WINNER_NEXT_MATCH_ID].is_null()) {
+            match->WinnerNextMatchId() = row[MATCH_WINNER_NEXT_MATCH_ID].template as<std::string>();
+        }
+        match->Version() = row[MATCH_VERSION].template as<int>();
+        return match;
+    }
+}
+
+#endif //TOURNAMENTS_PROJECTIONS_HPP
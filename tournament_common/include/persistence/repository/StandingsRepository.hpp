@@ -0,0 +1,166 @@
+#ifndef TOURNAMENTS_STANDINGSREPOSITORY_HPP
+#define TOURNAMENTS_STANDINGSREPOSITORY_HPP
+
+#include <expected>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "domain/Standing.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/ReadTransaction.hpp"
+#include "persistence/configuration/UnitOfWork.hpp"
+#include "persistence/repository/StatementCatalog.hpp"
+
+// Tabla de posiciones (STANDINGS) y el registro de lo que ya contó de cada match
+// (STANDINGS_APPLIED). LockAppliedResult, ReadMatchResult y Apply están pensados para
+// correr juntos dentro de un UnitOfWork.
+class StandingsRepository {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+
+    template<typename Row>
+    static std::optional<domain::MatchResult> MatchResultFromRow(const Row& row) {
+        if (row["home_score"].is_null()) {
+            return std::nullopt;
+        }
+        return domain::MatchResult{
+            row["tournament_id"].template as<std::string>(),
+            row["home_id"].template as<std::string>(),
+            row["visitor_id"].template as<std::string>(),
+            domain::Score{row["home_score"].template as<int>(), row["visitor_score"].template as<int>()}
+        };
+    }
+
+public:
+    explicit StandingsRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
+    virtual ~StandingsRepository() = default;
+
+    virtual std::expected<std::vector<domain::Standing>, std::string> FindByTournamentId(const std::string_view& tournamentId) {
+        try {
+            const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+                return ExecPrepared(pooled, tx, statements::SELECT_STANDINGS_BY_TOURNAMENT, pqxx::params{tournamentId.data()});
+            });
+
+            std::vector<domain::Standing> standings;
+            standings.reserve(result.size());
+            for (const auto& row : result) {
+                standings.push_back(domain::Standing{
+                    row["team_id"].as<std::string>(),
+                    row["team_name"].is_null() ? std::string{} : row["team_name"].as<std::string>(),
+                    row["group_id"].as<std::string>(),
+                    row["division"].as<std::string>(),
+                    row["conference"].as<std::string>(),
+                    row["wins"].as<int>(),
+                    row["losses"].as<int>(),
+                    row["ties"].as<int>(),
+                    row["points_for"].as<int>(),
+                    row["points_against"].as<int>()
+                });
+            }
+            return standings;
+        } catch (const pqxx::sql_error& e) {
+            std::cerr << "SQL error: " << e.what() << std::endl;
+            std::cerr << "Query was: " << e.query() << std::endl;
+
+            return std::unexpected(std::format("SQL error: {}", e.what()));
+        } catch (const std::exception& e) {
+            std::cerr << "Unexpected error: " << e.what() << std::endl;
+
+            return std::unexpected(std::format("Database error: {}", e.what()));
+        }
+    }
+
+    // Lo que la tabla ya contó del match (nullopt si nada). Deja el registro bloqueado
+    // hasta el fin de la transacción, así dos eventos del mismo match no se cruzan.
+    virtual std::expected<std::optional<domain::MatchResult>, std::string> LockAppliedResult(const std::string_view& matchId) {
+        try {
+            const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+                return ExecPrepared(pooled, tx, statements::LOCK_STANDINGS_APPLIED, pqxx::params{matchId.data()});
+            });
+
+            return MatchResultFromRow(result[0]);
+        } catch (const pqxx::sql_error& e) {
+            std::cerr << "SQL error: " << e.what() << std::endl;
+            std::cerr << "Query was: " << e.query() << std::endl;
+
+            return std::unexpected(std::format("SQL error: {}", e.what()));
+        } catch (const std::exception& e) {
+            std::cerr << "Unexpected error: " << e.what() << std::endl;
+
+            return std::unexpected(std::format("Database error: {}", e.what()));
+        }
+    }
+
+    // El marcador actual si el match es de fase regular y ya se jugó; si no, nullopt
+    virtual std::expected<std::optional<domain::MatchResult>, std::string> ReadMatchResult(const std::string_view& matchId) {
+        try {
+            const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+                return ExecPrepared(pooled, tx, statements::SELECT_MATCH_RESULT, pqxx::params{matchId.data()});
+            });
+
+            if (result.empty()) {
+                return std::optional<domain::MatchResult>{};
+            }
+            return MatchResultFromRow(result[0]);
+        } catch (const pqxx::sql_error& e) {
+            std::cerr << "SQL error: " << e.what() << std::endl;
+            std::cerr << "Query was: " << e.query() << std::endl;
+
+            return std::unexpected(std::format("SQL error: {}", e.what()));
+        } catch (const std::exception& e) {
+            std::cerr << "Unexpected error: " << e.what() << std::endl;
+
+            return std::unexpected(std::format("Database error: {}", e.what()));
+        }
+    }
+
+    // Suma los cambios a las filas del torneo y deja result como lo contado del match
+    virtual std::expected<void, std::string> Apply(const std::string_view& matchId,
+                                                   const std::string_view& tournamentId,
+                                                   const std::vector<domain::StandingChange>& changes,
+                                                   const std::optional<domain::MatchResult>& result) {
+        nlohmann::json rows = nlohmann::json::array();
+        for (const auto& change : changes) {
+            rows.push_back({
+                {"team_id", change.teamId},
+                {"wins", change.wins},
+                {"losses", change.losses},
+                {"ties", change.ties},
+                {"points_for", change.pointsFor},
+                {"points_against", change.pointsAgainst}
+            });
+        }
+
+        try {
+            ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+                if (!changes.empty()) {
+                    ExecPrepared(pooled, tx, statements::APPLY_STANDING_CHANGES, pqxx::params{tournamentId.data(), rows.dump()});
+                }
+                if (result) {
+                    return ExecPrepared(pooled, tx, statements::UPDATE_STANDINGS_APPLIED,
+                        pqxx::params{matchId.data(), result->tournamentId, result->homeId, result->visitorId,
+                                     result->score.homeTeamScore, result->score.visitorTeamScore});
+                }
+                return ExecPrepared(pooled, tx, statements::CLEAR_STANDINGS_APPLIED, pqxx::params{matchId.data()});
+            });
+
+            return {};
+        } catch (const pqxx::sql_error& e) {
+            std::cerr << "SQL error: " << e.what() << std::endl;
+            std::cerr << "Query was: " << e.query() << std::endl;
+
+            return std::unexpected(std::format("SQL error: {}", e.what()));
+        } catch (const std::exception& e) {
+            std::cerr << "Unexpected error: " << e.what() << std::endl;
+
+            return std::unexpected(std::format("Database error: {}", e.what()));
+        }
+    }
+};
+
+#endif //TOURNAMENTS_STANDINGSREPOSITORY_HPP
@@ -0,0 +1,283 @@
+#ifndef TOURNAMENTS_STATEMENTCATALOG_HPP
+#define TOURNAMENTS_STATEMENTCATALOG_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <pqxx/pqxx>
+
+#include "Projections.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/StatementMetrics.hpp"
+
+// Nombre y SQL de un prepared statement
+struct Statement {
+    std::string name;
+    std::string sql;
+};
+
+// Catálogo de los statements que usan los repositorios. Ninguno se prepara al abrir
+// la conexión: ExecPrepared lo prepara la primera vez que esa conexión física lo
+// ejecuta, así el pool abre sus conexiones sin esperar a Postgres por cada statement.
+namespace statements {
+
+    inline const Statement INSERT_TOURNAMENT{"insert_tournament",
+        "insert into TOURNAMENTS (document) values($1) RETURNING id"};
+    inline const Statement SELECT_TOURNAMENT_BY_ID{"select_tournament_by_id",
+        std::string(projection::TOURNAMENT_SELECT) + " where id = $1"};
+    inline const Statement SELECT_TOURNAMENTS_PAGE{"select_tournaments_page",
+        std::string(projection::TOURNAMENT_SELECT) + " order by id limit $1"};
+    inline const Statement SELECT_TOURNAMENTS_PAGE_AFTER{"select_tournaments_page_after",
+        std::string(projection::TOURNAMENT_SELECT) + " where id > $1 order by id limit $2"};
+    inline const Statement UPDATE_TOURNAMENT_BY_ID{"update_tournament_by_id",
+        "update TOURNAMENTS set document = $2 where id = $1 RETURNING id"};
+    inline const Statement DELETE_TOURNAMENT_BY_ID{"delete_tournament_by_id",
+        "delete from TOURNAMENTS where id = $1"};
+    inline const Statement SELECT_TOURNAMENT_CHANGES{"select_tournament_changes",
+        std::string(projection::TOURNAMENT_CHANGES_SELECT) + " where t.id = $1"};
+
+    inline const Statement INSERT_TEAM{"insert_team",
+        "insert into TEAMS (document) values($1) RETURNING id"};
+    inline const Statement SELECT_TEAM_BY_ID{"select_team_by_id",
+        "select id, document->>'name' as name from TEAMS where id = $1"};
+    // $1 es un arreglo de ids (ArrayLiteral); los ids que no existen simplemente no regresan
+    inline const Statement SELECT_TEAMS_BY_IDS{"select_teams_by_ids",
+        "select id, document->>'name' as name from TEAMS where id = any($1::uuid[])"};
+    inline const Statement SELECT_TEAMS_PAGE{"select_teams_page",
+        "select id, document->>'name' as name from TEAMS order by id limit $1"};
+    inline const Statement SELECT_TEAMS_PAGE_AFTER{"select_teams_page_after",
+        "select id, document->>'name' as name from TEAMS where id > $1 order by id limit $2"};
+    inline const Statement UPDATE_TEAM_BY_ID{"update_team_by_id",
+        "update TEAMS set document = $2 where id = $1 RETURNING id"};
+    inline const Statement DELETE_TEAM_BY_ID{"delete_team_by_id",
+        "delete from TEAMS where id = $1"};
+
+    inline const Statement INSERT_GROUP{"insert_group",
+        "insert into GROUPS (tournament_id, document) values($1, $2) RETURNING id"};
+    inline const Statement SELECT_GROUP_BY_TOURNAMENTID_GROUPID{"select_group_by_tournamentid_groupid",
+        std::string(projection::GROUP_SELECT) + " where g.tournament_id = $1 and g.id = $2" + projection::GROUP_ORDER};
+    inline const Statement SELECT_GROUPS_BY_TOURNAMENT{"select_groups_by_tournament",
+        std::string(projection::GROUP_SELECT) + " where g.tournament_id = $1" + projection::GROUP_ORDER};
+    inline const Statement SELECT_GROUPS_BY_TOURNAMENT_CONFERENCE{"select_groups_by_tournament_conference",
+        std::string(projection::GROUP_SELECT) + " where g.tournament_id = $1 and g.document->>'conference' = $2" + projection::GROUP_ORDER};
+    inline const Statement SELECT_GROUP_IN_TOURNAMENT{"select_group_in_tournament",
+        std::string(projection::GROUP_SELECT) + R"(
+            where g.id = (
+                select id from GROUPS
+                where tournament_id = $1
+                and document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', $2::text)))
+                limit 1
+            ))" + projection::GROUP_ORDER};
+    // Grupos del torneo $1 que ya tienen alguno de los equipos de $2 (text[], ids en minúsculas);
+    // lower() porque los grupos guardan los ids tal como llegaron en la petición
+    inline const Statement SELECT_GROUPS_CONTAINING_ANY_TEAM{"select_groups_containing_any_team",
+        std::string(projection::GROUP_SELECT) + R"(
+            where g.id in (
+                select id from GROUPS
+                where tournament_id = $1
+                and exists (
+                    select 1 from jsonb_array_elements(document->'teams') as member
+                    where lower(member->>'id') = any($2::text[])
+                )
+            ))" + projection::GROUP_ORDER};
+    inline const Statement UPDATE_GROUP_BY_ID{"update_group_by_id",
+        "update GROUPS set tournament_id = $1, document = $2 where id = $3 RETURNING id"};
+    inline const Statement DELETE_GROUP_BY_ID{"delete_group_by_id",
+        "delete from GROUPS where id = $1"};
+    inline const Statement UPDATE_GROUP_ADD_TEAM{"update_group_add_team", R"(
+            update GROUPS
+                set document = jsonb_insert(document, '{teams,-1}', $2),
+                    last_update_date = CURRENT_TIMESTAMP
+                where id = $1
+            RETURNING id
+        )"};
+
+    inline const Statement INSERT_MATCH{"insert_match",
+        "insert into MATCHES (document) values($1) RETURNING id"};
+    // Los elementos son {"id"?, "document"}. Los ids que faltan se generan en un CTE
+    // materializado para devolver todos los ids en el orden de entrada.
+    inline const Statement INSERT_MATCHES{"insert_matches", R"(
+            with input as (
+                select coalesce((elem->>'id')::uuid, uuid_generate_v4()) as id, elem->'document' as doc, ord
+                from jsonb_array_elements($1::jsonb) with ordinality as t(elem, ord)
+            ), inserted as (
+                insert into MATCHES (id, document) select id, doc from input
+            )
+            select id from input order by ord
+        )"};
+    inline const Statement SELECT_MATCH_BY_ID{"select_match_by_id",
+        std::string(projection::MATCH_SELECT) + " where id = $1"};
+    // Update con control optimista: $1 id, $2 documento, $3 versión leída. Solo escribe si
+    // la versión no cambió y siempre devuelve la fila del match si existe, con updated = false
+    // cuando otra escritura ganó. Sin filas significa que el match no existe.
+    inline const Statement UPDATE_MATCH_BY_ID{"update_match_by_id", R"(
+            with updated as (
+                update MATCHES
+                    set document = $2,
+                        version = version + 1,
+                        last_update_date = CURRENT_TIMESTAMP
+                    where id = $1 and version = $3
+                RETURNING id
+            )
+            select m.id, exists(select 1 from updated) as updated
+            from MATCHES m
+            where m.id = $1
+        )"};
+    // Escribe solo el marcador: $1 match, $2 torneo, $3 y $4 puntos, $5 rondas (smallint[]) en
+    // las que el marcador es válido. Las reglas del delegate van en el WHERE; si el match es
+    // el Super Bowl el mismo statement cierra el torneo. Devuelve siempre una fila: las
+    // columnas de projection::MATCH_SELECT (ya con el marcador, o como estaban si no se
+    // escribió; nulas si el match no existe), score_written y tournament_found.
+    inline const Statement UPDATE_MATCH_SCORE{"update_match_score", std::string(R"(
+            with updated as (
+                update MATCHES
+                    set document = jsonb_set(document, '{score}', jsonb_build_object('home', $3::int, 'visitor', $4::int)),
+                        version = version + 1,
+                        last_update_date = CURRENT_TIMESTAMP
+                    where id = $1
+                      and tournament_id = $2
+                      and exists (select 1 from TOURNAMENTS where id = $2)
+                      and coalesce(document->'home'->>'id', '') <> ''
+                      and coalesce(document->'visitor'->>'id', '') <> ''
+                      and (round = 0 or not played) -- 0 = RoundType::REGULAR
+                      and round = any($5::smallint[])
+                RETURNING id,
+                          tournament_id,
+                          round,
+                          document->'home'->>'id' as home_id,
+                          document->'home'->>'name' as home_name,
+                          document->'visitor'->>'id' as visitor_id,
+                          document->'visitor'->>'name' as visitor_name,
+                          (document->'score'->>'home')::int as home_score,
+                          (document->'score'->>'visitor')::int as visitor_score,
+                          document->>'winnerNextMatchId' as winner_next_match_id,
+                          version
+            ), finished as (
+                update TOURNAMENTS
+                    set document = jsonb_set(document, '{finished}', '"yes"'),
+                        last_update_date = CURRENT_TIMESTAMP
+                    where id = $2
+                      and exists (select 1 from updated where round = 4) -- 4 = RoundType::SUPERBOWL
+            )
+            select r.*, t.found as tournament_found
+            from (select exists (select 1 from TOURNAMENTS where id = $2) as found) t
+            left join (
+                select u.*, true as score_written from updated u
+                union all
+                select m.*, false from ()") + projection::MATCH_SELECT + R"( where id = $1) m
+                where not exists (select 1 from updated)
+            ) r on true
+        )"};
+
+    // Tabla de posiciones de un torneo: una fila por equipo de sus grupos, en cero si aún no
+    // juega, en el orden de NFLStrategy::TabulateTeams (porcentaje de victorias, puntos a
+    // favor, diferencia).
+    inline const Statement SELECT_STANDINGS_BY_TOURNAMENT{"select_standings_by_tournament", R"(
+            select t.team->>'id' as team_id,
+                   t.team->>'name' as team_name,
+                   g.id as group_id,
+                   g.document->>'name' as division,
+                   g.document->>'conference' as conference,
+                   coalesce(s.wins, 0) as wins,
+                   coalesce(s.losses, 0) as losses,
+                   coalesce(s.ties, 0) as ties,
+                   coalesce(s.points_for, 0) as points_for,
+                   coalesce(s.points_against, 0) as points_against
+            from GROUPS g
+            cross join lateral jsonb_array_elements(g.document->'teams') as t(team)
+            left join STANDINGS s on s.tournament_id = g.tournament_id and s.team_id = (t.team->>'id')::uuid
+            where g.tournament_id = $1
+            order by coalesce((s.wins + 0.5 * s.ties) / nullif(s.wins + s.losses + s.ties, 0), 0) desc,
+                     coalesce(s.points_for, 0) desc,
+                     coalesce(s.points_for - s.points_against, 0) desc,
+                     team_name
+        )"};
+    // Crea o bloquea el registro de lo que la tabla ya contó del match ($1) y lo devuelve;
+    // el lock dura hasta el fin de la transacción y ordena los eventos del mismo match.
+    inline const Statement LOCK_STANDINGS_APPLIED{"lock_standings_applied", R"(
+            insert into STANDINGS_APPLIED (match_id) values ($1)
+            on conflict (match_id) do update set match_id = excluded.match_id
+            RETURNING tournament_id, home_id, visitor_id, home_score, visitor_score
+        )"};
+    // El marcador del match ($1) si es de fase regular, ya se jugó y tiene ambos equipos
+    inline const Statement SELECT_MATCH_RESULT{"select_match_result", R"(
+            select tournament_id,
+                   document->'home'->>'id' as home_id,
+                   document->'visitor'->>'id' as visitor_id,
+                   (document->'score'->>'home')::int as home_score,
+                   (document->'score'->>'visitor')::int as visitor_score
+            from MATCHES
+            where id = $1
+              and round = 0 -- 0 = RoundType::REGULAR
+              and played
+              and coalesce(document->'home'->>'id', '') <> ''
+              and coalesce(document->'visitor'->>'id', '') <> ''
+        )"};
+    // $1 torneo, $2 arreglo JSON de cambios por equipo; se suman a lo que ya tenga cada fila
+    inline const Statement APPLY_STANDING_CHANGES{"apply_standing_changes", R"(
+            insert into STANDINGS as s (tournament_id, team_id, wins, losses, ties, points_for, points_against)
+            select $1::uuid, c.team_id, c.wins, c.losses, c.ties, c.points_for, c.points_against
+            from jsonb_to_recordset($2::jsonb)
+                as c(team_id uuid, wins int, losses int, ties int, points_for int, points_against int)
+            on conflict (tournament_id, team_id) do update
+                set wins = s.wins + excluded.wins,
+                    losses = s.losses + excluded.losses,
+                    ties = s.ties + excluded.ties,
+                    points_for = s.points_for + excluded.points_for,
+                    points_against = s.points_against + excluded.points_against
+        )"};
+    inline const Statement UPDATE_STANDINGS_APPLIED{"update_standings_applied", R"(
+            update STANDINGS_APPLIED
+                set tournament_id = $2, home_id = $3, visitor_id = $4, home_score = $5, visitor_score = $6
+                where match_id = $1
+        )"};
+    inline const Statement CLEAR_STANDINGS_APPLIED{"clear_standings_applied", R"(
+            update STANDINGS_APPLIED
+                set tournament_id = null, home_id = null, visitor_id = null, home_score = null, visitor_score = null
+                where match_id = $1
+        )"};
+}
+
+// Arreglo de Postgres en formato texto ({"a","b"}) para pasar una lista como un solo parámetro
+inline std::string ArrayLiteral(std::span<const std::string> values) {
+    std::string array = "{";
+    for (const auto& value : values) {
+        if (array.size() > 1) {
+            array += ',';
+        }
+        array += '"';
+        for (const char c : value) {
+            if (c == '"' || c == '\\') {
+                array += '\\';
+            }
+            array += c;
+        }
+        array += '"';
+    }
+    return array + "}";
+}
+
+// tx.exec(pqxx::prepped{statement.name}, args...) preparando el statement en la conexión
+// la primera vez que la usa, y registrado en StatementMetrics bajo su nombre.
+template<typename... Args>
+pqxx::result ExecPrepared(PooledConnection& pooled, pqxx::transaction_base& tx, const Statement& statement, Args&&... args) {
+    const auto started = std::chrono::steady_clock::now();
+    const auto elapsed = [&started] {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started);
+    };
+    try {
+        pooled.PrepareOnce(statement.name, [&statement](pqxx::connection& connection) {
+            connection.prepare(statement.name, statement.sql);
+        });
+        pqxx::result result = tx.exec(pqxx::prepped{statement.name}, std::forward<Args>(args)...);
+        StatementMetrics::Global()->Record(statement.name, elapsed(), static_cast<uint64_t>(result.affected_rows()), false);
+        return result;
+    } catch (...) {
+        StatementMetrics::Global()->Record(statement.name, elapsed(), 0, true);
+        throw;
+    }
+}
+
+#endif //TOURNAMENTS_STATEMENTCATALOG_HPP
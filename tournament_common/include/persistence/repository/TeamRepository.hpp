@@ -6,35 +6,39 @@
 #define RESTAPI_TEAMREPOSITORY_HPP
 #include <string>
 #include <memory>
+#include <optional>
+#include <span>
+#include <vector>
 #include <iostream>
 #include <format>
 #include <nlohmann/json.hpp>
 
 
 #include "persistence/configuration/IDbConnectionProvider.hpp"
-#include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/ReadTransaction.hpp"
+#include "persistence/configuration/UnitOfWork.hpp"
+#include "persistence/repository/StatementCatalog.hpp"
+#include "IPagedRepository.hpp"
 #include "IRepository.hpp"
 #include "domain/Team.hpp"
 #include "domain/Utilities.hpp"
 
 
-class TeamRepository : public IRepository<domain::Team, std::string, std::expected<std::string, std::string>> {
+class TeamRepository : public IRepository<domain::Team, std::string, std::expected<std::string, std::string>>,
+                       public IPagedRepository<domain::Team, std::string> {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
 public:
 
     explicit TeamRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider) : connectionProvider(std::move(connectionProvider)){}
 
     std::expected<std::string, std::string> Create(const domain::Team &entity) override {
-        const nlohmann::json teamBody = entity;
-
-        auto pooled = connectionProvider->Connection();
-        const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-        pqxx::work tx(*(connection->connection));
+        const nlohmann::json teamBody = domain::ToDocument(entity);
 
         try {
-            const pqxx::result result = tx.exec(pqxx::prepped{"insert_team"}, teamBody.dump());
+            const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+                return ExecPrepared(pooled, tx, statements::INSERT_TEAM, teamBody.dump());
+            });
 
-            tx.commit();
             return result[0]["id"].as<std::string>();
         } catch (const pqxx::sql_error &e) {
             std::cerr << "SQL error: " << e.what() << std::endl;
@@ -51,12 +55,10 @@ public:
     std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string> ReadAll() override {
         std::vector<std::shared_ptr<domain::Team>> teams;
 
-        auto pooled = connectionProvider->Connection();
-        const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-        pqxx::work tx(*(connection->connection));
-
         try {
-            const pqxx::result result{tx.exec("select id, document->>'name' as name from teams")};
+            const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection&, pqxx::transaction_base& tx) {
+                return tx.exec("select id, document->>'name' as name from teams");
+            });
 
             for(const auto& row : result){
                 teams.push_back(std::make_shared<domain::Team>(
@@ -64,7 +66,6 @@ public:
                 ));
             }
 
-            tx.commit();
             return teams;
         } catch (const pqxx::sql_error &e) {
             std::cerr << "SQL error: " << e.what() << std::endl;
@@ -78,24 +79,51 @@ public:
         }
     }
 
-    std::expected<std::shared_ptr<domain::Team>, std::string> ReadById(std::string id) override {
-        auto pooled = connectionProvider->Connection();
-        const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-        pqxx::work tx(*(connection->connection));
+    std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string> ReadPage(const std::optional<std::string>& after, size_t limit) override {
+        std::vector<std::shared_ptr<domain::Team>> teams;
 
         try {
-            const pqxx::result result = tx.exec(pqxx::prepped{"select_team_by_id"}, id);
+            const auto pageSize = static_cast<long long>(limit);
+            const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+                return after
+                    ? ExecPrepared(pooled, tx, statements::SELECT_TEAMS_PAGE_AFTER, pqxx::params{*after, pageSize})
+                    : ExecPrepared(pooled, tx, statements::SELECT_TEAMS_PAGE, pqxx::params{pageSize});
+            });
+
+            teams.reserve(result.size());
+            for(const auto& row : result){
+                teams.push_back(std::make_shared<domain::Team>(
+                    domain::Team{row["id"].as<std::string>(), row["name"].as<std::string>()}
+                ));
+            }
+
+            return teams;
+        } catch (const pqxx::sql_error &e) {
+            std::cerr << "SQL error: " << e.what() << std::endl;
+            std::cerr << "Query was: " << e.query() << std::endl;
+
+            return std::unexpected(std::format("SQL error: {}", e.what()));
+        } catch (const std::exception &e) {
+            std::cerr << "Unexpected error: " << e.what() << std::endl;
+
+            return std::unexpected(std::format("Database error: {}", e.what()));
+        }
+    }
+
+    std::expected<std::shared_ptr<domain::Team>, std::string> ReadById(std::string id) override {
+        try {
+            const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+                return ExecPrepared(pooled, tx, statements::SELECT_TEAM_BY_ID, id);
+            });
 
             if (result.empty()) {
                 return std::unexpected("Team not found");
             }
 
             auto team = std::make_shared<domain::Team>(
-                nlohmann::json::parse(result.at(0)["document"].as<std::string>())
+                domain::Team{result.at(0)["id"].as<std::string>(), result.at(0)["name"].as<std::string>()}
             );
-            team->Id = result.at(0)["id"].as<std::string>();
 
-            tx.commit();
             return team;
         } catch (const pqxx::sql_error &e) {
             std::cerr << "SQL error: " << e.what() << std::endl;
@@ -109,21 +137,47 @@ public:
         }
     }
 
-    std::expected<std::string, std::string> Update(std::string id, const domain::Team & entity) override {
-        const nlohmann::json teamDoc = entity;
+    // Los equipos de ids que existen, en una sola consulta; el que llama decide qué hacer con los que faltan
+    virtual std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string> ReadByIds(std::span<const std::string> ids) {
+        std::vector<std::shared_ptr<domain::Team>> teams;
 
-        auto pooled = connectionProvider->Connection();
-        const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-        pqxx::work tx(*(connection->connection));
+        try {
+            const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+                return ExecPrepared(pooled, tx, statements::SELECT_TEAMS_BY_IDS, ArrayLiteral(ids));
+            });
+
+            teams.reserve(result.size());
+            for(const auto& row : result){
+                teams.push_back(std::make_shared<domain::Team>(
+                    domain::Team{row["id"].as<std::string>(), row["name"].as<std::string>()}
+                ));
+            }
+
+            return teams;
+        } catch (const pqxx::sql_error &e) {
+            std::cerr << "SQL error: " << e.what() << std::endl;
+            std::cerr << "Query was: " << e.query() << std::endl;
+
+            return std::unexpected(std::format("SQL error: {}", e.what()));
+        } catch (const std::exception &e) {
+            std::cerr << "Unexpected error: " << e.what() << std::endl;
+
+            return std::unexpected(std::format("Database error: {}", e.what()));
+        }
+    }
+
+    std::expected<std::string, std::string> Update(std::string id, const domain::Team & entity) override {
+        const nlohmann::json teamDoc = domain::ToDocument(entity);
 
         try {
-            const pqxx::result result = tx.exec(pqxx::prepped{"update_team_by_id"}, pqxx::params{id, teamDoc.dump()});
+            const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+                return ExecPrepared(pooled, tx, statements::UPDATE_TEAM_BY_ID, pqxx::params{id, teamDoc.dump()});
+            });
 
             if (result.affected_rows() == 0) {
                 return std::unexpected("Team not found");
             }
 
-            tx.commit();
             return result[0]["id"].as<std::string>();
         } catch (const pqxx::sql_error &e) {
             std::cerr << "SQL error: " << e.what() << std::endl;
@@ -138,18 +192,15 @@ public:
     }
 
     std::expected<void, std::string> Delete(std::string id) override{
-        auto pooled = connectionProvider->Connection();
-        const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-        pqxx::work tx(*(connection->connection));
-
         try {
-            auto result = tx.exec(pqxx::prepped{"delete_team_by_id"}, id);
+            const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+                return ExecPrepared(pooled, tx, statements::DELETE_TEAM_BY_ID, id);
+            });
 
             if (result.affected_rows() == 0) {
                 return std::unexpected("Team not found");
             }
 
-            tx.commit();
             return {};
         } catch (const pqxx::sql_error &e) {
             std::cerr << "SQL error: " << e.what() << std::endl;
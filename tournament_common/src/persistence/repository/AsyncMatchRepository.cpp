@@ -0,0 +1,122 @@
+//
+// Created by developer on 10/15/26.
+//
+
+#include <format>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include "persistence/repository/AsyncMatchRepository.hpp"
+#include "persistence/repository/IMatchRepository.hpp"
+#include "persistence/repository/MatchStorage.hpp"
+#include "persistence/repository/Projections.hpp"
+#include "persistence/repository/StatementCatalog.hpp"
+
+namespace {
+    // Mismo orden de parámetros que el statement de MatchStatementFor, en formato texto
+    std::vector<std::optional<std::string>> TextParamsFor(const MatchQuery& query) {
+        std::vector<std::optional<std::string>> params;
+        if (query.Tournament()) {
+            params.emplace_back(*query.Tournament());
+        }
+        if (query.Round()) {
+            params.emplace_back(std::to_string(static_cast<int>(*query.Round())));
+        }
+        if (query.Played()) {
+            params.emplace_back(*query.Played() ? "true" : "false");
+        }
+        if (query.Team()) {
+            params.emplace_back(*query.Team());
+        }
+        if (query.Limit()) {
+            params.emplace_back(std::to_string(*query.Limit()));
+        }
+        return params;
+    }
+}
+
+AsyncMatchRepository::AsyncMatchRepository(std::shared_ptr<AsyncConnectionProvider> connectionProvider)
+    : connectionProvider(std::move(connectionProvider)) {}
+
+asio::awaitable<std::expected<ScoreUpdate, std::string>>
+AsyncMatchRepository::UpdateScore(std::string tournamentId, std::string matchId, domain::Score score,
+                                  std::vector<domain::RoundType> validRounds) {
+    try {
+        auto connection = co_await connectionProvider->Connection();
+        if (!connection) {
+            co_return std::unexpected(connection.error());
+        }
+
+        const std::vector<std::optional<std::string>> params{
+            matchId, tournamentId, std::to_string(score.homeTeamScore), std::to_string(score.visitorTeamScore),
+            RoundsArray(validRounds)
+        };
+        const auto result = co_await (*connection)->Execute(statements::UPDATE_MATCH_SCORE.name, statements::UPDATE_MATCH_SCORE.sql, params);
+        if (!result) {
+            std::cerr << result.error() << std::endl;
+            co_return std::unexpected(result.error());
+        }
+
+        co_return ScoreUpdateFromRow((*result)[0]);
+    } catch (const std::exception &e) {
+        std::cerr << "Unexpected error: " << e.what() << std::endl;
+        co_return std::unexpected(std::format("Database error: {}", e.what()));
+    }
+}
+
+asio::awaitable<std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>>
+AsyncMatchRepository::Find(MatchQuery query) {
+    std::vector<std::shared_ptr<domain::Match>> matches;
+
+    try {
+        auto connection = co_await connectionProvider->Connection();
+        if (!connection) {
+            co_return std::unexpected(connection.error());
+        }
+
+        const auto& statement = MatchStatementFor(query, false);
+        const auto result = co_await (*connection)->Execute(statement.name, statement.sql, TextParamsFor(query));
+        if (!result) {
+            std::cerr << result.error() << std::endl;
+            co_return std::unexpected(result.error());
+        }
+
+        matches.reserve(result->size());
+        for (size_t i = 0; i < result->size(); i++) {
+            matches.push_back(projection::MatchFromRow((*result)[i]));
+        }
+
+        co_return matches;
+    } catch (const std::exception &e) {
+        std::cerr << "Unexpected error: " << e.what() << std::endl;
+        co_return std::unexpected(std::format("Database error: {}", e.what()));
+    }
+}
+
+
+asio::awaitable<std::expected<int64_t, std::string>>
+AsyncMatchRepository::ReadChangeVersion(std::string tournamentId) {
+    try {
+        auto connection = co_await connectionProvider->Connection();
+        if (!connection) {
+            co_return std::unexpected(connection.error());
+        }
+
+        const std::vector<std::optional<std::string>> params{tournamentId};
+        const auto result = co_await (*connection)->Execute(statements::SELECT_TOURNAMENT_CHANGES.name, statements::SELECT_TOURNAMENT_CHANGES.sql, params);
+        if (!result) {
+            std::cerr << result.error() << std::endl;
+            co_return std::unexpected(result.error());
+        }
+
+        if (result->empty()) {
+            co_return std::unexpected("Tournament not found");
+        }
+
+        co_return (*result)[0][projection::CHANGES_MATCHES_VERSION].as<int64_t>();
+    } catch (const std::exception &e) {
+        std::cerr << "Unexpected error: " << e.what() << std::endl;
+        co_return std::unexpected(std::format("Database error: {}", e.what()));
+    }
+}
@@ -0,0 +1,42 @@
+//
+// Created by developer on 10/15/26.
+//
+
+#include <format>
+#include <iostream>
+#include <string>
+
+#include "persistence/repository/AsyncTournamentRepository.hpp"
+#include "persistence/repository/Projections.hpp"
+#include "persistence/repository/StatementCatalog.hpp"
+#include "domain/Utilities.hpp"
+
+AsyncTournamentRepository::AsyncTournamentRepository(std::shared_ptr<AsyncConnectionProvider> connectionProvider)
+    : connectionProvider(std::move(connectionProvider)) {}
+
+asio::awaitable<std::expected<std::shared_ptr<domain::Tournament>, std::string>>
+AsyncTournamentRepository::ReadById(std::string id) {
+    try {
+        auto connection = co_await connectionProvider->Connection();
+        if (!connection) {
+            co_return std::unexpected(connection.error());
+        }
+
+        const std::vector<std::optional<std::string>> params{id};
+        const auto result = co_await (*connection)->Execute(statements::SELECT_TOURNAMENT_BY_ID.name, statements::SELECT_TOURNAMENT_BY_ID.sql, params);
+        if (!result) {
+            std::cerr << result.error() << std::endl;
+            co_return std::unexpected(result.error());
+        }
+
+        if (result->empty()) {
+            co_return std::unexpected("Tournament not found");
+        }
+
+        co_return projection::TournamentFromRow(result->at(0));
+    } catch (const std::exception &e) {
+        std::cerr << "Unexpected error: " << e.what() << std::endl;
+
+        co_return std::unexpected(std::format("Database error: {}", e.what()));
+    }
+}
@@ -9,21 +9,21 @@
 
 #include "domain/Utilities.hpp"
 #include "persistence/repository/GroupRepository.hpp"
-#include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/ReadTransaction.hpp"
+#include "persistence/configuration/UnitOfWork.hpp"
+#include "persistence/repository/Projections.hpp"
+#include "persistence/repository/StatementCatalog.hpp"
 
 GroupRepository::GroupRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
 
 std::expected<std::string, std::string> GroupRepository::Create(const domain::Group& entity) {
-    const nlohmann::json groupBody = entity;
-
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+    const nlohmann::json groupBody = domain::ToDocument(entity);
 
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"insert_group"}, pqxx::params{entity.TournamentId(), groupBody.dump()});
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::INSERT_GROUP, pqxx::params{entity.TournamentId(), groupBody.dump()});
+        });
 
-        tx.commit();
         return result[0]["id"].as<std::string>();
     } catch (const pqxx::sql_error& e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -38,25 +38,12 @@ std::expected<std::string, std::string> GroupRepository::Create(const domain::Gr
 }
 
 std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> GroupRepository::FindByTournamentId(const std::string_view& tournamentId) {
-    std::vector<std::shared_ptr<domain::Group>> groups;
-
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"select_groups_by_tournament"}, pqxx::params{tournamentId.data()});
-
-        for(const auto& row : result) {
-            nlohmann::json groupDocument = nlohmann::json::parse(row["document"].as<std::string>());
-            auto group = std::make_shared<domain::Group>(groupDocument);
-            group->Id() = row["id"].as<std::string>();
-
-            groups.push_back(group);
-        }
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::SELECT_GROUPS_BY_TOURNAMENT, pqxx::params{tournamentId.data()});
+        });
 
-        tx.commit();
-        return groups;
+        return projection::GroupsFromResult(result);
     } catch (const pqxx::sql_error& e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
         std::cerr << "Query was: " << e.query() << std::endl;
@@ -78,23 +65,16 @@ std::expected<std::shared_ptr<domain::Group>, std::string> GroupRepository::Read
 }
 
 std::expected<std::shared_ptr<domain::Group>, std::string> GroupRepository::FindByTournamentIdAndGroupId(const std::string_view& tournamentId, const std::string_view& groupId) {
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"select_group_by_tournamentid_groupid"}, pqxx::params{tournamentId.data(), groupId.data()});
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::SELECT_GROUP_BY_TOURNAMENTID_GROUPID, pqxx::params{tournamentId.data(), groupId.data()});
+        });
 
         if (result.empty()) {
             return std::unexpected("Group not found");
         }
 
-        nlohmann::json groupDocument = nlohmann::json::parse(result.at(0)["document"].as<std::string>());
-        auto group = std::make_shared<domain::Group>(groupDocument);
-        group->Id() = result.at(0)["id"].as<std::string>();
-
-        tx.commit();
-        return group;
+        return projection::GroupsFromResult(result).front();
     } catch (const pqxx::sql_error& e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
         std::cerr << "Query was: " << e.query() << std::endl;
@@ -108,23 +88,16 @@ std::expected<std::shared_ptr<domain::Group>, std::string> GroupRepository::Find
 }
 
 std::expected<std::shared_ptr<domain::Group>, std::string> GroupRepository::FindByTournamentIdAndTeamId(const std::string_view& tournamentId, const std::string_view& teamId) {
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"select_group_in_tournament"}, pqxx::params{tournamentId.data(), teamId.data()});
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::SELECT_GROUP_IN_TOURNAMENT, pqxx::params{tournamentId.data(), teamId.data()});
+        });
 
         if (result.empty()) {
             return std::unexpected("Group not found");
         }
 
-        nlohmann::json groupDocument = nlohmann::json::parse(result.at(0)["document"].as<std::string>());
-        auto group = std::make_shared<domain::Group>(groupDocument);
-        group->Id() = result.at(0)["id"].as<std::string>();
-
-        tx.commit();
-        return group;
+        return projection::GroupsFromResult(result).front();
     } catch (const pqxx::sql_error& e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
         std::cerr << "Query was: " << e.query() << std::endl;
@@ -137,26 +110,32 @@ std::expected<std::shared_ptr<domain::Group>, std::string> GroupRepository::Find
     }
 }
 
-std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> GroupRepository::FindByTournamentIdAndConference(const std::string_view& tournamentId, const std::string_view& conference) {
-    std::vector<std::shared_ptr<domain::Group>> groups;
+std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> GroupRepository::FindGroupsContainingAnyTeam(const std::string_view& tournamentId, std::span<const std::string> teamIds) {
+    try {
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::SELECT_GROUPS_CONTAINING_ANY_TEAM, pqxx::params{tournamentId.data(), ArrayLiteral(teamIds)});
+        });
 
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+        return projection::GroupsFromResult(result);
+    } catch (const pqxx::sql_error& e) {
+        std::cerr << "SQL error: " << e.what() << std::endl;
+        std::cerr << "Query was: " << e.query() << std::endl;
 
-    try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"select_groups_by_tournament_conference"}, pqxx::params{tournamentId.data(), conference.data()});
+        return std::unexpected(std::format("SQL error: {}", e.what()));
+    } catch (const std::exception& e) {
+        std::cerr << "Unexpected error: " << e.what() << std::endl;
 
-        for(const auto& row : result) {
-            nlohmann::json groupDocument = nlohmann::json::parse(row["document"].as<std::string>());
-            auto group = std::make_shared<domain::Group>(groupDocument);
-            group->Id() = row["id"].as<std::string>();
+        return std::unexpected(std::format("Database error: {}", e.what()));
+    }
+}
 
-            groups.push_back(group);
-        }
+std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> GroupRepository::FindByTournamentIdAndConference(const std::string_view& tournamentId, const std::string_view& conference) {
+    try {
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::SELECT_GROUPS_BY_TOURNAMENT_CONFERENCE, pqxx::params{tournamentId.data(), conference.data()});
+        });
 
-        tx.commit();
-        return groups;
+        return projection::GroupsFromResult(result);
     } catch (const pqxx::sql_error& e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
         std::cerr << "Query was: " << e.query() << std::endl;
@@ -170,20 +149,17 @@ std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> GroupRep
 }
 
 std::expected<std::string, std::string> GroupRepository::Update(std::string id, const domain::Group& entity) {
-    const nlohmann::json groupBody = entity;
-
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+    const nlohmann::json groupBody = domain::ToDocument(entity);
 
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"update_group_by_id"}, pqxx::params{id, groupBody.dump()});
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::UPDATE_GROUP_BY_ID, pqxx::params{id, groupBody.dump()});
+        });
 
         if (result.affected_rows() == 0) {
             return std::unexpected("Group not found");
         }
 
-        tx.commit();
         return result[0]["id"].as<std::string>();
     } catch (const pqxx::sql_error& e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -198,18 +174,15 @@ std::expected<std::string, std::string> GroupRepository::Update(std::string id,
 }
 
 std::expected<void, std::string> GroupRepository::Delete(std::string id) {
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"delete_group_by_id"}, id);
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::DELETE_GROUP_BY_ID, id);
+        });
 
         if (result.affected_rows() == 0) {
             return std::unexpected("Group not found");
         }
 
-        tx.commit();
         return {};
     } catch (const pqxx::sql_error& e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -224,20 +197,17 @@ std::expected<void, std::string> GroupRepository::Delete(std::string id) {
 }
 
 std::expected<void, std::string> GroupRepository::UpdateGroupAddTeam(const std::string_view& groupId, const std::shared_ptr<domain::Team>& team) {
-    const nlohmann::json teamDocument = team;
-
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+    const nlohmann::json teamDocument = domain::ToDocument(*team);
 
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"update_group_add_team"}, pqxx::params{groupId.data(), teamDocument.dump()});
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::UPDATE_GROUP_ADD_TEAM, pqxx::params{groupId.data(), teamDocument.dump()});
+        });
 
         if (result.affected_rows() == 0) {
             return std::unexpected("Group not found");
         }
 
-        tx.commit();
         return {};
     } catch (const pqxx::sql_error& e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -249,4 +219,27 @@ std::expected<void, std::string> GroupRepository::UpdateGroupAddTeam(const std::
 
         return std::unexpected(std::format("Database error: {}", e.what()));
     }
-}
\ No newline at end of file
+}
+
+std::expected<int64_t, std::string> GroupRepository::ReadChangeVersion(const std::string_view& tournamentId) {
+    try {
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::SELECT_TOURNAMENT_CHANGES, pqxx::params{tournamentId.data()});
+        });
+
+        if (result.empty()) {
+            return std::unexpected("Tournament not found");
+        }
+
+        return result[0][projection::CHANGES_GROUPS_VERSION].as<int64_t>();
+    } catch (const pqxx::sql_error& e) {
+        std::cerr << "SQL error: " << e.what() << std::endl;
+        std::cerr << "Query was: " << e.query() << std::endl;
+
+        return std::unexpected(std::format("SQL error: {}", e.what()));
+    } catch (const std::exception& e) {
+        std::cerr << "Unexpected error: " << e.what() << std::endl;
+
+        return std::unexpected(std::format("Database error: {}", e.what()));
+    }
+}
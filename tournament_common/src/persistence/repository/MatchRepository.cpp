@@ -1,37 +1,118 @@
 #include "persistence/repository/MatchRepository.hpp"
-#include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/ReadTransaction.hpp"
+#include "persistence/configuration/UnitOfWork.hpp"
+#include "persistence/repository/MatchStorage.hpp"
+#include "persistence/repository/Projections.hpp"
+#include "persistence/repository/StatementCatalog.hpp"
+#include <array>
 #include <iostream>
 #include <nlohmann/json.hpp>
 
-MatchRepository::MatchRepository(std::shared_ptr<IDbConnectionProvider> connection)
-    : connectionProvider(std::move(connection)) {}
+namespace {
+    enum MatchFilter : unsigned {
+        BY_TOURNAMENT = 1,
+        BY_ROUND = 2,
+        BY_PLAYED = 4,
+        BY_TEAM = 8,
+        WITH_LIMIT = 16,
+        FILTER_SHAPES = 32
+    };
+
+    unsigned ShapeOf(const MatchQuery& query) {
+        return (query.Tournament() ? BY_TOURNAMENT : 0)
+             | (query.Round() ? BY_ROUND : 0)
+             | (query.Played() ? BY_PLAYED : 0)
+             | (query.Team() ? BY_TEAM : 0)
+             | (query.Limit() ? WITH_LIMIT : 0);
+    }
 
-std::expected<std::string, std::string> MatchRepository::Create(const domain::Match& entity) {
-    nlohmann::json matchDoc;
-    matchDoc["tournamentId"] = entity.TournamentId();
-    matchDoc["home"] = entity.getHome();
-    matchDoc["visitor"] = entity.getVisitor();
-    matchDoc["round"] = static_cast<int>(entity.Round());
-    
-    if (entity.IsPlayed()) {
-        const auto& score = entity.MatchScore().value();
-        matchDoc["score"]["home"] = score.homeTeamScore;
-        matchDoc["score"]["visitor"] = score.visitorTeamScore;
+    // tournament_id, round y played son columnas generadas e indexadas (db_script.sql)
+    Statement Compile(unsigned shape, bool count) {
+        std::string sql = count ? "select count(*) from MATCHES" : projection::MATCH_SELECT;
+        std::string where;
+        int parameter = 0;
+        auto add = [&](const std::string& condition) {
+            where += where.empty() ? " where " : " and ";
+            where += condition;
+        };
+
+        if (shape & BY_TOURNAMENT) {
+            add(std::format("tournament_id = ${}", ++parameter));
+        }
+        if (shape & BY_ROUND) {
+            add(std::format("round = ${}", ++parameter));
+        }
+        if (shape & BY_PLAYED) {
+            add(std::format("played = ${}", ++parameter));
+        }
+        if (shape & BY_TEAM) {
+            ++parameter;
+            add(std::format("(document->'home'->>'id' = ${0} or document->'visitor'->>'id' = ${0})", parameter));
+        }
+        sql += where;
+        if (!count && (shape & WITH_LIMIT)) {
+            sql += std::format(" order by created_at, id limit ${}", ++parameter);
+        }
+
+        return {std::format("{}_matches_{}", count ? "count" : "find", shape), sql};
+    }
+
+    pqxx::params ParamsFor(const MatchQuery& query, bool count) {
+        pqxx::params params;
+        if (query.Tournament()) {
+            params.append(*query.Tournament());
+        }
+        if (query.Round()) {
+            params.append(static_cast<int>(*query.Round()));
+        }
+        if (query.Played()) {
+            params.append(*query.Played());
+        }
+        if (query.Team()) {
+            params.append(*query.Team());
+        }
+        if (!count && query.Limit()) {
+            params.append(static_cast<long long>(*query.Limit()));
+        }
+        return params;
     }
-    
-    if (!entity.WinnerNextMatchId().empty()) {
-        matchDoc["winnerNextMatchId"] = entity.WinnerNextMatchId();
+}
+
+std::string RoundsArray(const std::vector<domain::RoundType>& rounds) {
+    std::string array = "{";
+    for (const auto round : rounds) {
+        if (array.size() > 1) {
+            array += ',';
+        }
+        array += std::to_string(domain::ROUND_NUMBERS.Encode(round));
     }
+    return array + "}";
+}
+
+// El SQL de cada forma se genera una sola vez; cada conexión lo prepara al primer uso
+const Statement& MatchStatementFor(const MatchQuery& query, bool count) {
+    static const auto statements = [] {
+        std::array<Statement, FILTER_SHAPES * 2> compiled;
+        for (unsigned shape = 0; shape < FILTER_SHAPES; shape++) {
+            compiled[shape] = Compile(shape, false);
+            compiled[FILTER_SHAPES + shape] = Compile(shape, true);
+        }
+        return compiled;
+    }();
+    return statements[(count ? FILTER_SHAPES : 0) + ShapeOf(query)];
+}
 
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+MatchRepository::MatchRepository(std::shared_ptr<IDbConnectionProvider> connection)
+    : connectionProvider(std::move(connection)) {}
+
+std::expected<std::string, std::string> MatchRepository::Create(const domain::Match& entity) {
+    nlohmann::json matchDoc = domain::ToDocument(entity);
 
     try {
-        const pqxx::result result = tx.exec(
-            pqxx::prepped{"insert_match"}, matchDoc.dump());
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::INSERT_MATCH, matchDoc.dump());
+        });
 
-        tx.commit();
         return result[0]["id"].as<std::string>();
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -45,39 +126,17 @@ std::expected<std::string, std::string> MatchRepository::Create(const domain::Ma
 
 std::expected<std::shared_ptr<domain::Match>, std::string> 
 MatchRepository::ReadById(const std::string& id) {
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"select_match_by_id"}, id);
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::SELECT_MATCH_BY_ID, id);
+        });
 
         if (result.empty()) {
             return std::unexpected("Match not found");
         }
         
-        nlohmann::json matchJson = nlohmann::json::parse(
-            result.at(0)["document"].as<std::string>());
-        
-        auto match = std::make_shared<domain::Match>();
-        match->Id() = result.at(0)["id"].as<std::string>();
-        match->TournamentId() = matchJson["tournamentId"];
-        match->getHome() = matchJson["home"];
-        match->getVisitor() = matchJson["visitor"];
-        match->Round() = static_cast<domain::RoundType>(matchJson["round"].get<int>());
-        
-        if (matchJson.contains("score")) {
-            domain::Score score;
-            score.homeTeamScore = matchJson["score"]["home"];
-            score.visitorTeamScore = matchJson["score"]["visitor"];
-            match->MatchScore() = score;
-        }
-        
-        if (matchJson.contains("winnerNextMatchId")) {
-            match->WinnerNextMatchId() = matchJson["winnerNextMatchId"];
-        }
+        auto match = projection::MatchFromRow(result.at(0));
 
-        tx.commit();
         return match;
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -91,36 +150,20 @@ MatchRepository::ReadById(const std::string& id) {
 
 std::expected<std::string, std::string> 
 MatchRepository::Update(const std::string& id, const domain::Match& entity) {
-    nlohmann::json matchDoc;
-    matchDoc["tournamentId"] = entity.TournamentId();
-    matchDoc["home"] = entity.getHome();
-    matchDoc["visitor"] = entity.getVisitor();
-    matchDoc["round"] = static_cast<int>(entity.Round());
-    
-    if (entity.IsPlayed()) {
-        const auto& score = entity.MatchScore().value();
-        matchDoc["score"]["home"] = score.homeTeamScore;
-        matchDoc["score"]["visitor"] = score.visitorTeamScore;
-    }
-    
-    if (!entity.WinnerNextMatchId().empty()) {
-        matchDoc["winnerNextMatchId"] = entity.WinnerNextMatchId();
-    }
-
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+    nlohmann::json matchDoc = domain::ToDocument(entity);
 
     try {
-        const pqxx::result result = tx.exec(
-            pqxx::prepped{"update_match_by_id"}, 
-            pqxx::params{id, matchDoc.dump()});
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::UPDATE_MATCH_BY_ID, pqxx::params{id, matchDoc.dump(), entity.Version()});
+        });
 
-        if (result.affected_rows() == 0) {
+        if (result.empty()) {
             return std::unexpected("Match not found");
         }
+        if (!result[0]["updated"].as<bool>()) {
+            return std::unexpected(std::string(MATCH_VERSION_CONFLICT));
+        }
 
-        tx.commit();
         return result[0]["id"].as<std::string>();
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -132,19 +175,36 @@ MatchRepository::Update(const std::string& id, const domain::Match& entity) {
     }
 }
 
-std::expected<void, std::string> MatchRepository::Delete(const std::string& id) {
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+std::expected<ScoreUpdate, std::string>
+MatchRepository::UpdateScore(const std::string& tournamentId, const std::string& matchId,
+                             const domain::Score& score, const std::vector<domain::RoundType>& validRounds) {
+    try {
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::UPDATE_MATCH_SCORE,
+                                pqxx::params{matchId, tournamentId, score.homeTeamScore, score.visitorTeamScore, RoundsArray(validRounds)});
+        });
 
+        return ScoreUpdateFromRow(result[0]);
+    } catch (const pqxx::sql_error &e) {
+        std::cerr << "SQL error: " << e.what() << std::endl;
+        std::cerr << "Query was: " << e.query() << std::endl;
+        return std::unexpected(std::format("SQL error: {}", e.what()));
+    } catch (const std::exception &e) {
+        std::cerr << "Unexpected error: " << e.what() << std::endl;
+        return std::unexpected(std::format("Database error: {}", e.what()));
+    }
+}
+
+std::expected<void, std::string> MatchRepository::Delete(const std::string& id) {
     try {
-        auto result = tx.exec("DELETE FROM MATCHES WHERE id = " + tx.quote(id));
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection&, pqxx::transaction_base& tx) {
+            return tx.exec("DELETE FROM MATCHES WHERE id = " + tx.quote(id));
+        });
 
         if (result.affected_rows() == 0) {
             return std::unexpected("Match not found");
         }
 
-        tx.commit();
         return {};
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -156,45 +216,36 @@ std::expected<void, std::string> MatchRepository::Delete(const std::string& id)
     }
 }
 
-std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string> 
-MatchRepository::FindByTournamentId(const std::string_view& tournamentId) {
-    std::vector<std::shared_ptr<domain::Match>> matches;
+std::expected<std::vector<std::string>, std::string>
+MatchRepository::CreateMany(const std::vector<domain::Match>& entities) {
+    if (entities.empty()) {
+        return std::vector<std::string>{};
+    }
 
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+    // Los ids asignados por el cliente se respetan (p. ej. enlaces del bracket)
+    nlohmann::json matchDocs = nlohmann::json::array();
+    for (const auto& entity : entities) {
+        nlohmann::json element;
+        if (!entity.Id().empty()) {
+            element["id"] = entity.Id();
+        }
+        element["document"] = domain::ToDocument(entity);
+        matchDocs.push_back(std::move(element));
+    }
 
     try {
-        const pqxx::result result = tx.exec(
-            pqxx::prepped{"select_matches_by_tournament"}, tournamentId.data());
-
-        for(const auto& row : result) {
-            nlohmann::json matchJson = nlohmann::json::parse(
-                row["document"].as<std::string>());
-            
-            auto match = std::make_shared<domain::Match>();
-            match->Id() = row["id"].as<std::string>();
-            match->TournamentId() = matchJson["tournamentId"];
-            match->getHome() = matchJson["home"];
-            match->getVisitor() = matchJson["visitor"];
-            match->Round() = static_cast<domain::RoundType>(matchJson["round"].get<int>());
-            
-            if (matchJson.contains("score")) {
-                domain::Score score;
-                score.homeTeamScore = matchJson["score"]["home"];
-                score.visitorTeamScore = matchJson["score"]["visitor"];
-                match->MatchScore() = score;
-            }
-            
-            if (matchJson.contains("winnerNextMatchId")) {
-                match->WinnerNextMatchId() = matchJson["winnerNextMatchId"];
-            }
-
-            matches.push_back(match);
+        // Un solo INSERT multi-fila para todo el calendario
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::INSERT_MATCHES, matchDocs.dump());
+        });
+
+        std::vector<std::string> ids;
+        ids.reserve(result.size());
+        for (const auto& row : result) {
+            ids.push_back(row["id"].as<std::string>());
         }
 
-        tx.commit();
-        return matches;
+        return ids;
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
         std::cerr << "Query was: " << e.query() << std::endl;
@@ -205,63 +256,25 @@ MatchRepository::FindByTournamentId(const std::string_view& tournamentId) {
     }
 }
 
-std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string> 
-MatchRepository::FindByTournamentIdAndRound(const std::string_view& tournamentId, 
-                                           domain::RoundType round) {
-    auto allMatches = FindByTournamentId(tournamentId);
-    if (!allMatches) {
-        return allMatches;
-    }
-    
-    std::vector<std::shared_ptr<domain::Match>> filtered;
-    for (const auto& match : *allMatches) {
-        if (match->Round() == round) {
-            filtered.push_back(match);
-        }
-    }
-    
-    return filtered;
-}
-
-std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string> 
-MatchRepository::FindPlayedMatchesByTournamentId(const std::string_view& tournamentId) {
+std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>
+MatchRepository::Find(const MatchQuery& query) {
     std::vector<std::shared_ptr<domain::Match>> matches;
 
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-
     try {
-        const pqxx::result result = tx.exec(
-            pqxx::prepped{"select_played_matches_by_tournament"}, tournamentId.data());
+        const auto& statement = MatchStatementFor(query, false);
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statement, ParamsFor(query, false));
+        });
 
+        matches.reserve(result.size());
         for(const auto& row : result) {
-            nlohmann::json matchJson = nlohmann::json::parse(
-                row["document"].as<std::string>());
-            
-            auto match = std::make_shared<domain::Match>();
-            match->Id() = row["id"].as<std::string>();
-            match->TournamentId() = matchJson["tournamentId"];
-            match->getHome() = matchJson["home"];
-            match->getVisitor() = matchJson["visitor"];
-            match->Round() = static_cast<domain::RoundType>(matchJson["round"].get<int>());
-            
-            domain::Score score;
-            score.homeTeamScore = matchJson["score"]["home"];
-            score.visitorTeamScore = matchJson["score"]["visitor"];
-            match->MatchScore() = score;
-            
-            if (matchJson.contains("winnerNextMatchId")) {
-                match->WinnerNextMatchId() = matchJson["winnerNextMatchId"];
-            }
-
-            matches.push_back(match);
+            matches.push_back(projection::MatchFromRow(row));
         }
 
-        tx.commit();
         return matches;
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
+        std::cerr << "Query was: " << e.query() << std::endl;
         return std::unexpected(std::format("SQL error: {}", e.what()));
     } catch (const std::exception &e) {
         std::cerr << "Unexpected error: " << e.what() << std::endl;
@@ -269,40 +282,17 @@ MatchRepository::FindPlayedMatchesByTournamentId(const std::string_view& tournam
     }
 }
 
-std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string> 
-MatchRepository::FindPendingMatchesByTournamentId(const std::string_view& tournamentId) {
-    std::vector<std::shared_ptr<domain::Match>> matches;
-
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-
+std::expected<size_t, std::string> MatchRepository::Count(const MatchQuery& query) {
     try {
-        const pqxx::result result = tx.exec(
-            pqxx::prepped{"select_pending_matches_by_tournament"}, tournamentId.data());
+        const auto& statement = MatchStatementFor(query, true);
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statement, ParamsFor(query, true));
+        });
 
-        for(const auto& row : result) {
-            nlohmann::json matchJson = nlohmann::json::parse(
-                row["document"].as<std::string>());
-            
-            auto match = std::make_shared<domain::Match>();
-            match->Id() = row["id"].as<std::string>();
-            match->TournamentId() = matchJson["tournamentId"];
-            match->getHome() = matchJson["home"];
-            match->getVisitor() = matchJson["visitor"];
-            match->Round() = static_cast<domain::RoundType>(matchJson["round"].get<int>());
-            
-            if (matchJson.contains("winnerNextMatchId")) {
-                match->WinnerNextMatchId() = matchJson["winnerNextMatchId"];
-            }
-
-            matches.push_back(match);
-        }
-
-        tx.commit();
-        return matches;
+        return result[0][0].as<size_t>();
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
+        std::cerr << "Query was: " << e.query() << std::endl;
         return std::unexpected(std::format("SQL error: {}", e.what()));
     } catch (const std::exception &e) {
         std::cerr << "Unexpected error: " << e.what() << std::endl;
@@ -310,6 +300,27 @@ MatchRepository::FindPendingMatchesByTournamentId(const std::string_view& tourna
     }
 }
 
+std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string> 
+MatchRepository::FindByTournamentId(const std::string_view& tournamentId) {
+    return Find(MatchQuery().WithTournament(tournamentId));
+}
+
+std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string> 
+MatchRepository::FindByTournamentIdAndRound(const std::string_view& tournamentId, 
+                                           domain::RoundType round) {
+    return Find(MatchQuery().WithTournament(tournamentId).WithRound(round));
+}
+
+std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string> 
+MatchRepository::FindPlayedMatchesByTournamentId(const std::string_view& tournamentId) {
+    return Find(MatchQuery().WithTournament(tournamentId).WithPlayed(true));
+}
+
+std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string> 
+MatchRepository::FindPendingMatchesByTournamentId(const std::string_view& tournamentId) {
+    return Find(MatchQuery().WithTournament(tournamentId).WithPlayed(false));
+}
+
 std::expected<std::shared_ptr<domain::Match>, std::string> 
 MatchRepository::FindLastOpenMatch(const std::string_view& tournamentId) {
     // Esta función es específica para doble eliminación
@@ -8,23 +8,23 @@
 #include <nlohmann/json.hpp>
 
 #include "persistence/repository/TournamentRepository.hpp"
+#include "persistence/configuration/ReadTransaction.hpp"
+#include "persistence/configuration/UnitOfWork.hpp"
+#include "persistence/repository/Projections.hpp"
+#include "persistence/repository/StatementCatalog.hpp"
 #include "domain/Utilities.hpp"
-#include "persistence/configuration/PostgresConnection.hpp"
 
 TournamentRepository::TournamentRepository(std::shared_ptr<IDbConnectionProvider> connection) : connectionProvider(std::move(connection)) {
 }
 
 std::expected<std::string, std::string> TournamentRepository::Create (const domain::Tournament & entity) {
-    const nlohmann::json tournamentDoc = entity;
-
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+    const nlohmann::json tournamentDoc = domain::ToDocument(entity);
 
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"insert_tournament"}, tournamentDoc.dump());
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::INSERT_TOURNAMENT, tournamentDoc.dump());
+        });
 
-        tx.commit();
         return result[0]["id"].as<std::string>();
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -41,22 +41,16 @@ std::expected<std::string, std::string> TournamentRepository::Create (const doma
 std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string> TournamentRepository::ReadAll() {
     std::vector<std::shared_ptr<domain::Tournament>> tournaments;
 
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-
     try {
-        const pqxx::result result{tx.exec("select id, document from tournaments")};
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection&, pqxx::transaction_base& tx) {
+            return tx.exec(projection::TOURNAMENT_SELECT);
+        });
 
+        tournaments.reserve(result.size());
         for(const auto& row : result){
-            nlohmann::json rowTournament = nlohmann::json::parse(row["document"].as<std::string>());
-            auto tournament = std::make_shared<domain::Tournament>(rowTournament);
-            tournament->Id() = row["id"].as<std::string>();
-
-            tournaments.push_back(tournament);
+            tournaments.push_back(projection::TournamentFromRow(row));
         }
 
-        tx.commit();
         return tournaments;
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -70,23 +64,47 @@ std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string> Tou
     }
 }
 
-std::expected<std::shared_ptr<domain::Tournament>, std::string> TournamentRepository::ReadById(std::string id) {
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string> TournamentRepository::ReadPage(const std::optional<std::string>& after, size_t limit) {
+    std::vector<std::shared_ptr<domain::Tournament>> tournaments;
 
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"select_tournament_by_id"}, id);
+        const auto pageSize = static_cast<long long>(limit);
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return after
+                ? ExecPrepared(pooled, tx, statements::SELECT_TOURNAMENTS_PAGE_AFTER, pqxx::params{*after, pageSize})
+                : ExecPrepared(pooled, tx, statements::SELECT_TOURNAMENTS_PAGE, pqxx::params{pageSize});
+        });
+
+        tournaments.reserve(result.size());
+        for(const auto& row : result){
+            tournaments.push_back(projection::TournamentFromRow(row));
+        }
+
+        return tournaments;
+    } catch (const pqxx::sql_error &e) {
+        std::cerr << "SQL error: " << e.what() << std::endl;
+        std::cerr << "Query was: " << e.query() << std::endl;
+
+        return std::unexpected(std::format("SQL error: {}", e.what()));
+    } catch (const std::exception &e) {
+        std::cerr << "Unexpected error: " << e.what() << std::endl;
+
+        return std::unexpected(std::format("Database error: {}", e.what()));
+    }
+}
+
+std::expected<std::shared_ptr<domain::Tournament>, std::string> TournamentRepository::ReadById(std::string id) {
+    try {
+        const pqxx::result result = ExecuteRead(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::SELECT_TOURNAMENT_BY_ID, id);
+        });
 
         if (result.empty()) {
             return std::unexpected("Tournament not found");
         }
         
-        nlohmann::json rowTournament = nlohmann::json::parse(result.at(0)["document"].as<std::string>());
-        auto tournament = std::make_shared<domain::Tournament>(rowTournament);
-        tournament->Id() = result.at(0)["id"].as<std::string>();
+        auto tournament = projection::TournamentFromRow(result.at(0));
 
-        tx.commit();
         return tournament;
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -101,20 +119,17 @@ std::expected<std::shared_ptr<domain::Tournament>, std::string> TournamentReposi
 }
 
 std::expected<std::string, std::string> TournamentRepository::Update(std::string id, const domain::Tournament & entity) {
-    const nlohmann::json tournamentDoc = entity;
-
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
+    const nlohmann::json tournamentDoc = domain::ToDocument(entity);
 
     try {
-        const pqxx::result result = tx.exec(pqxx::prepped{"update_tournament_by_id"}, pqxx::params{id, tournamentDoc.dump()});
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::UPDATE_TOURNAMENT_BY_ID, pqxx::params{id, tournamentDoc.dump()});
+        });
 
         if (result.affected_rows() == 0) {
             return std::unexpected("Tournament not found");
         }
 
-        tx.commit();
         return result[0]["id"].as<std::string>();
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
@@ -129,18 +144,15 @@ std::expected<std::string, std::string> TournamentRepository::Update(std::string
 }
 
 std::expected<void, std::string> TournamentRepository::Delete(std::string id) {
-    auto pooled = connectionProvider->Connection();
-    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-
     try {
-        auto result = tx.exec(pqxx::prepped{"delete_tournament_by_id"}, id);
+        const pqxx::result result = ExecuteWrite(*connectionProvider, [&](PooledConnection& pooled, pqxx::transaction_base& tx) {
+            return ExecPrepared(pooled, tx, statements::DELETE_TOURNAMENT_BY_ID, id);
+        });
 
         if (result.affected_rows() == 0) {
             return std::unexpected("Tournament not found");
         }
 
-        tx.commit();
         return {};
     } catch (const pqxx::sql_error &e) {
         std::cerr << "SQL error: " << e.what() << std::endl;
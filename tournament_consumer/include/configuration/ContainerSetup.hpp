@@ -16,6 +16,7 @@
 #include "persistence/repository/IMatchRepository.hpp"
 #include "persistence/repository/GroupRepository.hpp"
 #include "persistence/repository/IGroupRepository.hpp"
+#include "persistence/repository/StandingsRepository.hpp"
 #include "persistence/configuration/PostgresConnectionProvider.hpp"
 #include "cms/QueueMessageListener.hpp"
 #include "cms/GroupAddTeamListener.hpp"
@@ -33,8 +34,7 @@ namespace config {
         // Database connection
         std::shared_ptr<PostgresConnectionProvider> postgressConnection = 
             std::make_shared<PostgresConnectionProvider>(
-                configuration["databaseConfig"]["connectionString"].get<std::string>(),
-                configuration["databaseConfig"]["poolSize"].get<size_t>());
+                configuration["databaseConfig"].get<DatabaseConfiguration>());
         builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
 
         // Connection Manager (ActiveMQ)
@@ -62,6 +62,9 @@ namespace config {
             .as<IMatchRepository>()
             .singleInstance();
 
+        builder.registerType<StandingsRepository>()
+            .singleInstance();
+
         // Registrar MatchDelegate2
         builder.registerType<MatchDelegate2>()
             .singleInstance();
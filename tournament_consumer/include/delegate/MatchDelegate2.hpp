@@ -1,32 +1,43 @@
 #ifndef CONSUMER_MATCHDELEGATE2_HPP
 #define CONSUMER_MATCHDELEGATE2_HPP
 
+#include <array>
 #include <memory>
+#include <utility>
 #include <vector>
 #include <print>
 
 #include "event/TeamAddEvent.hpp"
 #include "event/ScoreUpdateEvent.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/ReadTransaction.hpp"
+#include "persistence/configuration/UnitOfWork.hpp"
 #include "persistence/repository/IMatchRepository.hpp"
 #include "persistence/repository/IGroupRepository.hpp"
+#include "persistence/repository/StandingsRepository.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
 #include "domain/Match.hpp"
 #include "domain/NFLStrategy.hpp"
+#include "domain/Standing.hpp"
+#include "domain/Uuid.hpp"
 
 class MatchDelegate2 {
     std::shared_ptr<IMatchRepository> matchRepository;
     std::shared_ptr<IGroupRepository> groupRepository;
     std::shared_ptr<TournamentRepository> tournamentRepository;
+    std::shared_ptr<StandingsRepository> standingsRepository;
 
 public:
     MatchDelegate2(const std::shared_ptr<IMatchRepository>& matchRepository,
                   const std::shared_ptr<IGroupRepository>& groupRepository,
-                  const std::shared_ptr<TournamentRepository>& tournamentRepository);
+                  const std::shared_ptr<TournamentRepository>& tournamentRepository,
+                  const std::shared_ptr<StandingsRepository>& standingsRepository);
 
     virtual void ProcessTeamAddition(const TeamAddEvent& teamAddEvent);
     virtual void ProcessScoreUpdate(const ScoreUpdateEvent& scoreUpdateEvent);
 
 private:
+    void UpdateStandings(const ScoreUpdateEvent& scoreUpdateEvent);
     bool IsTournamentComplete(const std::string& tournamentId);
     bool AllRegularMatchesPlayed(const std::string& tournamentId);
     void CreateRegularPhaseMatches(const std::string& tournamentId);
@@ -38,12 +49,16 @@ private:
 inline MatchDelegate2::MatchDelegate2(
     const std::shared_ptr<IMatchRepository>& matchRepository,
     const std::shared_ptr<IGroupRepository>& groupRepository,
-    const std::shared_ptr<TournamentRepository>& tournamentRepository)
+    const std::shared_ptr<TournamentRepository>& tournamentRepository,
+    const std::shared_ptr<StandingsRepository>& standingsRepository)
     : matchRepository(matchRepository),
       groupRepository(groupRepository),
-      tournamentRepository(tournamentRepository) {}
+      tournamentRepository(tournamentRepository),
+      standingsRepository(standingsRepository) {}
 
 inline void MatchDelegate2::ProcessTeamAddition(const TeamAddEvent& teamAddEvent) {
+    // Los eventos llegan justo después de escribir; una réplica podría no tenerlos aún
+    ReadYourWrites readYourWrites;
     std::println("[MatchDelegate2] Processing team addition for tournament: {}", teamAddEvent.tournamentId);
 
     if (IsTournamentComplete(teamAddEvent.tournamentId)) {
@@ -55,8 +70,11 @@ inline void MatchDelegate2::ProcessTeamAddition(const TeamAddEvent& teamAddEvent
 }
 
 inline void MatchDelegate2::ProcessScoreUpdate(const ScoreUpdateEvent& scoreUpdateEvent) {
+    ReadYourWrites readYourWrites;
     std::println("[MatchDelegate2] Processing score update for tournament: {}", scoreUpdateEvent.tournamentId);
 
+    UpdateStandings(scoreUpdateEvent);
+
     if (AllRegularMatchesPlayed(scoreUpdateEvent.tournamentId)) {
         int playoffsCheck = CheckIfInPlayoffs(scoreUpdateEvent.tournamentId);
         if (playoffsCheck == 1) {
@@ -72,7 +90,43 @@ inline void MatchDelegate2::ProcessScoreUpdate(const ScoreUpdateEvent& scoreUpda
     }
 }
 
+inline void MatchDelegate2::UpdateStandings(const ScoreUpdateEvent& scoreUpdateEvent) {
+    // Se compara lo que la tabla ya contó del match con su marcador actual y solo se aplica
+    // la diferencia, así cada evento cuesta lo mismo sin importar cuántos matches haya.
+    // El registro bloqueado ordena los eventos del mismo match; la lectura posterior ve el
+    // último marcador confirmado, aunque los eventos lleguen repetidos o desordenados.
+    UnitOfWork unitOfWork;
+    const auto applied = standingsRepository->LockAppliedResult(scoreUpdateEvent.matchId);
+    if (!applied) {
+        std::println("[MatchDelegate2] Error reading applied standings: {}", applied.error());
+        return;
+    }
+
+    const auto current = standingsRepository->ReadMatchResult(scoreUpdateEvent.matchId);
+    if (!current) {
+        std::println("[MatchDelegate2] Error reading match result: {}", current.error());
+        return;
+    }
+
+    const auto changes = domain::StandingChanges(*applied, *current);
+    if (changes.empty() && applied->has_value() == current->has_value()) {
+        return;
+    }
+
+    const auto result = standingsRepository->Apply(scoreUpdateEvent.matchId, scoreUpdateEvent.tournamentId, changes, *current);
+    if (!result) {
+        std::println("[MatchDelegate2] Error updating standings: {}", result.error());
+        return;
+    }
+
+    if (const auto committed = unitOfWork.Commit(); !committed) {
+        std::println("[MatchDelegate2] Error updating standings: {}", committed.error());
+    }
+}
+
 inline bool MatchDelegate2::IsTournamentComplete(const std::string& tournamentId) {
+    // Grupos y formato del torneo se comparan dentro de una misma foto
+    SnapshotRead snapshot;
     auto groupsResult = groupRepository->FindByTournamentId(tournamentId);
 
     if (!groupsResult) {
@@ -157,19 +211,15 @@ inline void MatchDelegate2::CreateRegularPhaseMatches(const std::string& tournam
     auto matches = *matchesResult;
     std::println("[MatchDelegate2] Strategy created {} matches", matches.size());
 
-    // Guardar cada match en la BD
-    int successCount = 0;
-    for (auto& match : matches) {
-        auto result = matchRepository->Create(match);
-        if (result) {
-            successCount++;
-        } else {
-            std::println("[MatchDelegate2] ERROR creating match: {}", result.error());
-        }
+    // Guardar todo el calendario en una sola transacción
+    auto result = matchRepository->CreateMany(matches);
+    if (!result) {
+        std::println("[MatchDelegate2] ERROR creating matches: {}", result.error());
+        return;
     }
 
     std::println("[MatchDelegate2] SUCCESS: Created {}/{} matches for tournament {}",
-                 successCount, matches.size(), tournamentId);
+                 result->size(), matches.size(), tournamentId);
 }
 
 inline void MatchDelegate2::CreatePlayoffMatches(const std::string& tournamentId) {
@@ -208,58 +258,37 @@ inline void MatchDelegate2::CreatePlayoffMatches(const std::string& tournamentId
     auto matches = *matchesResult;
     std::println("[MatchDelegate2] Strategy created {} playoff matches", matches.size());
 
-    std::vector<std::string> playoffMatchesIds;
-    std::vector<std::shared_ptr<domain::Match>> playoffMatches;
+    if (matches.size() != 13) {
+        std::println("[MatchDelegate2] ERROR: Expected 13 playoff matches, got {}", matches.size());
+        return;
+    }
 
-    // Guardar cada match en la BD
-    int successCount = 0;
+    // Ids generados de antemano para escribir los avances en el mismo INSERT
     for (auto& match : matches) {
-        auto result = matchRepository->Create(match);
-        if (result) {
-            successCount++;
-            playoffMatchesIds.push_back(*result);
-            
-            auto playoffMatchReadResult = matchRepository->ReadById(*result);
-            if (!playoffMatchReadResult) {
-                std::println("[MatchDelegate2] ERROR reading match: {}", playoffMatchReadResult.error());
-                return;
-            }
-            playoffMatches.push_back(*playoffMatchReadResult);
-        } else {
-            std::println("[MatchDelegate2] ERROR creating match: {}", result.error());
-            return;
-        }
+        match.Id() = domain::GenerateUuid();
     }
 
-    // Generar avances
-    playoffMatches[0]->WinnerNextMatchId() = playoffMatchesIds[6];
-    playoffMatches[1]->WinnerNextMatchId() = playoffMatchesIds[7];
-    playoffMatches[2]->WinnerNextMatchId() = playoffMatchesIds[7];
-
-    playoffMatches[3]->WinnerNextMatchId() = playoffMatchesIds[8];
-    playoffMatches[4]->WinnerNextMatchId() = playoffMatchesIds[9];
-    playoffMatches[5]->WinnerNextMatchId() = playoffMatchesIds[9];
-
-    playoffMatches[6]->WinnerNextMatchId() = playoffMatchesIds[10];
-    playoffMatches[7]->WinnerNextMatchId() = playoffMatchesIds[10];
-
-    playoffMatches[8]->WinnerNextMatchId() = playoffMatchesIds[11];
-    playoffMatches[9]->WinnerNextMatchId() = playoffMatchesIds[11];
-
-    playoffMatches[10]->WinnerNextMatchId() = playoffMatchesIds[12];
-    playoffMatches[11]->WinnerNextMatchId() = playoffMatchesIds[12];
+    // Generar avances: {partido, siguiente partido del ganador}
+    constexpr std::array<std::pair<size_t, size_t>, 12> advances = {{
+        {0, 6}, {1, 7}, {2, 7},
+        {3, 8}, {4, 9}, {5, 9},
+        {6, 10}, {7, 10},
+        {8, 11}, {9, 11},
+        {10, 12}, {11, 12}
+    }};
+    for (const auto& [from, to] : advances) {
+        matches[from].WinnerNextMatchId() = matches[to].Id();
+    }
 
-    // Actualizar equipos
-    for (auto& playoffMatch : playoffMatches) {
-        auto matchFinalUpdateResult = matchRepository->Update(playoffMatch->Id(), *playoffMatch);
-        if (!matchFinalUpdateResult) {
-            std::println("[MatchDelegate2] ERROR finally updating match: {}", matchFinalUpdateResult.error());
-            return;
-        }
+    // Todo el bracket en una sola transacción
+    auto result = matchRepository->CreateMany(matches);
+    if (!result) {
+        std::println("[MatchDelegate2] ERROR creating playoff matches: {}", result.error());
+        return;
     }
 
     std::println("[MatchDelegate2] SUCCESS: Created {}/{} playoff matches for tournament {}",
-                 successCount, matches.size(), tournamentId);
+                 result->size(), matches.size(), tournamentId);
 }
 
 inline int MatchDelegate2::CheckIfInPlayoffs(const std::string& tournamentId) {
@@ -272,14 +301,15 @@ inline int MatchDelegate2::CheckIfInPlayoffs(const std::string& tournamentId) {
     }
     auto tournament = *tournamentResult;
 
-    auto matchesResult = matchRepository->FindByTournamentIdAndRound(tournamentId, domain::RoundType::WILDCARD);
-    if (!matchesResult) {
-        std::println("[MatchDelegate2] ERROR: Cannot get matches: {}", matchesResult.error());
+    // Solo interesa si existe algún WILDCARD, no los matches en sí
+    auto wildcardCount = matchRepository->Count(
+        MatchQuery().WithTournament(tournamentId).WithRound(domain::RoundType::WILDCARD));
+    if (!wildcardCount) {
+        std::println("[MatchDelegate2] ERROR: Cannot get matches: {}", wildcardCount.error());
         return -1;
     }
-    auto matches = *matchesResult;
 
-    if (matches.size() == 0) {
+    if (*wildcardCount == 0) {
         std::println("[MatchDelegate2] Tournmanet {} is still in regular season", tournamentId);
         return 0;
     } else {
@@ -299,30 +329,41 @@ inline void MatchDelegate2::AdvancePlayoffMatch(const std::string& matchId) {
     // Checar si es partido de playoff no super bowl
     if (match->Round() != domain::RoundType::REGULAR && match->Round() != domain::RoundType::SUPERBOWL) {
         // Pasar equipo ganador al siguiente match
-        auto nextMatch = matchRepository->ReadById(match->WinnerNextMatchId());
+        // Los dos partidos que alimentan al siguiente pueden terminar a la vez: si el
+        // otro consumidor escribió primero, se relee el siguiente match y se usa el lugar libre
+        for (int attempt = 1; ; attempt++) {
+            auto nextMatch = matchRepository->ReadById(match->WinnerNextMatchId());
         
-        // Verificar que el match exista
-        if (!nextMatch) {
-            std::println("[MatchDelegate2] ERROR: Cannot get next match: {}", nextMatch.error());
-            return;
-        }
+            // Verificar que el match exista
+            if (!nextMatch) {
+                std::println("[MatchDelegate2] ERROR: Cannot get next match: {}", nextMatch.error());
+                return;
+            }
 
-        // Asignar equipo a espacio disponible
-        if (nextMatch.value()->getHome().id == "") {
-            if (match->MatchScore()->GetWinner() == domain::Winner::HOME) {
-                nextMatch.value()->getHome() = match->getHome();
+            // Asignar equipo a espacio disponible
+            if (nextMatch.value()->getHome().id == "") {
+                if (match->MatchScore()->GetWinner() == domain::Winner::HOME) {
+                    nextMatch.value()->getHome() = match->getHome();
+                } else {
+                    nextMatch.value()->getHome() = domain::Home(match->getVisitor().id, match->getVisitor().name);
+                }
             } else {
-                nextMatch.value()->getHome() = domain::Home(match->getVisitor().id, match->getVisitor().name);
+                if (match->MatchScore()->GetWinner() == domain::Winner::HOME) {
+                    nextMatch.value()->getVisitor() = domain::Visitor(match->getHome().id, match->getHome().name);
+                } else {
+                    nextMatch.value()->getVisitor() = match->getVisitor();
+                }
             }
-        } else {
-            if (match->MatchScore()->GetWinner() == domain::Winner::HOME) {
-                nextMatch.value()->getVisitor() = domain::Visitor(match->getHome().id, match->getHome().name);
-            } else {
-                nextMatch.value()->getVisitor() = match->getVisitor();
+
+            const auto updateResult = matchRepository->Update(nextMatch.value()->Id(), *nextMatch.value());
+            if (updateResult) {
+                return;
+            }
+            if (updateResult.error() != MATCH_VERSION_CONFLICT || attempt == MATCH_UPDATE_ATTEMPTS) {
+                std::println("[MatchDelegate2] ERROR: Cannot update next match: {}", updateResult.error());
+                return;
             }
         }
-
-        matchRepository->Update(nextMatch.value()->Id(), *nextMatch.value());
     }
 }
 
@@ -1,143 +1,39 @@
 import { useMemo, useState } from 'react';
-import type { Match, Group } from '../types';
-
-interface TeamStats {
-    teamId: string;
-    teamName: string;
-    conference: string;
-    division: string;
-    wins: number;
-    losses: number;
-    ties: number;
-    pointsFor: number;
-    pointsAgainst: number;
-}
+import type { Standing } from '../types';
 
 interface RankingsTabProps {
-    matches: Match[];
-    groups: Group[];
+    // Ya ordenada por el servidor (porcentaje de victorias, puntos a favor, diferencia)
+    standings: Standing[];
 }
 
-export default function RankingsTab({ matches, groups }: RankingsTabProps) {
+export default function RankingsTab({ standings }: RankingsTabProps) {
     const [viewMode, setViewMode] = useState<'conference' | 'division'>('conference');
 
-    const standings = useMemo(() => {
-        const stats = new Map<string, TeamStats>();
-
-        // Inicializar stats para todos los equipos
-        groups.forEach(group => {
-            // Usar directamente el campo conference del grupo
-            const conference = group.conference || 'AFC'; // Fallback por si acaso
-
-            group.teams.forEach(team => {
-                stats.set(team.id, {
-                    teamId: team.id,
-                    teamName: team.name,
-                    conference: conference,
-                    division: group.name,
-                    wins: 0,
-                    losses: 0,
-                    ties: 0,
-                    pointsFor: 0,
-                    pointsAgainst: 0,
-                });
-            });
-        });
-
-        // Calcular estadísticas de matches de fase regular
-        matches.forEach(match => {
-            if (match.round !== 'regular' || !match.score) return;
+    const afcStandings = useMemo(() => standings.filter(team => team.conference === 'AFC'), [standings]);
 
-            // Usar la nueva estructura de match con home y visitor
-            const homeId = match.home?.id;
-            const visitorId = match.visitor?.id;
-
-            if (!homeId || !visitorId) return;
-
-            const homeStats = stats.get(homeId);
-            const visitorStats = stats.get(visitorId);
-
-            if (!homeStats || !visitorStats) return;
-
-            homeStats.pointsFor += match.score.home;
-            homeStats.pointsAgainst += match.score.visitor;
-            visitorStats.pointsFor += match.score.visitor;
-            visitorStats.pointsAgainst += match.score.home;
-
-            if (match.score.home > match.score.visitor) {
-                homeStats.wins++;
-                visitorStats.losses++;
-            } else if (match.score.home < match.score.visitor) {
-                homeStats.losses++;
-                visitorStats.wins++;
-            } else {
-                homeStats.ties++;
-                visitorStats.ties++;
-            }
-        });
-
-        return Array.from(stats.values());
-    }, [matches, groups]);
-
-    const afcStandings = useMemo(() => {
-        return standings
-            .filter(team => team.conference === 'AFC')
-            .sort((a, b) => {
-                const aWinPct = (a.wins + 0.5 * a.ties) / (a.wins + a.losses + a.ties || 1);
-                const bWinPct = (b.wins + 0.5 * b.ties) / (b.wins + b.losses + b.ties || 1);
-
-                if (aWinPct !== bWinPct) return bWinPct - aWinPct;
-                if (a.pointsFor !== b.pointsFor) return b.pointsFor - a.pointsFor;
-                return (b.pointsFor - b.pointsAgainst) - (a.pointsFor - a.pointsAgainst);
-            });
-    }, [standings]);
-
-    const nfcStandings = useMemo(() => {
-        return standings
-            .filter(team => team.conference === 'NFC')
-            .sort((a, b) => {
-                const aWinPct = (a.wins + 0.5 * a.ties) / (a.wins + a.losses + a.ties || 1);
-                const bWinPct = (b.wins + 0.5 * b.ties) / (b.wins + b.losses + b.ties || 1);
-
-                if (aWinPct !== bWinPct) return bWinPct - aWinPct;
-                if (a.pointsFor !== b.pointsFor) return b.pointsFor - a.pointsFor;
-                return (b.pointsFor - b.pointsAgainst) - (a.pointsFor - a.pointsAgainst);
-            });
-    }, [standings]);
+    const nfcStandings = useMemo(() => standings.filter(team => team.conference === 'NFC'), [standings]);
 
     const divisionStandings = useMemo(() => {
-        const divisions = new Map<string, TeamStats[]>();
+        const divisions = new Map<string, Standing[]>();
         
         standings.forEach(team => {
-            const key = `${team.conference}-${team.division}`;
+            const key = `${team.conference}-${team.groupId}`;
             if (!divisions.has(key)) {
                 divisions.set(key, []);
             }
             divisions.get(key)!.push(team);
         });
 
-        // Sort teams within each division
-        divisions.forEach((teams, key) => {
-            teams.sort((a, b) => {
-                const aWinPct = (a.wins + 0.5 * a.ties) / (a.wins + a.losses + a.ties || 1);
-                const bWinPct = (b.wins + 0.5 * b.ties) / (b.wins + b.losses + b.ties || 1);
-
-                if (aWinPct !== bWinPct) return bWinPct - aWinPct;
-                if (a.pointsFor !== b.pointsFor) return b.pointsFor - a.pointsFor;
-                return (b.pointsFor - b.pointsAgainst) - (a.pointsFor - a.pointsAgainst);
-            });
-        });
-
         return divisions;
     }, [standings]);
 
-    const getWinPercentage = (team: TeamStats) => {
+    const getWinPercentage = (team: Standing) => {
         const total = team.wins + team.losses + team.ties;
         if (total === 0) return '0.000';
         return ((team.wins + 0.5 * team.ties) / total).toFixed(3);
     };
 
-    const renderStandingsTable = (teams: TeamStats[], conference: string) => (
+    const renderStandingsTable = (teams: Standing[], conference: string) => (
         <div style={{ marginBottom: '2rem' }}>
             <h3 style={{ marginBottom: '1rem', color: '#1e3a8a' }}>{conference} Conference</h3>
             <div style={{ overflowX: 'auto' }}>
@@ -1,7 +1,7 @@
 import { useState, useEffect } from 'react';
 import { useParams, useNavigate } from 'react-router-dom';
-import { tournamentsApi, groupsApi, matchesApi, teamsApi } from '../services/api';
-import type { Tournament, Group, Match, Team } from '../types';
+import { tournamentsApi, groupsApi, matchesApi, teamsApi, standingsApi } from '../services/api';
+import type { Tournament, Group, Match, Team, Standing } from '../types';
 import RankingsTab from './RankingsTab';
 
 export default function TournamentDetailPage() {
@@ -10,6 +10,7 @@ export default function TournamentDetailPage() {
     const [tournament, setTournament] = useState<Tournament | null>(null);
     const [groups, setGroups] = useState<Group[]>([]);
     const [matches, setMatches] = useState<Match[]>([]);
+    const [standings, setStandings] = useState<Standing[]>([]);
     const [allTeams, setAllTeams] = useState<Team[]>([]);
     const [loading, setLoading] = useState(true);
     const [error, setError] = useState('');
@@ -39,16 +40,18 @@ export default function TournamentDetailPage() {
 
     const loadTournamentData = async () => {
         try {
-            const [tournamentRes, groupsRes, matchesRes, teamsRes] = await Promise.all([
+            const [tournamentRes, groupsRes, matchesRes, teamsRes, standingsRes] = await Promise.all([
                 tournamentsApi.getById(tournamentId!),
                 groupsApi.getAll(tournamentId!),
                 matchesApi.getAll(tournamentId!),
                 teamsApi.getAll(),
+                standingsApi.get(tournamentId!),
             ]);
 
             setTournament(tournamentRes.data);
             setGroups(groupsRes.data);
             setMatches(matchesRes.data);
+            setStandings(standingsRes.data);
             setAllTeams(teamsRes.data);
             setError('');
         } catch (err: any) {
@@ -329,7 +332,7 @@ export default function TournamentDetailPage() {
             )}
 
             {activeTab === 'rankings' && (
-                <RankingsTab matches={matches} groups={groups} />
+                <RankingsTab standings={standings} />
             )}
 
             {/* Group Modal */}
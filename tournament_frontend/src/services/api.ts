@@ -1,5 +1,5 @@
 import axios from 'axios';
-import type { Team, Tournament, Group, Match, Score } from '../types';
+import type { Team, Tournament, Group, Match, Score, Standing } from '../types';
 
 const API_BASE = '/api'; // Usa el proxy de Vite
 
@@ -10,9 +10,23 @@ const api = axios.create({
     },
 });
 
+// Los listados de equipos y torneos vienen paginados: se sigue el enlace "next" hasta la última página
+const nextPage = (link: unknown) =>
+    typeof link === 'string' ? link.match(/<([^>]+)>;\s*rel="next"/)?.[1] : undefined;
+
+async function getAllPages<T>(path: string) {
+    let response = await api.get<T[]>(path);
+    const data = [...response.data];
+    for (let next = nextPage(response.headers['link']); next; next = nextPage(response.headers['link'])) {
+        response = await api.get<T[]>(next);
+        data.push(...response.data);
+    }
+    return { ...response, data };
+}
+
 // Teams
 export const teamsApi = {
-    getAll: () => api.get<Team[]>('/teams'),
+    getAll: () => getAllPages<Team>('/teams'),
     getById: (id: string) => api.get<Team>(`/teams/${id}`),
     create: (team: Omit<Team, 'id'>) => api.post<void>('/teams', team),
     update: (id: string, team: Team) => api.patch<void>(`/teams/${id}`, team),
@@ -21,7 +35,7 @@ export const teamsApi = {
 
 // Tournaments
 export const tournamentsApi = {
-    getAll: () => api.get<Tournament[]>('/tournaments'),
+    getAll: () => getAllPages<Tournament>('/tournaments'),
     getById: (id: string) => api.get<Tournament>(`/tournaments/${id}`),
     create: (tournament: Omit<Tournament, 'id'>) => api.post<void>('/tournaments', tournament),
     update: (id: string, tournament: Tournament) => api.patch<void>(`/tournaments/${id}`, tournament),
@@ -55,4 +69,9 @@ export const matchesApi = {
         api.patch<void>(`/tournaments/${tournamentId}/matches/${matchId}`, { score }),
 };
 
+// Standings: la tabla la mantiene el servidor; se actualiza poco después de cada marcador
+export const standingsApi = {
+    get: (tournamentId: string) => api.get<Standing[]>(`/tournaments/${tournamentId}/standings`),
+};
+
 export default api;
\ No newline at end of file
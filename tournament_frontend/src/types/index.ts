@@ -33,6 +33,20 @@ export interface Score {
     visitor: number;
 }
 
+// Fila de GET /tournaments/{id}/standings
+export interface Standing {
+    teamId: string;
+    teamName: string;
+    groupId: string;
+    division: string;
+    conference: 'AFC' | 'NFC';
+    wins: number;
+    losses: number;
+    ties: number;
+    pointsFor: number;
+    pointsAgainst: number;
+}
+
 export type RoundType = 'regular' | 'quarterfinals' | 'semifinals' | 'final';
 
 // En tournament_frontend/src/types/index.ts
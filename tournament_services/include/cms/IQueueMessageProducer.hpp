@@ -8,6 +8,8 @@ class IQueueMessageProducer
 public:
     virtual ~IQueueMessageProducer() = default;
     virtual void SendMessage(const std::string_view& message, const std::string_view& queue) = 0;
+    // Every current subscriber of the topic gets its own copy; with none, the message is dropped
+    virtual void Publish(const std::string_view& message, const std::string_view& topic) = 0;
 };
  
 
@@ -25,6 +25,17 @@ public:
         const auto brokerMessage = std::unique_ptr<cms::TextMessage>(session->createTextMessage(message.data()));
         producer->send(brokerMessage.get());
     }
+
+    void Publish(const std::string_view& message, const std::string_view& topic) override {
+        auto session = connectionManager->CreateSession();
+        const auto destination = std::unique_ptr<cms::Destination>(session->createTopic(topic.data()));
+        auto producer = std::unique_ptr<cms::MessageProducer>(session->createProducer(destination.get()));
+        // Los suscriptores solo invalidan cachés; un aviso perdido lo cubre el TTL
+        producer->setDeliveryMode( cms::DeliveryMode::NON_PERSISTENT );
+
+        const auto brokerMessage = std::unique_ptr<cms::TextMessage>(session->createTextMessage(message.data()));
+        producer->send(brokerMessage.get());
+    }
 };
 
 #endif //SERVICE_MESSAGE_PRODUCER_HPP
\ No newline at end of file
@@ -0,0 +1,43 @@
+#ifndef SERVICE_TOURNAMENT_EVENT_SUBSCRIBER_HPP
+#define SERVICE_TOURNAMENT_EVENT_SUBSCRIBER_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cms/TopicMessageListener.hpp"
+#include "persistence/repository/CacheRegistry.hpp"
+
+// Cada réplica escucha los eventos de torneo de todas (incluida ella misma) y saca
+// el torneo de su caché local. El mensaje es el id del torneo.
+class TournamentEventSubscriber : public TopicMessageListener {
+    std::shared_ptr<CacheRegistry> caches;
+public:
+    static constexpr const char* CACHE = "tournament";
+    static inline const std::vector<std::string> TOPICS{"tournament.created", "tournament.updated", "tournament.deleted"};
+
+    TournamentEventSubscriber(const std::shared_ptr<ConnectionManager>& connectionManager,
+                              const std::shared_ptr<CacheRegistry>& caches);
+    ~TournamentEventSubscriber() override;
+
+    void processMessage(const std::string& message) override;
+};
+
+inline TournamentEventSubscriber::TournamentEventSubscriber(
+    const std::shared_ptr<ConnectionManager>& connectionManager,
+    const std::shared_ptr<CacheRegistry>& caches)
+    : TopicMessageListener(connectionManager),
+      caches(caches) {}
+
+inline TournamentEventSubscriber::~TournamentEventSubscriber() {
+    Stop();
+}
+
+inline void TournamentEventSubscriber::processMessage(const std::string& message) {
+    if (message.empty()) {
+        return;
+    }
+    caches->Evict(CACHE, message);
+}
+
+#endif //SERVICE_TOURNAMENT_EVENT_SUBSCRIBER_HPP
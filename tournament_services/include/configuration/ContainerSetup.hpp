@@ -10,28 +10,71 @@
 #include <nlohmann/json.hpp>
 #include <memory>
 
+#include "persistence/repository/IPagedRepository.hpp"
 #include "persistence/repository/IRepository.hpp"
 #include "persistence/repository/TeamRepository.hpp"
 #include "RunConfiguration.hpp"
+#include "configuration/DatabaseConfiguration.hpp"
+#include "configuration/CacheConfiguration.hpp"
 #include "cms/ConnectionManager.hpp"
 #include "delegate/TeamDelegate.hpp"
 #include "controller/TeamController.hpp"
 #include "controller/TournamentController.hpp"
 #include "delegate/TournamentDelegate.hpp"
 #include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/AsyncConnectionProvider.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
 #include "persistence/repository/GroupRepository.hpp"
 #include "persistence/repository/MatchRepository.hpp"
+#include "persistence/repository/AsyncMatchRepository.hpp"
+#include "persistence/repository/AsyncTournamentRepository.hpp"
+#include "persistence/repository/CachedRepository.hpp"
+#include "persistence/repository/CacheRegistry.hpp"
 #include "cms/QueueMessageProducer.hpp"
 #include "cms/QueueResolver.hpp"
+#include "cms/TournamentEventSubscriber.hpp"
 #include "delegate/IGroupDelegate.hpp"
 #include "delegate/GroupDelegate.hpp"
 #include "controller/GroupController.hpp"
 #include "controller/MatchController.hpp"
+#include "controller/StatementMetricsController.hpp"
+#include "controller/CacheMetricsController.hpp"
+#include "controller/PoolMetricsController.hpp"
+#include "controller/ResponseCache.hpp"
 #include "delegate/MatchDelegate.hpp"
+#include "delegate/StandingsDelegate.hpp"
+#include "controller/StandingsController.hpp"
 #include "domain/NFLStrategy.hpp"
 
 namespace config {
+    // Registra Repository como IRepository<Type> y como IPagedRepository<Type>. Si "cacheConfig"
+    // tiene una entrada con ese nombre, IRepository<Type> resuelve un CachedRepository encima del
+    // repositorio, anotado en el CacheRegistry para que los eventos de otros nodos lo invaliden;
+    // los listados paginados siguen yendo directo al repositorio.
+    template<typename Repository, typename Type>
+    void registerRepository(Hypodermic::ContainerBuilder& builder, const nlohmann::json& configuration, const std::string& cacheName) {
+        using Interface = IRepository<Type, std::string, std::expected<std::string, std::string>>;
+        using Pages = IPagedRepository<Type, std::string>;
+        if (!configuration.contains("cacheConfig") || !configuration["cacheConfig"].contains(cacheName)) {
+            builder.registerType<Repository>().template as<Interface>().template as<Pages>().singleInstance();
+            return;
+        }
+
+        const auto cacheConfiguration = configuration["cacheConfig"][cacheName].get<CacheConfiguration>();
+        builder.registerType<Repository>().template as<Pages>().asSelf().singleInstance();
+        builder.registerInstanceFactory([cacheName, cacheConfiguration](Hypodermic::ComponentContext& context) {
+                auto cache = std::make_shared<CachedRepository<Type>>(context.resolve<Repository>(), cacheName, cacheConfiguration);
+                context.resolve<CacheRegistry>()->Register(cacheName, [weak = std::weak_ptr(cache)](const std::string& id) {
+                    if (const auto cached = weak.lock()) {
+                        cached->Evict(id);
+                    }
+                });
+                return cache;
+            })
+            .template as<Interface>()
+            .singleInstance();
+    }
+
     inline std::shared_ptr<Hypodermic::Container> containerSetup() {
         Hypodermic::ContainerBuilder builder;
 
@@ -42,10 +85,13 @@ namespace config {
         builder.registerInstance(appConfig);
 
         std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(
-            configuration["databaseConfig"]["connectionString"].get<std::string>(),
-            configuration["databaseConfig"]["poolSize"].get<size_t>());
+            configuration["databaseConfig"].get<DatabaseConfiguration>());
         builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
 
+        // Un pool asíncrono por io_context de Crow; el tope del nodo se reparte entre ellos
+        builder.registerInstance(std::make_shared<AsyncConnectionProvider>(
+            configuration["databaseConfig"].get<DatabaseConfiguration>(), static_cast<size_t>(appConfig->concurrency)));
+
         builder.registerType<ConnectionManager>()
             .onActivated([configuration](Hypodermic::ComponentContext&, const std::shared_ptr<ConnectionManager>& instance) {
                 instance->initialize(configuration["activemq"]["broker-url"].get<std::string>());
@@ -56,15 +102,38 @@ namespace config {
         builder.registerType<QueueResolver>().as<IResolver<IQueueMessageProducer> >().named("queueResolver").
                 singleInstance();
 
-        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string, std::expected<std::string, std::string>> >().singleInstance();
+        builder.registerInstance(std::make_shared<CacheRegistry>());
+        builder.registerType<TournamentEventSubscriber>().singleInstance();
+
+        builder.registerType<TeamRepository>()
+            .as<IRepository<domain::Team, std::string, std::expected<std::string, std::string>> >()
+            .as<IPagedRepository<domain::Team, std::string>>()
+            .singleInstance();
         builder.registerType<GroupRepository>().as<IGroupRepository>().singleInstance();
         builder.registerType<MatchRepository>().as<IMatchRepository>().singleInstance();
+        builder.registerType<AsyncMatchRepository>().as<IAsyncMatchRepository>().singleInstance();
+        builder.registerType<AsyncTournamentRepository>().as<IAsyncTournamentRepository>().singleInstance();
+
+        // Cuerpos de los listados por torneo; un torneo borrado en otro nodo también los suelta
+        const auto responseCacheConfiguration = configuration.contains("cacheConfig") && configuration["cacheConfig"].contains(ResponseCache::CACHE)
+            ? configuration["cacheConfig"][ResponseCache::CACHE].get<CacheConfiguration>()
+            : CacheConfiguration{};
+        builder.registerInstanceFactory([responseCacheConfiguration](Hypodermic::ComponentContext& context) {
+                auto cache = std::make_shared<ResponseCache>(responseCacheConfiguration);
+                context.resolve<CacheRegistry>()->Register(TournamentEventSubscriber::CACHE, [weak = std::weak_ptr(cache)](const std::string& id) {
+                    if (const auto cached = weak.lock()) {
+                        cached->Evict(id);
+                    }
+                });
+                return cache;
+            })
+            .singleInstance();
 
         builder.registerType<TeamDelegate>().as<ITeamDelegate>().singleInstance();
         builder.registerType<TeamController>().singleInstance();
 
-        builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>> >().
-                singleInstance();
+        // Casi todas las operaciones empiezan leyendo el torneo
+        registerRepository<TournamentRepository, domain::Tournament>(builder, configuration, TournamentEventSubscriber::CACHE);
 
         builder.registerType<TournamentDelegate>()
                 .as<ITournamentDelegate>()
@@ -87,6 +156,19 @@ namespace config {
 
         builder.registerType<MatchController>().singleInstance();
 
+        builder.registerType<StandingsRepository>().singleInstance();
+        builder.registerType<StandingsDelegate>().as<IStandingsDelegate>().singleInstance();
+        builder.registerType<StandingsController>().singleInstance();
+
+        // Las mismas métricas en las que registran los repositorios
+        builder.registerInstance(StatementMetrics::Global());
+        builder.registerType<StatementMetricsController>().singleInstance();
+
+        builder.registerInstance(CacheMetrics::Global());
+        builder.registerType<CacheMetricsController>().singleInstance();
+
+        builder.registerType<PoolMetricsController>().singleInstance();
+
         return builder.build();
     }
 }
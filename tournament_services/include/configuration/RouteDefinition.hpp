@@ -61,4 +61,22 @@ struct Controller## _##Method##_RouteRegistrator { \
 }; \
 static Controller##_##Method##_RouteRegistrator global_##Controller##_##Method##_registrator;
 
+// For handlers that finish later: the method receives the crow::response and must call end() on it
+#define REGISTER_ASYNC_ROUTE(Controller, Method, Path, HttpMethod) \
+struct Controller## _##Method##_RouteRegistrator { \
+    Controller##_##Method##_RouteRegistrator() { \
+        routeRegistry().push_back({ Path, HttpMethod, \
+            [](crow::SimpleApp& app, const std::shared_ptr<Hypodermic::Container>& container) { \
+                    CROW_ROUTE(app, Path).methods(HttpMethod)( \
+                        [container](const crow::request& request, crow::response& response, auto&&... args) { \
+                        auto controller = container->resolve<Controller>(); \
+                        controller->Method(request, response, std::forward<decltype(args)>(args)...); \
+                    } \
+                ); \
+            } \
+        }); \
+    } \
+}; \
+static Controller##_##Method##_RouteRegistrator global_##Controller##_##Method##_registrator;
+
 #endif //RESTAPI_ROUTE_DEFINITION_HPP
@@ -0,0 +1,23 @@
+//
+// Created by developer on 10/16/26.
+//
+
+#ifndef RESTAPI_CACHE_METRICS_CONTROLLER_HPP
+#define RESTAPI_CACHE_METRICS_CONTROLLER_HPP
+
+#include <memory>
+#include <crow.h>
+
+#include "persistence/configuration/CacheMetrics.hpp"
+
+// Expone aciertos y fallos de los cachés en proceso para ajustar su tamaño y TTL
+class CacheMetricsController {
+    std::shared_ptr<CacheMetrics> metrics;
+public:
+    explicit CacheMetricsController(const std::shared_ptr<CacheMetrics>& metrics);
+
+    [[nodiscard]] crow::response GetCacheMetrics() const;
+    [[nodiscard]] crow::response ResetCacheMetrics() const;
+};
+
+#endif //RESTAPI_CACHE_METRICS_CONTROLLER_HPP
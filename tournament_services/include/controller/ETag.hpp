@@ -0,0 +1,62 @@
+#ifndef TOURNAMENTS_ETAG_HPP
+#define TOURNAMENTS_ETAG_HPP
+
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <crow.h>
+
+// GET condicional de los listados que los clientes consultan en ciclo. El ETag sale de la
+// versión de cambios del torneo, que se lee antes que el listado: si una escritura cae
+// entre las dos lecturas el cuerpo es más nuevo que su ETag y el siguiente GET lo vuelve
+// a descargar, nunca al revés. La etiqueta es débil (W/): el mismo listado se sirve en
+// JSON y en gzip, bytes distintos con el mismo contenido.
+inline constexpr const char* ETAG_HEADER = "etag";
+inline constexpr const char* IF_NONE_MATCH_HEADER = "if-none-match";
+
+inline std::string ListingETag(std::string_view listing, int64_t version) {
+    return std::format("W/\"{}-{}\"", listing, version);
+}
+
+// If-None-Match admite varias etiquetas separadas por coma y "*". Compara como pide la
+// norma para If-None-Match (comparación débil): sin tener en cuenta el prefijo W/.
+inline bool ETagMatches(std::string_view ifNoneMatch, std::string_view etag) {
+    if (etag.starts_with("W/")) {
+        etag.remove_prefix(2);
+    }
+    while (!ifNoneMatch.empty()) {
+        const auto comma = ifNoneMatch.find(',');
+        auto candidate = ifNoneMatch.substr(0, comma);
+        ifNoneMatch = comma == std::string_view::npos ? std::string_view{} : ifNoneMatch.substr(comma + 1);
+
+        const auto first = candidate.find_first_not_of(" \t");
+        if (first == std::string_view::npos) {
+            continue;
+        }
+        candidate = candidate.substr(first, candidate.find_last_not_of(" \t") - first + 1);
+        if (candidate.starts_with("W/")) {
+            candidate.remove_prefix(2);
+        }
+        if (candidate == "*" || candidate == etag) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// no-cache: el navegador guarda la respuesta pero la revalida con If-None-Match en cada GET
+inline void AddETag(crow::response& response, const std::string& etag) {
+    response.add_header(ETAG_HEADER, etag);
+    response.add_header("cache-control", "no-cache");
+}
+
+// Lleva el mismo vary que el 200 que revalida
+inline crow::response NotModified(const std::string& etag) {
+    crow::response response{crow::NOT_MODIFIED};
+    AddETag(response, etag);
+    response.add_header("vary", "accept-encoding");
+    return response;
+}
+
+#endif //TOURNAMENTS_ETAG_HPP
@@ -7,11 +7,14 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <crow.h>
 #include <nlohmann/json.hpp>
 
 #include "configuration/RouteDefinition.hpp"
+#include "controller/ETag.hpp"
+#include "controller/ResponseCache.hpp"
 #include "delegate/IGroupDelegate.hpp"
 #include "domain/Group.hpp"
 #include "domain/Utilities.hpp"
@@ -21,18 +24,20 @@ static const std::regex ID_VALUE3("[A-Za-z0-9\\-]+");
 class GroupController
 {
     std::shared_ptr<IGroupDelegate> groupDelegate;
+    std::shared_ptr<ResponseCache> responseCache;
 public:
-    GroupController(const std::shared_ptr<IGroupDelegate>& delegate);
+    GroupController(const std::shared_ptr<IGroupDelegate>& delegate, const std::shared_ptr<ResponseCache>& responseCache);
     ~GroupController();
     crow::response CreateGroup(const crow::request& request, const std::string& tournamentId) const;
-    crow::response GetGroups(const std::string& tournamentId) const;
+    crow::response GetGroups(const crow::request& request, const std::string& tournamentId) const;
     crow::response GetGroup(const std::string& tournamentId, const std::string& groupId) const;
     crow::response UpdateGroup(const crow::request& request, const std::string& tournamentId, const std::string& groupId) const;
     crow::response DeleteGroup(const std::string& tournamentId, const std::string& groupId) const;
     crow::response UpdateTeams(const crow::request& request, const std::string& tournamentId, const std::string& groupId) const;
 };
 
-GroupController::GroupController(const std::shared_ptr<IGroupDelegate>& delegate) : groupDelegate(std::move(delegate)) {}
+GroupController::GroupController(const std::shared_ptr<IGroupDelegate>& delegate, const std::shared_ptr<ResponseCache>& responseCache)
+    : groupDelegate(delegate), responseCache(responseCache) {}
 
 GroupController::~GroupController()
 {
@@ -53,6 +58,7 @@ crow::response GroupController::CreateGroup(const crow::request& request, const
             return {crow::CONFLICT, result.error()};
         }
 
+        responseCache->Evict(tournamentId);
         crow::response response{crow::CREATED};
         response.add_header("location", *result);
 
@@ -62,20 +68,44 @@ crow::response GroupController::CreateGroup(const crow::request& request, const
     }
 }
 
-crow::response GroupController::GetGroups(const std::string& tournamentId) const {
+crow::response GroupController::GetGroups(const crow::request& request, const std::string& tournamentId) const {
     if (!std::regex_match(tournamentId, ID_VALUE3)) {
         return {crow::BAD_REQUEST, "Invalid tournament ID format"};
     }
 
+    // Con If-None-Match igual a la versión vigente no se leen ni serializan los grupos, y
+    // con esa versión ya en caché se copia el cuerpo guardado
+    const bool gzip = AcceptsGzip(request.get_header_value("accept-encoding"));
+    const auto version = groupDelegate->GetGroupsVersion(tournamentId);
+    std::optional<std::string> etag;
+    if (version) {
+        etag = ListingETag("groups", *version);
+        if (ETagMatches(request.get_header_value(IF_NONE_MATCH_HEADER), *etag)) {
+            return NotModified(*etag);
+        }
+        if (const auto cached = responseCache->Find(tournamentId, "groups", *version)) {
+            crow::response response = CachedBodyResponse(*cached, gzip);
+            AddETag(response, *etag);
+            return response;
+        }
+    }
+
     const auto result = groupDelegate->GetGroups(tournamentId);
     
     if (!result) {
         return {crow::INTERNAL_SERVER_ERROR, result.error()};
     }
 
-    const nlohmann::json body = *result;
-    crow::response response{crow::OK, body.dump()};
-    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+    std::string body = domain::ToJsonString(*result);
+    if (!version) {
+        crow::response response{crow::OK, std::move(body)};
+        response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+        return response;
+    }
+
+    const auto stored = responseCache->Store(tournamentId, "groups", *version, std::move(body));
+    crow::response response = CachedBodyResponse(*stored, gzip);
+    AddETag(response, *etag);
 
     return response;
 }
@@ -135,6 +165,7 @@ crow::response GroupController::UpdateGroup(const crow::request& request, const
             return {crow::INTERNAL_SERVER_ERROR, result.error()};
         }
 
+        responseCache->Evict(tournamentId);
         return crow::response{crow::NO_CONTENT};
     } catch (const nlohmann::json::exception& e) {
         return {crow::BAD_REQUEST, "Invalid JSON"};
@@ -159,6 +190,7 @@ crow::response GroupController::DeleteGroup(const std::string& tournamentId, con
         return {crow::INTERNAL_SERVER_ERROR, result.error()};
     }
 
+    responseCache->Evict(tournamentId);
     return crow::response{crow::NO_CONTENT};
 }
 
@@ -186,6 +218,7 @@ crow::response GroupController::UpdateTeams(const crow::request& request, const
             return {409, result.error()};
         }
 
+        responseCache->Evict(tournamentId);
         return crow::response{crow::NO_CONTENT};
     } catch (const nlohmann::json::exception& e) {
         return {crow::BAD_REQUEST, "Invalid JSON"};
@@ -2,26 +2,44 @@
 #define TOURNAMENTS_MATCHCONTROLLER_HPP
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <asio.hpp>
 #include <crow.h>
+#include "controller/ResponseCache.hpp"
 #include "delegate/IMatchDelegate.h"
 
 class MatchController {
     std::shared_ptr<IMatchDelegate> matchDelegate;
+    std::shared_ptr<ResponseCache> responseCache;
+
+    asio::awaitable<crow::response> MatchesResponse(std::string tournamentId,
+                                                    std::optional<std::string> filter,
+                                                    std::string ifNoneMatch,
+                                                    bool gzip) const;
+
+    asio::awaitable<crow::response> UpdateScoreResponse(std::string tournamentId,
+                                                        std::string matchId,
+                                                        domain::Score score) const;
 
 public:
-    explicit MatchController(std::shared_ptr<IMatchDelegate> delegate);
+    MatchController(std::shared_ptr<IMatchDelegate> delegate, std::shared_ptr<ResponseCache> responseCache);
 
     // GET /tournaments/<tournamentId>/matches
-    crow::response GetMatches(const crow::request& request, const std::string& tournamentId) const;
+    // Asíncrono: la respuesta se completa con response.end() cuando Postgres contesta.
+    // Con If-None-Match igual al ETag vigente responde 304 sin leer ni serializar los matches;
+    // si el cuerpo de esa versión ya está en caché lo copia, en gzip cuando el cliente lo acepta.
+    void GetMatches(const crow::request& request, crow::response& response,
+                    const std::string& tournamentId) const;
 
     // GET /tournaments/<tournamentId>/matches/<matchId>
     crow::response GetMatch(const std::string& tournamentId, const std::string& matchId) const;
 
     // PATCH /tournaments/<tournamentId>/matches/<matchId>
-    crow::response UpdateMatchScore(const crow::request& request,
-                                    const std::string& tournamentId,
-                                    const std::string& matchId) const;
+    // Asíncrono, igual que GetMatches
+    void UpdateMatchScore(const crow::request& request, crow::response& response,
+                          const std::string& tournamentId,
+                          const std::string& matchId) const;
 };
 
 #endif // TOURNAMENTS_MATCHCONTROLLER_HPP
\ No newline at end of file
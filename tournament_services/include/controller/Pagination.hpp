@@ -0,0 +1,57 @@
+#ifndef TOURNAMENTS_PAGINATION_HPP
+#define TOURNAMENTS_PAGINATION_HPP
+
+#include <charconv>
+#include <cstring>
+#include <expected>
+#include <format>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <crow.h>
+
+// Paginación por llave de los listados: ?limit=N&after=<último id de la página anterior>.
+// Cada respuesta trae a lo más MAX_PAGE_SIZE elementos, sin importar el tamaño de la tabla.
+inline constexpr size_t DEFAULT_PAGE_SIZE = 100;
+inline constexpr size_t MAX_PAGE_SIZE = 1000;
+
+static const std::regex PAGE_CURSOR("[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{12}");
+
+struct PageRequest {
+    std::optional<std::string> after;
+    size_t limit = DEFAULT_PAGE_SIZE;
+};
+
+inline std::expected<PageRequest, std::string> ParsePageRequest(const crow::request& request) {
+    PageRequest page;
+
+    if (const char* limit = request.url_params.get("limit")) {
+        const char* end = limit + std::strlen(limit);
+        size_t value = 0;
+        const auto [parsedEnd, error] = std::from_chars(limit, end, value);
+        if (error != std::errc{} || parsedEnd != end || value == 0 || value > MAX_PAGE_SIZE) {
+            return std::unexpected(std::format("Invalid limit value. Must be between 1 and {}", MAX_PAGE_SIZE));
+        }
+        page.limit = value;
+    }
+
+    if (const char* after = request.url_params.get("after")) {
+        if (!std::regex_match(after, PAGE_CURSOR)) {
+            return std::unexpected("Invalid after value. Must be an id");
+        }
+        page.after = std::string(after);
+    }
+
+    return page;
+}
+
+// Una página llena puede tener continuación; el cliente la pide con el enlace "next"
+inline void AddNextPageLink(crow::response& response, std::string_view path, const PageRequest& page,
+                            size_t returned, const std::string& lastId) {
+    if (returned == page.limit) {
+        response.add_header("link", std::format("<{}?limit={}&after={}>; rel=\"next\"", path, page.limit, lastId));
+    }
+}
+
+#endif //TOURNAMENTS_PAGINATION_HPP
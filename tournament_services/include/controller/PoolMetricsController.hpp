@@ -0,0 +1,23 @@
+//
+// Created by developer on 10/16/26.
+//
+
+#ifndef RESTAPI_POOL_METRICS_CONTROLLER_HPP
+#define RESTAPI_POOL_METRICS_CONTROLLER_HPP
+
+#include <memory>
+#include <crow.h>
+
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+
+// Expone el estado de los pools de conexiones (primario y réplica) para ajustar su
+// tamaño: esperas, timeouts, crecimiento y conexiones cerradas por inactividad
+class PoolMetricsController {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+public:
+    explicit PoolMetricsController(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
+
+    [[nodiscard]] crow::response GetPoolMetrics() const;
+};
+
+#endif //RESTAPI_POOL_METRICS_CONTROLLER_HPP
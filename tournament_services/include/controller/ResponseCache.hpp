@@ -0,0 +1,212 @@
+#ifndef TOURNAMENTS_RESPONSECACHE_HPP
+#define TOURNAMENTS_RESPONSECACHE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <crow.h>
+#include <zlib.h>
+
+#include "configuration/CacheConfiguration.hpp"
+#include "persistence/configuration/CacheMetrics.hpp"
+
+// Comprime en formato gzip (cabecera y CRC incluidos), listo para content-encoding: gzip
+inline std::string GzipCompress(std::string_view data) {
+    z_stream stream{};
+    // 15 bits de ventana + 16 pide la envoltura gzip en vez de zlib
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw std::runtime_error("gzip: deflateInit2 failed");
+    }
+
+    std::string compressed(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = static_cast<uInt>(compressed.size());
+
+    const int result = deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    if (result != Z_STREAM_END) {
+        throw std::runtime_error("gzip: deflate did not finish");
+    }
+    return compressed;
+}
+
+// Accept-Encoding con gzip (o "*") y sin q=0
+inline bool AcceptsGzip(std::string_view acceptEncoding) {
+    while (!acceptEncoding.empty()) {
+        const auto comma = acceptEncoding.find(',');
+        auto coding = acceptEncoding.substr(0, comma);
+        acceptEncoding = comma == std::string_view::npos ? std::string_view{} : acceptEncoding.substr(comma + 1);
+
+        std::string_view parameters;
+        if (const auto semicolon = coding.find(';'); semicolon != std::string_view::npos) {
+            parameters = coding.substr(semicolon + 1);
+            coding = coding.substr(0, semicolon);
+        }
+        const auto first = coding.find_first_not_of(" \t");
+        if (first == std::string_view::npos) {
+            continue;
+        }
+        coding = coding.substr(first, coding.find_last_not_of(" \t") - first + 1);
+        if (coding != "gzip" && coding != "*") {
+            continue;
+        }
+        const auto q = parameters.find("q=");
+        if (q == std::string_view::npos) {
+            return true;
+        }
+        const auto weight = parameters.substr(q + 2);
+        return weight.find_first_not_of("0. \t") != std::string_view::npos;
+    }
+    return false;
+}
+
+// Cuerpos ya serializados de los listados de cada torneo (matches, grupos), en JSON y en
+// gzip. Cada listado guarda la versión de cambios con que se leyó; una búsqueda con otra
+// versión no acierta, así que una escritura de cualquier nodo (incluido el consumer) deja
+// de servirse en cuanto sube la versión, sin esperar aviso. Evict libera un torneo entero
+// y lo llaman las escrituras de este nodo. Shards con su propio lock, tope de torneos por
+// shard (sale el menos usado) y TTL para soltar los torneos que nadie consulta.
+class ResponseCache {
+public:
+    static constexpr const char* CACHE = "response";
+
+    struct Body {
+        std::string json;
+        std::string gzip;
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Listing {
+        int64_t version;
+        std::shared_ptr<const Body> body;
+    };
+
+    struct Entry {
+        std::map<std::string, Listing, std::less<>> listings;
+        Clock::time_point expiresAt;
+        std::list<std::string>::iterator recency;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<std::string, Entry> entries;
+        // Más reciente al frente
+        std::list<std::string> recency;
+    };
+
+    std::chrono::milliseconds ttl;
+    std::vector<std::unique_ptr<Shard>> shards;
+    size_t shardCapacity = 1;
+    // Dueño de los contadores; el caché puede vivir más que quien le pasó las métricas
+    std::shared_ptr<CacheMetrics> metrics;
+    CacheMetrics::Counters& counters;
+
+    Shard& ShardFor(const std::string& tournamentId) {
+        return *shards[std::hash<std::string>{}(tournamentId) % shards.size()];
+    }
+
+public:
+    explicit ResponseCache(const config::CacheConfiguration& configuration,
+                           const std::shared_ptr<CacheMetrics>& metrics = CacheMetrics::Global())
+        : ttl(configuration.ttlMs),
+          shards(std::max<size_t>(1, configuration.shards)),
+          metrics(metrics),
+          counters(this->metrics->For(CACHE)) {
+        for (auto& shard : shards) {
+            shard = std::make_unique<Shard>();
+        }
+        shardCapacity = std::max<size_t>(1, (configuration.capacity + shards.size() - 1) / shards.size());
+    }
+
+    // El cuerpo del listado si se guardó con esta misma versión
+    std::shared_ptr<const Body> Find(const std::string& tournamentId, std::string_view listing, int64_t version) {
+        auto& shard = ShardFor(tournamentId);
+        std::lock_guard lock(shard.mutex);
+        if (const auto found = shard.entries.find(tournamentId); found != shard.entries.end()) {
+            if (Clock::now() >= found->second.expiresAt) {
+                shard.recency.erase(found->second.recency);
+                shard.entries.erase(found);
+            } else if (const auto cached = found->second.listings.find(listing);
+                       cached != found->second.listings.end() && cached->second.version == version) {
+                shard.recency.splice(shard.recency.begin(), shard.recency, found->second.recency);
+                counters.hits.fetch_add(1, std::memory_order_relaxed);
+                return cached->second.body;
+            }
+        }
+        counters.misses.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    // Comprime fuera del lock y guarda; si ya hay una versión más nueva, la conserva
+    std::shared_ptr<const Body> Store(const std::string& tournamentId, std::string_view listing, int64_t version, std::string json) {
+        auto body = std::make_shared<Body>();
+        body->gzip = GzipCompress(json);
+        body->json = std::move(json);
+
+        auto& shard = ShardFor(tournamentId);
+        std::lock_guard lock(shard.mutex);
+        auto found = shard.entries.find(tournamentId);
+        if (found == shard.entries.end()) {
+            if (shard.entries.size() >= shardCapacity) {
+                shard.entries.erase(shard.recency.back());
+                shard.recency.pop_back();
+                counters.evictions.fetch_add(1, std::memory_order_relaxed);
+            }
+            shard.recency.push_front(tournamentId);
+            found = shard.entries.emplace(tournamentId, Entry{{}, {}, shard.recency.begin()}).first;
+        } else {
+            shard.recency.splice(shard.recency.begin(), shard.recency, found->second.recency);
+        }
+        found->second.expiresAt = Clock::now() + ttl;
+
+        auto& listings = found->second.listings;
+        if (const auto cached = listings.find(listing); cached != listings.end()) {
+            if (cached->second.version <= version) {
+                cached->second = Listing{version, body};
+            }
+        } else {
+            listings.emplace(std::string(listing), Listing{version, body});
+        }
+        return body;
+    }
+
+    void Evict(const std::string& tournamentId) {
+        auto& shard = ShardFor(tournamentId);
+        std::lock_guard lock(shard.mutex);
+        if (const auto found = shard.entries.find(tournamentId); found != shard.entries.end()) {
+            shard.recency.erase(found->second.recency);
+            shard.entries.erase(found);
+            counters.invalidations.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Respuesta 200 con el cuerpo guardado; solo copia bytes, no vuelve a serializar
+inline crow::response CachedBodyResponse(const ResponseCache::Body& body, bool gzip) {
+    crow::response response{crow::OK};
+    response.body = gzip ? body.gzip : body.json;
+    response.add_header("content-type", "application/json");
+    response.add_header("vary", "accept-encoding");
+    if (gzip) {
+        response.add_header("content-encoding", "gzip");
+    }
+    return response;
+}
+
+#endif //TOURNAMENTS_RESPONSECACHE_HPP
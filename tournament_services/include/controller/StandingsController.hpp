@@ -0,0 +1,23 @@
+#ifndef TOURNAMENTS_STANDINGSCONTROLLER_HPP
+#define TOURNAMENTS_STANDINGSCONTROLLER_HPP
+
+#include <memory>
+#include <regex>
+#include <string>
+#include <crow.h>
+
+#include "delegate/IStandingsDelegate.hpp"
+
+static const std::regex ID_VALUE4("[A-Za-z0-9\\-]+");
+
+class StandingsController {
+    std::shared_ptr<IStandingsDelegate> standingsDelegate;
+
+public:
+    explicit StandingsController(const std::shared_ptr<IStandingsDelegate>& delegate);
+
+    // GET /tournaments/<tournamentId>/standings
+    [[nodiscard]] crow::response GetStandings(const std::string& tournamentId) const;
+};
+
+#endif // TOURNAMENTS_STANDINGSCONTROLLER_HPP
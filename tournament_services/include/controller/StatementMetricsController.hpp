@@ -0,0 +1,23 @@
+//
+// Created by developer on 10/16/26.
+//
+
+#ifndef RESTAPI_STATEMENT_METRICS_CONTROLLER_HPP
+#define RESTAPI_STATEMENT_METRICS_CONTROLLER_HPP
+
+#include <memory>
+#include <crow.h>
+
+#include "persistence/configuration/StatementMetrics.hpp"
+
+// Expone las métricas por prepared statement para saber qué consulta indexar o reescribir
+class StatementMetricsController {
+    std::shared_ptr<StatementMetrics> metrics;
+public:
+    explicit StatementMetricsController(const std::shared_ptr<StatementMetrics>& metrics);
+
+    [[nodiscard]] crow::response GetStatementMetrics() const;
+    [[nodiscard]] crow::response ResetStatementMetrics() const;
+};
+
+#endif //RESTAPI_STATEMENT_METRICS_CONTROLLER_HPP
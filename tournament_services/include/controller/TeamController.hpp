@@ -21,7 +21,7 @@ public:
     explicit TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate);
 
     [[nodiscard]] crow::response getTeam(const std::string& teamId) const;
-    [[nodiscard]] crow::response getAllTeams() const;
+    [[nodiscard]] crow::response getAllTeams(const crow::request& request) const;
     [[nodiscard]] crow::response UpdateTeam(const crow::request &request, const std::string& teamId) const;
     [[nodiscard]] crow::response DeleteTeam(const std::string& teamId) const;
     [[nodiscard]] crow::response SaveTeam(const crow::request& request) const;
@@ -21,7 +21,7 @@ public:
     [[nodiscard]] crow::response ReadTournament(const std::string& tournamentId) const;
     [[nodiscard]] crow::response UpdateTournament(const crow::request &request, const std::string& tournamentId) const;
     [[nodiscard]] crow::response DeleteTournament(const std::string& tournamentId) const;
-    [[nodiscard]] crow::response ReadAll() const;
+    [[nodiscard]] crow::response ReadAll(const crow::request &request) const;
 };
 
 
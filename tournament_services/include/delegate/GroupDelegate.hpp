@@ -1,24 +1,45 @@
 #ifndef SERVICE_GROUP_DELEGATE_HPP
 #define SERVICE_GROUP_DELEGATE_HPP
 
+#include <algorithm>
+#include <cctype>
 #include <string>
 #include <string_view>
 #include <memory>
 #include <expected>
+#include <format>
+#include <unordered_map>
+#include <vector>
 
 #include "IGroupDelegate.hpp"
+#include "persistence/repository/IRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/UnitOfWork.hpp"
 #include "../cms/QueueMessageProducer.hpp"
 
 class GroupDelegate : public IGroupDelegate{
-    std::shared_ptr<TournamentRepository> tournamentRepository;
+    std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>> tournamentRepository;
     std::shared_ptr<IGroupRepository> groupRepository;
     std::shared_ptr<TeamRepository> teamRepository;
     std::shared_ptr<QueueMessageProducer> messageProducer;
 
+    // Valida los equipos con dos consultas: que existan y que ningún grupo del torneo,
+    // salvo ownGroupId, ya los tenga. Devuelve los equipos guardados en el orden de entrada.
+    std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string> ValidateTeams(const std::string_view& tournamentId, const std::vector<domain::Team>& teams, const std::string_view& ownGroupId = {});
+
+    // Postgres devuelve los uuid en minúsculas y acepta cualquier caso al convertir; los ids
+    // se comparan así normalizados
+    static std::string NormalizedId(std::string_view id) {
+        std::string normalized(id);
+        std::ranges::transform(normalized, normalized.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return normalized;
+    }
+
 public:
-    inline GroupDelegate(const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IGroupRepository>& groupRepository, const std::shared_ptr<TeamRepository>& teamRepository, const std::shared_ptr<QueueMessageProducer>& messageProducer);
+    inline GroupDelegate(const std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>>& tournamentRepository, const std::shared_ptr<IGroupRepository>& groupRepository, const std::shared_ptr<TeamRepository>& teamRepository, const std::shared_ptr<QueueMessageProducer>& messageProducer);
     std::expected<std::string, std::string> CreateGroup(const std::string_view& tournamentId, const domain::Group& group) override;
     std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> GetGroups(const std::string_view& tournamentId) override;
+    std::expected<int64_t, std::string> GetGroupsVersion(const std::string_view& tournamentId) override;
     std::expected<std::shared_ptr<domain::Group>, std::string> GetGroup(const std::string_view& tournamentId, const std::string_view& groupId) override;
     std::expected<void, std::string> UpdateGroup(const std::string_view& tournamentId, const domain::Group& group, bool updateTeams) override;
     std::expected<void, std::string> RemoveGroup(const std::string_view& tournamentId, const std::string_view& groupId) override;
@@ -26,7 +47,7 @@ public:
 };
 
 GroupDelegate::GroupDelegate(
-    const std::shared_ptr<TournamentRepository>& tournamentRepository,
+    const std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>>& tournamentRepository,
     const std::shared_ptr<IGroupRepository>& groupRepository,
     const std::shared_ptr<TeamRepository>& teamRepository,
     const std::shared_ptr<QueueMessageProducer>& messageProducer)
@@ -36,6 +57,8 @@ GroupDelegate::GroupDelegate(
       messageProducer(messageProducer){}
 
 inline std::expected<std::string, std::string> GroupDelegate::CreateGroup(const std::string_view& tournamentId, const domain::Group& group) {
+    // Validaciones y escritura en una sola conexión y transacción del primario
+    UnitOfWork unitOfWork;
     const auto tournament = tournamentRepository->ReadById(tournamentId.data());
 
     if (!tournament) {
@@ -68,32 +91,35 @@ inline std::expected<std::string, std::string> GroupDelegate::CreateGroup(const
         return std::unexpected("Group exceeds maximum teams capacity");
     }
 
-    if (!g.Teams().empty()) {
-        for (const auto& t : g.Teams()) {
-            const auto team = teamRepository->ReadById(t.Id);
-            if (!team) {
-                return std::unexpected(team.error());
-            }
+    if (const auto validTeams = ValidateTeams(tournamentId, g.Teams()); !validTeams) {
+        return std::unexpected(validTeams.error());
+    }
 
-            const auto groupTeams = groupRepository->FindByTournamentIdAndTeamId(tournamentId, t.Id);
-            if (groupTeams) {
-                return std::unexpected(std::format("Team {} already exists in another group", t.Id));
-            }
-        }
+    const auto id = groupRepository->Create(g);
+    if (!id) {
+        return std::unexpected(id.error());
+    }
+    if (const auto committed = unitOfWork.Commit(); !committed) {
+        return std::unexpected(committed.error());
     }
 
-    return groupRepository->Create(g);
+    return id;
 }
 
 inline std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> GroupDelegate::GetGroups(const std::string_view& tournamentId) {
     return groupRepository->FindByTournamentId(tournamentId);
 }
 
+inline std::expected<int64_t, std::string> GroupDelegate::GetGroupsVersion(const std::string_view& tournamentId) {
+    return groupRepository->ReadChangeVersion(tournamentId);
+}
+
 inline std::expected<std::shared_ptr<domain::Group>, std::string> GroupDelegate::GetGroup(const std::string_view& tournamentId, const std::string_view& groupId) {
     return groupRepository->FindByTournamentIdAndGroupId(tournamentId, groupId);
 }
 
 inline std::expected<void, std::string> GroupDelegate::UpdateGroup(const std::string_view& tournamentId, const domain::Group& group, bool updateTeams) {
+    UnitOfWork unitOfWork;
     const auto existingGroup = groupRepository->FindByTournamentIdAndGroupId(tournamentId, group.Id());
     if (!existingGroup) {
         return std::unexpected(existingGroup.error());
@@ -129,16 +155,8 @@ inline std::expected<void, std::string> GroupDelegate::UpdateGroup(const std::st
             return std::unexpected("Group exceeds maximum teams capacity");
         }
 
-        for (const auto& team : updatedGroup.Teams()) {
-            const auto persistedTeam = teamRepository->ReadById(team.Id);
-            if (!persistedTeam) {
-                return std::unexpected(persistedTeam.error());
-            }
-           
-            const auto teamInGroup = groupRepository->FindByTournamentIdAndTeamId(tournamentId, team.Id);
-            if (teamInGroup && teamInGroup.value()->Id() != updatedGroup.Id()) {
-                return std::unexpected(std::format("Team {} already exists in another group", team.Id));
-            }
+        if (const auto validTeams = ValidateTeams(tournamentId, updatedGroup.Teams(), updatedGroup.Id()); !validTeams) {
+            return std::unexpected(validTeams.error());
         }
     }
 
@@ -148,19 +166,27 @@ inline std::expected<void, std::string> GroupDelegate::UpdateGroup(const std::st
         return std::unexpected(result.error());
     }
 
-    return {};
+    return unitOfWork.Commit();
 }
 
 inline std::expected<void, std::string> GroupDelegate::RemoveGroup(const std::string_view& tournamentId, const std::string_view& groupId) {
+    UnitOfWork unitOfWork;
     const auto existingGroup = groupRepository->FindByTournamentIdAndGroupId(tournamentId, groupId);
     if (!existingGroup) {
         return std::unexpected(existingGroup.error());
     }
 
-    return groupRepository->Delete(groupId.data());
+    const auto result = groupRepository->Delete(groupId.data());
+    if (!result) {
+        return std::unexpected(result.error());
+    }
+
+    return unitOfWork.Commit();
 }
 
 inline std::expected<void, std::string> GroupDelegate::UpdateTeams(const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Team>& teams) {
+    // Todo el PATCH comparte una conexión y una transacción: se agregan todos los equipos o ninguno
+    UnitOfWork unitOfWork;
     const auto group = groupRepository->FindByTournamentIdAndGroupId(tournamentId, groupId);
     if (!group) {
         return std::unexpected(group.error());
@@ -174,25 +200,24 @@ inline std::expected<void, std::string> GroupDelegate::UpdateTeams(const std::st
         return std::unexpected("Group exceeds maximum teams capacity");
     }
 
-    for (const auto& team : teams) {
-        const auto persistedTeam = teamRepository->ReadById(team.Id);
-        if (!persistedTeam) {
-            return std::unexpected(persistedTeam.error());
-        }
-
-        const auto groupTeams = groupRepository->FindByTournamentIdAndTeamId(tournamentId, team.Id);
-        if (groupTeams) {
-            return std::unexpected(std::format("Team {} already exists in another group", team.Id));
-        }
+    const auto persistedTeams = ValidateTeams(tournamentId, teams);
+    if (!persistedTeams) {
+        return std::unexpected(persistedTeams.error());
     }
 
-    for (const auto& team : teams) {
-        const auto persistedTeam = teamRepository->ReadById(team.Id);
-        const auto updateResult = groupRepository->UpdateGroupAddTeam(groupId, persistedTeam.value());
+    for (const auto& persistedTeam : persistedTeams.value()) {
+        const auto updateResult = groupRepository->UpdateGroupAddTeam(groupId, persistedTeam);
         if (!updateResult) {
             return std::unexpected(updateResult.error());
         }
+    }
 
+    if (const auto committed = unitOfWork.Commit(); !committed) {
+        return std::unexpected(committed.error());
+    }
+
+    // Los eventos salen después del commit para que el consumidor lea los equipos ya guardados
+    for (const auto& team : teams) {
         std::unique_ptr<nlohmann::json> message = std::make_unique<nlohmann::json>();
         message->emplace("tournamentId", tournamentId);
         message->emplace("groupId", groupId);
@@ -203,4 +228,51 @@ inline std::expected<void, std::string> GroupDelegate::UpdateTeams(const std::st
     return {};
 }
 
+inline std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string> GroupDelegate::ValidateTeams(const std::string_view& tournamentId, const std::vector<domain::Team>& teams, const std::string_view& ownGroupId) {
+    std::vector<std::shared_ptr<domain::Team>> persistedTeams;
+    if (teams.empty()) {
+        return persistedTeams;
+    }
+
+    std::vector<std::string> ids;
+    ids.reserve(teams.size());
+    for (const auto& team : teams) {
+        ids.push_back(NormalizedId(team.Id));
+    }
+
+    const auto foundTeams = teamRepository->ReadByIds(ids);
+    if (!foundTeams) {
+        return std::unexpected(foundTeams.error());
+    }
+    std::unordered_map<std::string, std::shared_ptr<domain::Team>> teamsById;
+    for (const auto& team : foundTeams.value()) {
+        teamsById.emplace(team->Id, team);
+    }
+
+    persistedTeams.reserve(teams.size());
+    for (const auto& id : ids) {
+        const auto found = teamsById.find(id);
+        if (found == teamsById.end()) {
+            return std::unexpected("Team not found");
+        }
+        persistedTeams.push_back(found->second);
+    }
+
+    const auto groups = groupRepository->FindGroupsContainingAnyTeam(tournamentId, ids);
+    if (!groups) {
+        return std::unexpected(groups.error());
+    }
+    for (size_t i = 0; i < teams.size(); i++) {
+        const bool inAnotherGroup = std::ranges::any_of(groups.value(), [&](const auto& group) {
+            return group->Id() != ownGroupId
+                && std::ranges::any_of(group->Teams(), [&](const domain::Team& member) { return NormalizedId(member.Id) == ids[i]; });
+        });
+        if (inAnotherGroup) {
+            return std::unexpected(std::format("Team {} already exists in another group", teams[i].Id));
+        }
+    }
+
+    return persistedTeams;
+}
+
 #endif /* SERVICE_GROUP_DELEGATE_HPP */
@@ -1,6 +1,7 @@
 #ifndef SERVICE_IGROUP_DELEGATE_HPP
 #define SERVICE_IGROUP_DELEGATE_HPP
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -13,6 +14,8 @@ public:
     virtual ~IGroupDelegate() = default;
     virtual std::expected<std::string, std::string> CreateGroup(const std::string_view& tournamentId, const domain::Group& group) = 0;
     virtual std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string> GetGroups(const std::string_view& tournamentId) = 0;
+    // Cambia con cada escritura en los grupos del torneo; sirve de ETag para GetGroups
+    virtual std::expected<int64_t, std::string> GetGroupsVersion(const std::string_view& tournamentId) = 0;
     virtual std::expected<std::shared_ptr<domain::Group>, std::string> GetGroup(const std::string_view& tournamentId, const std::string_view& groupId) = 0;
     virtual std::expected<void, std::string> UpdateGroup(const std::string_view& tournamentId, const domain::Group& group, bool updateTeams) = 0;
     virtual std::expected<void, std::string> RemoveGroup(const std::string_view& tournamentId, const std::string_view& groupId) = 0;
@@ -1,32 +1,39 @@
 #ifndef TOURNAMENTS_IMATCHDELEGATE_H
 #define TOURNAMENTS_IMATCHDELEGATE_H
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <memory>
 #include <vector>
 #include <expected>
+#include <optional>
+#include <asio.hpp>
 #include "domain/Match.hpp"
 
 class IMatchDelegate {
 public:
     virtual ~IMatchDelegate() = default;
 
-    // Obtener todos los matches de un torneo con filtros opcionales
-    virtual std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>
-        GetMatches(std::string_view tournamentId,
-                   std::optional<std::string> filter = std::nullopt) = 0;
-
     // Obtener un match específico
     virtual std::expected<std::shared_ptr<domain::Match>, std::string>
         GetMatch(std::string_view tournamentId, std::string_view matchId) = 0;
 
+    // Los listados y el score no bloquean el hilo de Crow: la corrutina se suspende
+    // mientras Postgres responde. Los parámetros van por valor porque se usan después
+    // de cada suspensión.
+
+    // Obtener todos los matches de un torneo; filter puede ser "played" o "pending"
+    virtual asio::awaitable<std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>>
+        GetMatchesAsync(std::string tournamentId, std::optional<std::string> filter) = 0;
+
     // Actualizar el score de un match
-    virtual std::expected<void, std::string>
-        UpdateMatchScore(std::string_view tournamentId,
-                        std::string_view matchId,
-                        const domain::Score& score) = 0;
+    virtual asio::awaitable<std::expected<void, std::string>>
+        UpdateMatchScoreAsync(std::string tournamentId, std::string matchId, domain::Score score) = 0;
 
+    // Cambia con cada escritura en los matches del torneo; sirve de ETag para GetMatchesAsync
+    virtual asio::awaitable<std::expected<int64_t, std::string>>
+        GetMatchesVersionAsync(std::string tournamentId) = 0;
 };
 
 #endif // TOURNAMENTS_IMATCHDELEGATE_H
\ No newline at end of file
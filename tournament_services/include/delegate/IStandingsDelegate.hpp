@@ -0,0 +1,17 @@
+#ifndef SERVICE_ISTANDINGS_DELEGATE_HPP
+#define SERVICE_ISTANDINGS_DELEGATE_HPP
+
+#include <expected>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "domain/Standing.hpp"
+
+class IStandingsDelegate {
+public:
+    virtual ~IStandingsDelegate() = default;
+    virtual std::expected<std::vector<domain::Standing>, std::string> GetStandings(const std::string_view& tournamentId) = 0;
+};
+
+#endif /* SERVICE_ISTANDINGS_DELEGATE_HPP */
@@ -4,6 +4,7 @@
 #include <string>
 #include <string_view>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <expected>
 
@@ -14,7 +15,7 @@ class ITeamDelegate {
     virtual ~ITeamDelegate() = default;
     virtual std::expected<std::string, std::string> CreateTeam(std::shared_ptr<domain::Team> team) = 0;
     virtual std::expected<std::shared_ptr<domain::Team>, std::string> GetTeam(std::string_view id) = 0;
-    virtual std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string> ReadAll() = 0;
+    virtual std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string> ReadPage(const std::optional<std::string>& after, size_t limit) = 0;
     virtual std::expected<std::string, std::string> UpdateTeam(std::string_view id, std::shared_ptr<domain::Team> team) = 0;
     virtual std::expected<void, std::string> DeleteTeam(std::string_view id) = 0;
 };
@@ -7,6 +7,7 @@
 
 #include <string>
 #include <memory>
+#include <optional>
 #include <expected>
 
 #include "domain/Tournament.hpp"
@@ -16,7 +17,7 @@ public:
     virtual ~ITournamentDelegate() = default;
     virtual std::expected<std::string, std::string> CreateTournament(std::shared_ptr<domain::Tournament> tournament) = 0;
     virtual std::expected<std::shared_ptr<domain::Tournament>, std::string> GetTournament(std::string_view id) = 0;
-    virtual std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string> ReadAll() = 0;
+    virtual std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string> ReadPage(const std::optional<std::string>& after, size_t limit) = 0;
     virtual std::expected<std::string, std::string> UpdateTournament(std::string_view id, std::shared_ptr<domain::Tournament> tournament) = 0;
     virtual std::expected<void, std::string> DeleteTournament(std::string_view id) = 0;
 };
@@ -6,43 +6,64 @@
 #include "IMatchDelegate.h"
 #include "persistence/repository/IMatchRepository.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
-#include "persistence/repository/GroupRepository.hpp"
+#include "persistence/repository/IAsyncMatchRepository.hpp"
+#include "persistence/repository/IAsyncTournamentRepository.hpp"
 #include "cms/QueueMessageProducer.hpp"
 #include "domain/IMatchStrategy.hpp"
 
 class MatchDelegate : public IMatchDelegate {
     std::shared_ptr<IMatchRepository> matchRepository;
-    std::shared_ptr<TournamentRepository> tournamentRepository;
-    std::shared_ptr<IGroupRepository> groupRepository;
+    std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>> tournamentRepository;
     std::shared_ptr<QueueMessageProducer> messageProducer;
+    std::shared_ptr<IAsyncMatchRepository> asyncMatchRepository;
+    std::shared_ptr<IAsyncTournamentRepository> asyncTournamentRepository;
 
     // Estrategias por tipo de torneo
     std::map<std::string, std::shared_ptr<IMatchStrategy>> strategies;
 
+    // El envío al broker bloquea; UpdateMatchScoreAsync publica aquí y no en el hilo del
+    // io_context. Un solo hilo conserva el orden de los eventos.
+    asio::thread_pool publisher{1};
+
 public:
     MatchDelegate(const std::shared_ptr<IMatchRepository>& matchRepo,
-                  const std::shared_ptr<TournamentRepository>& tournamentRepo,
-                  const std::shared_ptr<IGroupRepository>& groupRepo,
-                  const std::shared_ptr<QueueMessageProducer>& producer);
+                  const std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>>& tournamentRepo,
+                  const std::shared_ptr<QueueMessageProducer>& producer,
+                  const std::shared_ptr<IAsyncMatchRepository>& asyncMatchRepo,
+                  const std::shared_ptr<IAsyncTournamentRepository>& asyncTournamentRepo);
 
-    std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>
-        GetMatches(std::string_view tournamentId,
-                   std::optional<std::string> filter = std::nullopt) override;
+    // Espera a que salgan los eventos pendientes
+    ~MatchDelegate() override;
 
     std::expected<std::shared_ptr<domain::Match>, std::string>
         GetMatch(std::string_view tournamentId, std::string_view matchId) override;
 
-    std::expected<void, std::string>
-        UpdateMatchScore(std::string_view tournamentId,
-                        std::string_view matchId,
-                        const domain::Score& score) override;
+    asio::awaitable<std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>>
+        GetMatchesAsync(std::string tournamentId, std::optional<std::string> filter) override;
+
+    asio::awaitable<std::expected<void, std::string>>
+        UpdateMatchScoreAsync(std::string tournamentId, std::string matchId, domain::Score score) override;
+
+    asio::awaitable<std::expected<int64_t, std::string>>
+        GetMatchesVersionAsync(std::string tournamentId) override;
 
 private:
     // Validaciones
     bool ValidateScore(const domain::Score& score,
-                      const domain::Tournament& tournament,
                       domain::RoundType round);
 
+    // Rondas en las que el score es válido; el UPDATE del marcador las exige en SQL
+    std::vector<domain::RoundType> ValidScoreRounds(const domain::Score& score);
+
+    // Explican por qué el UPDATE del marcador no escribió, a partir del match tal como
+    // está guardado
+    std::expected<void, std::string> ValidateScoreUpdate(std::string_view tournamentId,
+                                                         const domain::Match& match,
+                                                         const domain::Score& score);
+
+    void PublishScoreUpdated(std::string_view tournamentId, std::string_view matchId,
+                             const domain::Match& match, const domain::Score& score);
+
 };
 
 #endif // TOURNAMENTS_MATCHDELEGATE_HPP
\ No newline at end of file
@@ -0,0 +1,43 @@
+#ifndef SERVICE_STANDINGS_DELEGATE_HPP
+#define SERVICE_STANDINGS_DELEGATE_HPP
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "IStandingsDelegate.hpp"
+#include "domain/Tournament.hpp"
+#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/StandingsRepository.hpp"
+
+// La tabla la mantiene el consumer con cada marcador; aquí solo se lee, una fila por equipo
+class StandingsDelegate : public IStandingsDelegate {
+    std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>> tournamentRepository;
+    std::shared_ptr<StandingsRepository> standingsRepository;
+
+public:
+    StandingsDelegate(const std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>>& tournamentRepository,
+                      const std::shared_ptr<StandingsRepository>& standingsRepository);
+
+    std::expected<std::vector<domain::Standing>, std::string> GetStandings(const std::string_view& tournamentId) override;
+};
+
+inline StandingsDelegate::StandingsDelegate(
+    const std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>>& tournamentRepository,
+    const std::shared_ptr<StandingsRepository>& standingsRepository)
+    : tournamentRepository(tournamentRepository),
+      standingsRepository(standingsRepository) {}
+
+inline std::expected<std::vector<domain::Standing>, std::string> StandingsDelegate::GetStandings(const std::string_view& tournamentId) {
+    // Un torneo sin grupos da una tabla vacía; uno que no existe, 404
+    const auto tournament = tournamentRepository->ReadById(std::string(tournamentId));
+    if (!tournament) {
+        return std::unexpected(tournament.error());
+    }
+
+    return standingsRepository->FindByTournamentId(tournamentId);
+}
+
+#endif /* SERVICE_STANDINGS_DELEGATE_HPP */
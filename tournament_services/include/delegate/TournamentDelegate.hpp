@@ -9,17 +9,22 @@
 
 #include "cms/QueueMessageProducer.hpp"
 #include "delegate/ITournamentDelegate.hpp"
+#include "persistence/repository/IPagedRepository.hpp"
 #include "persistence/repository/IRepository.hpp"
 
 class TournamentDelegate : public ITournamentDelegate{
     std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>> tournamentRepository;
+    // Los listados van directo al repositorio; el caché solo sirve ReadById
+    std::shared_ptr<IPagedRepository<domain::Tournament, std::string>> tournamentPages;
     std::shared_ptr<QueueMessageProducer> producer;
 public:
-    explicit TournamentDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>> repository, std::shared_ptr<QueueMessageProducer> producer);
+    TournamentDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>> repository,
+                       std::shared_ptr<IPagedRepository<domain::Tournament, std::string>> pages,
+                       std::shared_ptr<QueueMessageProducer> producer);
 
     std::expected<std::string, std::string> CreateTournament(std::shared_ptr<domain::Tournament> tournament) override;
     std::expected<std::shared_ptr<domain::Tournament>, std::string> GetTournament(std::string_view id) override;
-    std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string> ReadAll() override;
+    std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string> ReadPage(const std::optional<std::string>& after, size_t limit) override;
     std::expected<std::string, std::string> UpdateTournament(std::string_view id, std::shared_ptr<domain::Tournament> tournament) override;
     std::expected<void, std::string> DeleteTournament(std::string_view id) override;
 };
@@ -1,4 +1,5 @@
 
+#include <iostream>
 #include <activemq/library/ActiveMQCPP.h>
 
 #include "include/configuration/ContainerSetup.hpp"
@@ -16,8 +17,20 @@ int main() {
 
     auto appConfig = container->resolve<config::RunConfiguration>();
 
+    // Las escrituras de las otras réplicas invalidan los cachés de esta. Sin la suscripción
+    // servirían torneos modificados en otro nodo hasta que venza el TTL: mejor no arrancar.
+    auto tournamentEvents = container->resolve<TournamentEventSubscriber>();
+    if (const auto started = tournamentEvents->Start(TournamentEventSubscriber::TOPICS); !started) {
+        std::cerr << "Cache invalidation unavailable, exiting: " << started.error() << std::endl;
+        activemq::library::ActiveMQCPP::shutdownLibrary();
+        return 1;
+    }
+
     app.port(appConfig->port)
         .concurrency(appConfig->concurrency)
         .run();
+    tournamentEvents->Stop();
+    // The async connections watch sockets on Crow's io_contexts; close them while those still exist.
+    container->resolve<AsyncConnectionProvider>()->Shutdown();
     activemq::library::ActiveMQCPP::shutdownLibrary();
 }
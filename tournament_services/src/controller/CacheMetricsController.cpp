@@ -0,0 +1,31 @@
+//
+// Created by developer on 10/16/26.
+//
+
+#define JSON_CONTENT_TYPE "application/json"
+#define CONTENT_TYPE_HEADER "content-type"
+
+#include <nlohmann/json.hpp>
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/CacheMetricsController.hpp"
+
+CacheMetricsController::CacheMetricsController(const std::shared_ptr<CacheMetrics>& metrics)
+    : metrics(metrics) {}
+
+crow::response CacheMetricsController::GetCacheMetrics() const {
+    const nlohmann::json body = metrics->Snapshot();
+    crow::response response{crow::OK, body.dump()};
+    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+
+    return response;
+}
+
+crow::response CacheMetricsController::ResetCacheMetrics() const {
+    metrics->Reset();
+
+    return crow::response{crow::NO_CONTENT};
+}
+
+REGISTER_ROUTE(CacheMetricsController, GetCacheMetrics, "/metrics/caches", "GET"_method)
+REGISTER_ROUTE(CacheMetricsController, ResetCacheMetrics, "/metrics/caches", "DELETE"_method)
@@ -1,5 +1,6 @@
 #include <crow.h>
 
+#include "controller/ETag.hpp"
 #include "controller/MatchController.hpp"
 #include "configuration/RouteDefinition.hpp"
 #include "domain/Utilities.hpp"
@@ -8,11 +9,27 @@
 #define JSON_CONTENT_TYPE "application/json"
 #define CONTENT_TYPE_HEADER "content-type"
 
-MatchController::MatchController(std::shared_ptr<IMatchDelegate> delegate) 
-    : matchDelegate(std::move(delegate)) {}
+namespace {
+    // Corre el handler en el io_context de la conexión de Crow. El hilo queda libre
+    // mientras la corrutina espera a Postgres, y response.end() se llama desde ese
+    // mismo io_context, como Crow requiere.
+    void Respond(const crow::request& request, crow::response& response, asio::awaitable<crow::response> handler) {
+        asio::co_spawn(*request.io_context, std::move(handler),
+            [&response](std::exception_ptr error, crow::response result) {
+                if (error) {
+                    result = crow::response{crow::INTERNAL_SERVER_ERROR, "Internal server error"};
+                }
+                response = std::move(result);
+                response.end();
+            });
+    }
+}
 
-crow::response MatchController::GetMatches(const crow::request& request, 
-                                           const std::string& tournamentId) const {
+MatchController::MatchController(std::shared_ptr<IMatchDelegate> delegate, std::shared_ptr<ResponseCache> responseCache)
+    : matchDelegate(std::move(delegate)), responseCache(std::move(responseCache)) {}
+
+void MatchController::GetMatches(const crow::request& request, crow::response& response,
+                                 const std::string& tournamentId) const {
     // Obtener el parámetro de query ?showMatches=played|pending
     std::optional<std::string> filter;
     auto showMatches = request.url_params.get("showMatches");
@@ -23,23 +40,58 @@ crow::response MatchController::GetMatches(const crow::request& request,
         if (filterValue == "played" || filterValue == "pending") {
             filter = filterValue;
         } else {
-            return {crow::BAD_REQUEST, "Invalid showMatches value. Must be 'played' or 'pending'"};
+            response = crow::response{crow::BAD_REQUEST, "Invalid showMatches value. Must be 'played' or 'pending'"};
+            response.end();
+            return;
         }
     }
-    
-    const auto result = matchDelegate->GetMatches(tournamentId, filter);
+
+    Respond(request, response, MatchesResponse(tournamentId, filter, request.get_header_value(IF_NONE_MATCH_HEADER),
+                                               AcceptsGzip(request.get_header_value("accept-encoding"))));
+}
+
+asio::awaitable<crow::response> MatchController::MatchesResponse(std::string tournamentId,
+                                                                 std::optional<std::string> filter,
+                                                                 std::string ifNoneMatch,
+                                                                 bool gzip) const {
+    // Sin versión (torneo inexistente o error) se responde sin ETag ni caché y el listado
+    // decide el código
+    const std::string listing = filter ? "matches-" + *filter : "matches";
+    const auto version = co_await matchDelegate->GetMatchesVersionAsync(tournamentId);
+    std::optional<std::string> etag;
+    if (version) {
+        etag = ListingETag(listing, *version);
+        if (ETagMatches(ifNoneMatch, *etag)) {
+            co_return NotModified(*etag);
+        }
+        if (const auto cached = responseCache->Find(tournamentId, listing, *version)) {
+            crow::response response = CachedBodyResponse(*cached, gzip);
+            AddETag(response, *etag);
+            co_return response;
+        }
+    }
+
+    const auto result = co_await matchDelegate->GetMatchesAsync(tournamentId, filter);
     
     if (!result) {
         if (result.error() == "Tournament not found") {
-            return {crow::NOT_FOUND, result.error()};
+            co_return crow::response{crow::NOT_FOUND, result.error()};
         }
-        return {crow::INTERNAL_SERVER_ERROR, result.error()};
+        co_return crow::response{crow::INTERNAL_SERVER_ERROR, result.error()};
     }
     
-    nlohmann::json body = *result;
-    crow::response response{crow::OK, body.dump()};
-    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
-    return response;
+    // Un torneo tiene cientos de matches: se escriben directo al texto, sin DOM intermedio
+    std::string body = domain::ToJsonString(*result);
+    if (!version) {
+        crow::response response{crow::OK, std::move(body)};
+        response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+        co_return response;
+    }
+
+    const auto stored = responseCache->Store(tournamentId, listing, *version, std::move(body));
+    crow::response response = CachedBodyResponse(*stored, gzip);
+    AddETag(response, *etag);
+    co_return response;
 }
 
 crow::response MatchController::GetMatch(const std::string& tournamentId, 
@@ -61,45 +113,55 @@ crow::response MatchController::GetMatch(const std::string& tournamentId,
     return response;
 }
 
-crow::response MatchController::UpdateMatchScore(const crow::request& request,
-                                                 const std::string& tournamentId,
-                                                 const std::string& matchId) const {
+void MatchController::UpdateMatchScore(const crow::request& request, crow::response& response,
+                                       const std::string& tournamentId,
+                                       const std::string& matchId) const {
     try {
         nlohmann::json body = nlohmann::json::parse(request.body);
         
         // Parsear el score del body
         if (!body.contains("score")) {
-            return {crow::BAD_REQUEST, "Missing 'score' field"};
+            response = crow::response{crow::BAD_REQUEST, "Missing 'score' field"};
+            response.end();
+            return;
         }
 
         domain::Score score;
         body["score"].get_to(score);
 
-        const auto result = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
-
-        if (!result) {
-            if (result.error() == "Match not found" || 
-                result.error() == "Tournament not found") {
-                return {crow::NOT_FOUND, result.error()};
-            }
-            
-            // Si el error contiene "Invalid score" o "Tie not allowed", es 409 
-            if (result.error().find("Invalid score") != std::string::npos ||
-                result.error().find("Tie not allowed") != std::string::npos) {
-                return {409, result.error()};
-            }
-            
-            return {crow::INTERNAL_SERVER_ERROR, result.error()};
-        }
+        Respond(request, response, UpdateScoreResponse(tournamentId, matchId, score));
+    } catch (const nlohmann::json::exception& e) {
+        response = crow::response{crow::BAD_REQUEST, "Invalid JSON"};
+        response.end();
+    }
+}
 
-        return crow::response{crow::NO_CONTENT};
+asio::awaitable<crow::response> MatchController::UpdateScoreResponse(std::string tournamentId,
+                                                                     std::string matchId,
+                                                                     domain::Score score) const {
+    const auto result = co_await matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score);
 
-    } catch (const nlohmann::json::exception& e) {
-        return {crow::BAD_REQUEST, "Invalid JSON"};
+    if (!result) {
+        if (result.error() == "Match not found" || 
+            result.error() == "Tournament not found") {
+            co_return crow::response{crow::NOT_FOUND, result.error()};
+        }
+        
+        // Si el error contiene "Invalid score" o "Tie not allowed", es 409 
+        if (result.error().find("Invalid score") != std::string::npos ||
+            result.error().find("Tie not allowed") != std::string::npos) {
+            co_return crow::response{409, result.error()};
+        }
+        
+        co_return crow::response{crow::INTERNAL_SERVER_ERROR, result.error()};
     }
+
+    // La versión ya subió con el UPDATE; esto solo suelta los cuerpos viejos
+    responseCache->Evict(tournamentId);
+    co_return crow::response{crow::NO_CONTENT};
 }
 
 // Registrar las rutas
-REGISTER_ROUTE(MatchController, GetMatches, "/tournaments/<string>/matches", "GET"_method)
+REGISTER_ASYNC_ROUTE(MatchController, GetMatches, "/tournaments/<string>/matches", "GET"_method)
 REGISTER_ROUTE(MatchController, GetMatch, "/tournaments/<string>/matches/<string>", "GET"_method)
-REGISTER_ROUTE(MatchController, UpdateMatchScore, "/tournaments/<string>/matches/<string>", "PATCH"_method)
\ No newline at end of file
+REGISTER_ASYNC_ROUTE(MatchController, UpdateMatchScore, "/tournaments/<string>/matches/<string>", "PATCH"_method)
\ No newline at end of file
@@ -0,0 +1,48 @@
+//
+// Created by developer on 10/16/26.
+//
+
+#define JSON_CONTENT_TYPE "application/json"
+#define CONTENT_TYPE_HEADER "content-type"
+
+#include <nlohmann/json.hpp>
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/PoolMetricsController.hpp"
+
+namespace {
+    nlohmann::json PoolJson(const ConnectionPoolStats& stats) {
+        return {
+            {"size", stats.size},
+            {"inUse", stats.inUse},
+            {"minSize", stats.minSize},
+            {"maxSize", stats.maxSize},
+            {"acquisitions", stats.acquisitions},
+            {"waits", stats.waits},
+            {"totalWaitUs", stats.totalWait.count()},
+            {"meanWaitUs", stats.waits == 0 ? 0 : stats.totalWait.count() / static_cast<int64_t>(stats.waits)},
+            {"maxWaitUs", stats.maxWait.count()},
+            {"timeouts", stats.timeouts},
+            {"grown", stats.grown},
+            {"reaped", stats.reaped}
+        };
+    }
+}
+
+PoolMetricsController::PoolMetricsController(const std::shared_ptr<IDbConnectionProvider>& connectionProvider)
+    : connectionProvider(connectionProvider) {}
+
+crow::response PoolMetricsController::GetPoolMetrics() const {
+    // Sin réplica configurada, "replica" va en null
+    const auto readStats = connectionProvider->ReadPoolStats();
+    const nlohmann::json body = {
+        {"primary", PoolJson(connectionProvider->PoolStats())},
+        {"replica", readStats ? PoolJson(*readStats) : nlohmann::json(nullptr)}
+    };
+    crow::response response{crow::OK, body.dump()};
+    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+
+    return response;
+}
+
+REGISTER_ROUTE(PoolMetricsController, GetPoolMetrics, "/metrics/pools", "GET"_method)
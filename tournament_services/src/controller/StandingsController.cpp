@@ -0,0 +1,34 @@
+#define JSON_CONTENT_TYPE "application/json"
+#define CONTENT_TYPE_HEADER "content-type"
+
+#include <nlohmann/json.hpp>
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/StandingsController.hpp"
+#include "domain/Utilities.hpp"
+
+StandingsController::StandingsController(const std::shared_ptr<IStandingsDelegate>& delegate)
+    : standingsDelegate(delegate) {}
+
+crow::response StandingsController::GetStandings(const std::string& tournamentId) const {
+    if (!std::regex_match(tournamentId, ID_VALUE4)) {
+        return {crow::BAD_REQUEST, "Invalid tournament ID format"};
+    }
+
+    const auto result = standingsDelegate->GetStandings(tournamentId);
+
+    if (!result) {
+        if (result.error() == "Tournament not found") {
+            return {crow::NOT_FOUND, result.error()};
+        }
+        return {crow::INTERNAL_SERVER_ERROR, result.error()};
+    }
+
+    const nlohmann::json body = *result;
+    crow::response response{crow::OK, body.dump()};
+    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+
+    return response;
+}
+
+REGISTER_ROUTE(StandingsController, GetStandings, "/tournaments/<string>/standings", "GET"_method)
@@ -0,0 +1,32 @@
+//
+// Created by developer on 10/16/26.
+//
+
+#define JSON_CONTENT_TYPE "application/json"
+#define CONTENT_TYPE_HEADER "content-type"
+
+#include <nlohmann/json.hpp>
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/StatementMetricsController.hpp"
+
+StatementMetricsController::StatementMetricsController(const std::shared_ptr<StatementMetrics>& metrics)
+    : metrics(metrics) {}
+
+crow::response StatementMetricsController::GetStatementMetrics() const {
+    // Ordenadas por latencia acumulada, la más costosa primero
+    const nlohmann::json body = metrics->Snapshot();
+    crow::response response{crow::OK, body.dump()};
+    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+
+    return response;
+}
+
+crow::response StatementMetricsController::ResetStatementMetrics() const {
+    metrics->Reset();
+
+    return crow::response{crow::NO_CONTENT};
+}
+
+REGISTER_ROUTE(StatementMetricsController, GetStatementMetrics, "/metrics/statements", "GET"_method)
+REGISTER_ROUTE(StatementMetricsController, ResetStatementMetrics, "/metrics/statements", "DELETE"_method)
@@ -7,6 +7,7 @@
 
 #include "configuration/RouteDefinition.hpp"
 #include "controller/TeamController.hpp"
+#include "controller/Pagination.hpp"
 #include "domain/Utilities.hpp"
 
 TeamController::TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate)
@@ -30,8 +31,13 @@ crow::response TeamController::getTeam(const std::string& teamId) const {
     return response;
 }
 
-crow::response TeamController::getAllTeams() const {
-    const auto result = teamDelegate->ReadAll();
+crow::response TeamController::getAllTeams(const crow::request& request) const {
+    const auto page = ParsePageRequest(request);
+    if (!page) {
+        return {crow::BAD_REQUEST, page.error()};
+    }
+
+    const auto result = teamDelegate->ReadPage(page->after, page->limit);
 
     if (!result) {
         return {crow::INTERNAL_SERVER_ERROR, result.error()};
@@ -40,6 +46,9 @@ crow::response TeamController::getAllTeams() const {
     nlohmann::json body = *result;
     crow::response response{crow::OK, body.dump()};
     response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+    if (!result->empty()) {
+        AddNextPageLink(response, "/teams", *page, result->size(), result->back()->Id);
+    }
 
     return response;
 }
@@ -7,6 +7,7 @@
 
 #include "configuration/RouteDefinition.hpp"
 #include "controller/TournamentController.hpp"
+#include "controller/Pagination.hpp"
 
 #include <string>
 #include <utility>
@@ -54,8 +55,13 @@ crow::response TournamentController::ReadTournament(const std::string& tournamen
     return response;
 }
 
-crow::response TournamentController::ReadAll() const {
-    const auto result = tournamentDelegate->ReadAll();
+crow::response TournamentController::ReadAll(const crow::request &request) const {
+    const auto page = ParsePageRequest(request);
+    if (!page) {
+        return {crow::BAD_REQUEST, page.error()};
+    }
+
+    const auto result = tournamentDelegate->ReadPage(page->after, page->limit);
 
     if (!result) {
         return {crow::INTERNAL_SERVER_ERROR, result.error()};
@@ -64,6 +70,9 @@ crow::response TournamentController::ReadAll() const {
     nlohmann::json body = *result;
     crow::response response{crow::OK, body.dump()};
     response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+    if (!result->empty()) {
+        AddNextPageLink(response, "/tournaments", *page, result->size(), result->back()->Id());
+    }
 
     return response;
 }
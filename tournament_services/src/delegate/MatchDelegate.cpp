@@ -1,45 +1,33 @@
 #include "delegate/MatchDelegate.hpp"
 #include "domain/NFLStrategy.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/ReadTransaction.hpp"
 #include <format>
 
 MatchDelegate::MatchDelegate(
     const std::shared_ptr<IMatchRepository>& matchRepo,
-    const std::shared_ptr<TournamentRepository>& tournamentRepo,
-    const std::shared_ptr<IGroupRepository>& groupRepo,
-    const std::shared_ptr<QueueMessageProducer>& producer)
+    const std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>>>& tournamentRepo,
+    const std::shared_ptr<QueueMessageProducer>& producer,
+    const std::shared_ptr<IAsyncMatchRepository>& asyncMatchRepo,
+    const std::shared_ptr<IAsyncTournamentRepository>& asyncTournamentRepo)
     : matchRepository(matchRepo),
       tournamentRepository(tournamentRepo),
-      groupRepository(groupRepo),
-      messageProducer(producer) {
+      messageProducer(producer),
+      asyncMatchRepository(asyncMatchRepo),
+      asyncTournamentRepository(asyncTournamentRepo) {
 
     // Registrar estrategias disponibles
     strategies["NFL"] = std::make_shared<NFLStrategy>();
 }
 
-std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>
-MatchDelegate::GetMatches(std::string_view tournamentId,
-                         std::optional<std::string> filter) {
-    // Validar que el torneo existe
-    auto tournament = tournamentRepository->ReadById(tournamentId.data());
-    if (!tournament) {
-        return std::unexpected(tournament.error());
-    }
-
-    // Obtener matches según el filtro
-    if (filter.has_value()) {
-        if (*filter == "played") {
-            return matchRepository->FindPlayedMatchesByTournamentId(tournamentId);
-        } else if (*filter == "pending") {
-            return matchRepository->FindPendingMatchesByTournamentId(tournamentId);
-        }
-    }
-
-    // Sin filtro, devolver todos
-    return matchRepository->FindByTournamentId(tournamentId);
+MatchDelegate::~MatchDelegate() {
+    publisher.join();
 }
 
 std::expected<std::shared_ptr<domain::Match>, std::string>
 MatchDelegate::GetMatch(std::string_view tournamentId, std::string_view matchId) {
+    SnapshotRead snapshot;
+
     // Validar que el torneo existe
     auto tournament = tournamentRepository->ReadById(tournamentId.data());
     if (!tournament) {
@@ -60,80 +48,134 @@ MatchDelegate::GetMatch(std::string_view tournamentId, std::string_view matchId)
     return match;
 }
 
-std::expected<void, std::string>
-MatchDelegate::UpdateMatchScore(std::string_view tournamentId,
-                               std::string_view matchId,
-                               const domain::Score& score) {
+asio::awaitable<std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>>
+MatchDelegate::GetMatchesAsync(std::string tournamentId, std::optional<std::string> filter) {
     // Validar que el torneo existe
-    auto tournamentResult = tournamentRepository->ReadById(tournamentId.data());
-    if (!tournamentResult) {
-        return std::unexpected(tournamentResult.error());
+    auto tournament = co_await asyncTournamentRepository->ReadById(tournamentId);
+    if (!tournament) {
+        co_return std::unexpected(tournament.error());
     }
-    auto tournament = *tournamentResult;
 
-    // Obtener el match
-    auto matchResult = matchRepository->ReadById(matchId.data());
-    if (!matchResult) {
-        return std::unexpected(matchResult.error());
+    auto query = MatchQuery().WithTournament(tournamentId);
+    if (filter == "played") {
+        query.WithPlayed(true);
+    } else if (filter == "pending") {
+        query.WithPlayed(false);
+    }
+
+    co_return co_await asyncMatchRepository->Find(query);
+}
+
+asio::awaitable<std::expected<int64_t, std::string>>
+MatchDelegate::GetMatchesVersionAsync(std::string tournamentId) {
+    co_return co_await asyncMatchRepository->ReadChangeVersion(tournamentId);
+}
+
+asio::awaitable<std::expected<void, std::string>>
+MatchDelegate::UpdateMatchScoreAsync(std::string tournamentId, std::string matchId, domain::Score score) {
+    // Validar el score según las reglas del torneo, para cada ronda posible
+    const auto validRounds = ValidScoreRounds(score);
+    if (validRounds.empty()) {
+        co_return std::unexpected("Invalid score for this tournament format and round");
     }
-    auto match = *matchResult;
 
+    // Un solo UPDATE valida y escribe el marcador (y cierra el torneo si es el Super Bowl).
+    // Si no escribió, el match que devuelve dice qué regla falló; si ninguna falla es que
+    // otro escritor lo cambió durante el update y se vuelve a intentar
+    std::shared_ptr<domain::Match> match;
+    for (int attempt = 1; ; attempt++) {
+        auto updateResult = co_await asyncMatchRepository->UpdateScore(tournamentId, matchId, score, validRounds);
+        if (!updateResult) {
+            co_return std::unexpected(updateResult.error());
+        }
+        if (updateResult->written) {
+            match = updateResult->match;
+            break;
+        }
+
+        auto validation = ValidateScoreUpdate(tournamentId, *updateResult->match, score);
+        if (!validation) {
+            co_return validation;
+        }
+        if (attempt == MATCH_UPDATE_ATTEMPTS) {
+            co_return std::unexpected(std::string(MATCH_VERSION_CONFLICT));
+        }
+    }
+
+    // La corrutina sigue en su io_context cuando el evento ya salió. El lambda va en una
+    // variable: GCC destruye dos veces las capturas de un lambda temporal dentro de co_await
+    auto publish = [this, tournamentId, matchId, match, score]() -> asio::awaitable<void> {
+        PublishScoreUpdated(tournamentId, matchId, *match, score);
+        co_return;
+    };
+    co_await asio::co_spawn(publisher, std::move(publish), asio::use_awaitable);
+
+    co_return std::expected<void, std::string>{};
+}
+
+std::expected<void, std::string>
+MatchDelegate::ValidateScoreUpdate(std::string_view tournamentId,
+                                   const domain::Match& match,
+                                   const domain::Score& score) {
     // Validar que el match pertenece al torneo
-    if (match->TournamentId() != tournamentId) {
+    if (match.TournamentId() != tournamentId) {
         return std::unexpected("Match does not belong to the specified tournament");
     }
 
     // Validar que el match ya tenga a ambos equipos
-    if (match->getHome().id == "" || match->getVisitor().id == "") {
+    if (match.getHome().id == "" || match.getVisitor().id == "") {
         return std::unexpected("Match teams are not ready");
     }
 
     // Validar que el match no sea de playoff ya jugado
-    if (match->Round() != domain::RoundType::REGULAR && match->IsPlayed()) {
+    if (match.Round() != domain::RoundType::REGULAR && match.IsPlayed()) {
         return std::unexpected("Cannot modify an already played playoff game");
     }
 
     // Validar el score según las reglas del torneo
-    if (!ValidateScore(score, *tournament, match->Round())) {
+    if (!ValidateScore(score, match.Round())) {
         return std::unexpected("Invalid score for this tournament format and round");
     }
 
-    // Actualizar el match con el score
-    match->MatchScore() = score;
-    auto updateResult = matchRepository->Update(matchId.data(), *match);
-    if (!updateResult) {
-        return std::unexpected(updateResult.error());
-    }
+    return {};
+}
 
+void MatchDelegate::PublishScoreUpdated(std::string_view tournamentId, std::string_view matchId,
+                                        const domain::Match& match, const domain::Score& score) {
     // Publicar evento de actualización de score
     nlohmann::json event;
     event["tournamentId"] = tournamentId;
     event["matchId"] = matchId;
-    event["round"] = static_cast<int>(match->Round());
-    event["homeTeamId"] = match->getHome().id;
-    event["visitorTeamId"] = match->getVisitor().id;
+    event["round"] = static_cast<int>(match.Round());
+    event["homeTeamId"] = match.getHome().id;
+    event["visitorTeamId"] = match.getVisitor().id;
     event["homeScore"] = score.homeTeamScore;
     event["visitorScore"] = score.visitorTeamScore;
     
-    if (match->WinnerNextMatchId() != "") {
-        event["winnerNextMatchId"] = match->WinnerNextMatchId();
+    if (match.WinnerNextMatchId() != "") {
+        event["winnerNextMatchId"] = match.WinnerNextMatchId();
     }
 
     messageProducer->SendMessage(event.dump(), "match.score-updated");
 
-    if (match->Round() == domain::RoundType::SUPERBOWL) {
-        tournament->Finished() = "yes";
-        auto tournamentUpdateResult = tournamentRepository->Update(tournament->Id(), *tournament);
-        if (!tournamentUpdateResult) {
-            return std::unexpected(tournamentUpdateResult.error());
-        }
+    // UPDATE_MATCH_SCORE cierra el torneo en la misma sentencia; los cachés de torneo se enteran por aquí
+    if (match.Round() == domain::RoundType::SUPERBOWL) {
+        messageProducer->Publish(tournamentId, "tournament.updated");
     }
+}
 
-    return {};
+std::vector<domain::RoundType> MatchDelegate::ValidScoreRounds(const domain::Score& score) {
+    std::vector<domain::RoundType> rounds;
+    for (const auto round : {domain::RoundType::REGULAR, domain::RoundType::WILDCARD, domain::RoundType::DIVISIONAL,
+                             domain::RoundType::CHAMPIONSHIP, domain::RoundType::SUPERBOWL}) {
+        if (ValidateScore(score, round)) {
+            rounds.push_back(round);
+        }
+    }
+    return rounds;
 }
 
 bool MatchDelegate::ValidateScore(const domain::Score& score,
-                                  const domain::Tournament& tournament,
                                   domain::RoundType round) {
     auto strategy = strategies["NFL"];
 
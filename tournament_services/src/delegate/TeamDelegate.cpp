@@ -8,8 +8,9 @@
 #include <string_view>
 #include <memory>
 
-TeamDelegate::TeamDelegate(std::shared_ptr<IRepository<domain::Team, std::string, std::expected<std::string, std::string>>> repository)
-    : teamRepository(std::move(repository)) {
+TeamDelegate::TeamDelegate(std::shared_ptr<IRepository<domain::Team, std::string, std::expected<std::string, std::string>>> repository,
+                           std::shared_ptr<IPagedRepository<domain::Team, std::string>> pages)
+    : teamRepository(std::move(repository)), teamPages(std::move(pages)) {
 }
 
 std::expected<std::string, std::string> TeamDelegate::CreateTeam(std::shared_ptr<domain::Team> team) {
@@ -20,8 +21,8 @@ std::expected<std::shared_ptr<domain::Team>, std::string> TeamDelegate::GetTeam(
     return teamRepository->ReadById(std::string(id));
 }
 
-std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string> TeamDelegate::ReadAll() {
-    return teamRepository->ReadAll();
+std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string> TeamDelegate::ReadPage(const std::optional<std::string>& after, size_t limit) {
+    return teamPages->ReadPage(after, limit);
 }
 
 std::expected<std::string, std::string> TeamDelegate::UpdateTeam(std::string_view id, std::shared_ptr<domain::Team> team) {
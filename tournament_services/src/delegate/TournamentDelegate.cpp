@@ -9,14 +9,17 @@
 
 #include "persistence/repository/IRepository.hpp"
 
-TournamentDelegate::TournamentDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>> > repository, std::shared_ptr<QueueMessageProducer> producer) : tournamentRepository(std::move(repository)), producer(std::move(producer)) {
+TournamentDelegate::TournamentDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>> > repository,
+                                       std::shared_ptr<IPagedRepository<domain::Tournament, std::string>> pages,
+                                       std::shared_ptr<QueueMessageProducer> producer)
+    : tournamentRepository(std::move(repository)), tournamentPages(std::move(pages)), producer(std::move(producer)) {
 }
 
 std::expected<std::string, std::string> TournamentDelegate::CreateTournament(std::shared_ptr<domain::Tournament> tournament) {
     const auto result = tournamentRepository->Create(*tournament);
 
     if (result) {
-        producer->SendMessage(*result, "tournament.created");
+        producer->Publish(*result, "tournament.created");
     }
 
     return result;
@@ -26,15 +29,15 @@ std::expected<std::shared_ptr<domain::Tournament>, std::string> TournamentDelega
     return tournamentRepository->ReadById(id.data());
 }
 
-std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string> TournamentDelegate::ReadAll() {
-    return tournamentRepository->ReadAll();
+std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string> TournamentDelegate::ReadPage(const std::optional<std::string>& after, size_t limit) {
+    return tournamentPages->ReadPage(after, limit);
 }
 
 std::expected<std::string, std::string> TournamentDelegate::UpdateTournament(std::string_view id, std::shared_ptr<domain::Tournament> tournament) {
     const auto result = tournamentRepository->Update(id.data(), *tournament);
 
     if (result) {
-        producer->SendMessage(*result, "tournament.updated");
+        producer->Publish(*result, "tournament.updated");
     }
 
     return result;
@@ -44,7 +47,7 @@ std::expected<void, std::string> TournamentDelegate::DeleteTournament(std::strin
     const auto result = tournamentRepository->Delete(id.data());
 
     if (result) {
-        producer->SendMessage(std::string(id), "tournament.deleted");
+        producer->Publish(std::string(id), "tournament.deleted");
     }
 
     return result;
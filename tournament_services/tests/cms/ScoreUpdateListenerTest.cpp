@@ -10,7 +10,7 @@
 
 class MatchDelegate2Mock : public MatchDelegate2 {
 public:
-    MatchDelegate2Mock(): MatchDelegate2(nullptr, nullptr, nullptr) {}
+    MatchDelegate2Mock(): MatchDelegate2(nullptr, nullptr, nullptr, nullptr) {}
 
     MOCK_METHOD(void, ProcessTeamAddition, (const TeamAddEvent& teamAddEvent), (override));
     MOCK_METHOD(void, ProcessScoreUpdate, (const ScoreUpdateEvent& scoreUpdateEvent), (override));
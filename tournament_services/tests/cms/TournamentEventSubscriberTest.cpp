@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "cms/TournamentEventSubscriber.hpp"
+#include "persistence/repository/CacheRegistry.hpp"
+
+class TournamentEventSubscriberTest : public ::testing::Test{
+protected:
+    std::shared_ptr<ConnectionManager> connectionManager;
+    std::shared_ptr<CacheRegistry> caches;
+    std::shared_ptr<TournamentEventSubscriber> subscriber;
+    std::vector<std::string> evictedTournaments;
+    std::vector<std::string> evictedTeams;
+
+    void SetUp() override {
+        connectionManager = std::make_shared<ConnectionManager>();
+        caches = std::make_shared<CacheRegistry>();
+        caches->Register(TournamentEventSubscriber::CACHE, [this](const std::string& id) { evictedTournaments.push_back(id); });
+        caches->Register("team", [this](const std::string& id) { evictedTeams.push_back(id); });
+        subscriber = std::make_shared<TournamentEventSubscriber>(connectionManager, caches);
+    }
+};
+
+TEST_F(TournamentEventSubscriberTest, ProcessMessageEvictsTournamentTest) {
+    subscriber->processMessage("tournament-id");
+
+    ASSERT_EQ(evictedTournaments.size(), 1);
+    EXPECT_EQ(evictedTournaments[0], "tournament-id");
+    EXPECT_TRUE(evictedTeams.empty());
+}
+
+TEST_F(TournamentEventSubscriberTest, ProcessMessageEmptyTest) {
+    subscriber->processMessage("");
+
+    EXPECT_TRUE(evictedTournaments.empty());
+}
+
+TEST_F(TournamentEventSubscriberTest, ProcessMessageWithoutCacheTest) {
+    auto uncachedSubscriber = std::make_shared<TournamentEventSubscriber>(connectionManager, std::make_shared<CacheRegistry>());
+
+    EXPECT_NO_THROW(uncachedSubscriber->processMessage("tournament-id"));
+    EXPECT_TRUE(evictedTournaments.empty());
+}
+
+TEST_F(TournamentEventSubscriberTest, SubscribesToTournamentTopicsTest) {
+    EXPECT_EQ(TournamentEventSubscriber::TOPICS,
+              (std::vector<std::string>{"tournament.created", "tournament.updated", "tournament.deleted"}));
+}
+
+// Sin conexión al broker Start informa el error y no deja la sesión a medias: el siguiente
+// Start vuelve a intentar la suscripción en vez de darla por hecha
+TEST_F(TournamentEventSubscriberTest, StartFailureAllowsRetryTest) {
+    const auto first = subscriber->Start(TournamentEventSubscriber::TOPICS);
+    const auto second = subscriber->Start(TournamentEventSubscriber::TOPICS);
+
+    ASSERT_FALSE(first.has_value());
+    EXPECT_EQ(first.error(), "Topic subscription failed: Connection not initialized");
+    EXPECT_FALSE(second.has_value());
+}
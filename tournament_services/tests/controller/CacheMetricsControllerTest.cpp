@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <crow.h>
+#include <nlohmann/json.hpp>
+
+#include "controller/CacheMetricsController.hpp"
+#include "domain/Tournament.hpp"
+#include "persistence/repository/CachedRepository.hpp"
+
+class TournamentStoreMock : public IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>> {
+public:
+    MOCK_METHOD((std::expected<std::string, std::string>), Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>), ReadAll, (), (override));
+    MOCK_METHOD((std::expected<std::shared_ptr<domain::Tournament>, std::string>), ReadById, (std::string id), (override));
+    MOCK_METHOD((std::expected<std::string, std::string>), Update, (std::string id, const domain::Tournament& entity), (override));
+    MOCK_METHOD((std::expected<void, std::string>), Delete, (std::string id), (override));
+};
+
+class CacheMetricsControllerTest : public ::testing::Test {
+protected:
+    std::shared_ptr<CacheMetrics> metrics;
+    std::shared_ptr<TournamentStoreMock> repositoryMock;
+    std::shared_ptr<CacheMetricsController> controller;
+
+    void SetUp() override {
+        metrics = std::make_shared<CacheMetrics>();
+        repositoryMock = std::make_shared<TournamentStoreMock>();
+        controller = std::make_shared<CacheMetricsController>(metrics);
+    }
+
+    std::shared_ptr<CachedRepository<domain::Tournament>> Cache(size_t capacity, long ttlMs) {
+        config::CacheConfiguration configuration;
+        configuration.capacity = capacity;
+        configuration.shards = 1;
+        configuration.ttlMs = ttlMs;
+        return std::make_shared<CachedRepository<domain::Tournament>>(repositoryMock, "tournament", configuration, metrics);
+    }
+
+    static std::expected<std::shared_ptr<domain::Tournament>, std::string> TournamentWithId(const std::string& id) {
+        auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
+        tournament->Id() = id;
+        return tournament;
+    }
+};
+
+TEST_F(CacheMetricsControllerTest, GetCacheMetricsTest) {
+    auto cache = Cache(16, 60000);
+    EXPECT_CALL(*repositoryMock, ReadById("tournament-id"))
+        .WillOnce(testing::Return(TournamentWithId("tournament-id")));
+
+    const auto first = cache->ReadById("tournament-id");
+    const auto second = cache->ReadById("tournament-id");
+    testing::Mock::VerifyAndClearExpectations(repositoryMock.get());
+
+    crow::response response = controller->GetCacheMetrics();
+    auto body = nlohmann::json::parse(response.body);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_EQ(response.get_header_value("content-type"), "application/json");
+    ASSERT_EQ(body.size(), 1);
+    EXPECT_EQ(body[0]["cache"], "tournament");
+    EXPECT_EQ(body[0]["hits"], 1);
+    EXPECT_EQ(body[0]["misses"], 1);
+    EXPECT_DOUBLE_EQ(body[0]["hitRatio"].get<double>(), 0.5);
+}
+
+TEST_F(CacheMetricsControllerTest, ResetCacheMetricsTest) {
+    metrics->For("tournament").hits.fetch_add(3);
+
+    crow::response response = controller->ResetCacheMetrics();
+    auto body = nlohmann::json::parse(controller->GetCacheMetrics().body);
+
+    EXPECT_EQ(response.code, crow::NO_CONTENT);
+    ASSERT_EQ(body.size(), 1);
+    EXPECT_EQ(body[0]["hits"], 0);
+}
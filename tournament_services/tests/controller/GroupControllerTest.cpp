@@ -14,6 +14,7 @@ class GroupDelegateMock : public IGroupDelegate {
 public:
     MOCK_METHOD((std::expected<std::string, std::string>), CreateGroup, (const std::string_view& tournamentId, const domain::Group& group), (override));
     MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>), GetGroups, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD((std::expected<int64_t, std::string>), GetGroupsVersion, (const std::string_view& tournamentId), (override));
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Group>, std::string>), GetGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
     MOCK_METHOD((std::expected<void, std::string>), UpdateGroup, (const std::string_view& tournamentId, const domain::Group& group, const bool updateTeams), (override));
     MOCK_METHOD((std::expected<void, std::string>), RemoveGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
@@ -23,11 +24,13 @@ public:
 class GroupControllerTest : public ::testing::Test{
 protected:
     std::shared_ptr<GroupDelegateMock> groupDelegateMock;
+    std::shared_ptr<ResponseCache> responseCache;
     std::shared_ptr<GroupController> groupController;
 
     void SetUp() override {
         groupDelegateMock = std::make_shared<GroupDelegateMock>();
-        groupController = std::make_shared<GroupController>(GroupController(groupDelegateMock));
+        responseCache = std::make_shared<ResponseCache>(config::CacheConfiguration{}, std::make_shared<CacheMetrics>());
+        groupController = std::make_shared<GroupController>(GroupController(groupDelegateMock, responseCache));
     }
 
     // TearDown() function
@@ -264,7 +267,8 @@ TEST_F(GroupControllerTest, GetGroupsSuccessTest) {
         );
 
     std::string tournamentId = "read-tournament-id";
-    auto response = groupController->GetGroups(tournamentId);
+    crow::request request;
+    auto response = groupController->GetGroups(request, tournamentId);
     auto bodyJson = nlohmann::json::parse(response.body);
 
     testing::Mock::VerifyAndClearExpectations(&groupDelegateMock);
@@ -301,7 +305,8 @@ TEST_F(GroupControllerTest, GetGroupsEmptyTest) {
         );
 
     std::string tournamentId = "read-tournament-id";
-    auto response = groupController->GetGroups(tournamentId);
+    crow::request request;
+    auto response = groupController->GetGroups(request, tournamentId);
     auto bodyJson = nlohmann::json::parse(response.body);
 
     testing::Mock::VerifyAndClearExpectations(&groupDelegateMock);
@@ -318,7 +323,8 @@ TEST_F(GroupControllerTest, GetGroupsInvalidTournamentIDTest) {
         .Times(0);
 
     std::string tournamentId = "bad tournament-id";
-    auto response = groupController->GetGroups(tournamentId);
+    crow::request request;
+    auto response = groupController->GetGroups(request, tournamentId);
 
     testing::Mock::VerifyAndClearExpectations(&groupDelegateMock);
     
@@ -331,7 +337,8 @@ TEST_F(GroupControllerTest, GetGroupsDBFailTest) {
         .WillOnce(testing::Return(std::unexpected<std::string>("Database connection failed")));
 
     std::string tournamentId = "tournament-id";
-    auto response = groupController->GetGroups(tournamentId);
+    crow::request request;
+    auto response = groupController->GetGroups(request, tournamentId);
 
     testing::Mock::VerifyAndClearExpectations(&groupDelegateMock);
     
@@ -339,6 +346,110 @@ TEST_F(GroupControllerTest, GetGroupsDBFailTest) {
     EXPECT_EQ(response.body, "Database connection failed");
 }
 
+TEST_F(GroupControllerTest, GetGroupsETagTest) {
+    EXPECT_CALL(*groupDelegateMock, GetGroupsVersion(std::string_view("tournament-id")))
+        .WillOnce(testing::Return(std::expected<int64_t, std::string>(4)));
+    EXPECT_CALL(*groupDelegateMock, GetGroups(::testing::_))
+        .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>(std::vector<std::shared_ptr<domain::Group>>{})));
+
+    crow::request request;
+    request.add_header("If-None-Match", "\"groups-3\"");
+    auto response = groupController->GetGroups(request, "tournament-id");
+
+    testing::Mock::VerifyAndClearExpectations(&groupDelegateMock);
+
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_EQ(response.body, "[]");
+    EXPECT_EQ(response.get_header_value("etag"), "W/\"groups-4\"");
+    EXPECT_EQ(response.get_header_value("cache-control"), "no-cache");
+}
+
+TEST_F(GroupControllerTest, GetGroupsNotModifiedTest) {
+    EXPECT_CALL(*groupDelegateMock, GetGroupsVersion(std::string_view("tournament-id")))
+        .WillOnce(testing::Return(std::expected<int64_t, std::string>(4)));
+    // Con la versión vigente no se leen los grupos
+    EXPECT_CALL(*groupDelegateMock, GetGroups(::testing::_))
+        .Times(0);
+
+    crow::request request;
+    request.add_header("If-None-Match", "\"groups-3\", W/\"groups-4\"");
+    auto response = groupController->GetGroups(request, "tournament-id");
+
+    testing::Mock::VerifyAndClearExpectations(&groupDelegateMock);
+
+    EXPECT_EQ(response.code, crow::NOT_MODIFIED);
+    EXPECT_TRUE(response.body.empty());
+    EXPECT_EQ(response.get_header_value("etag"), "W/\"groups-4\"");
+    EXPECT_EQ(response.get_header_value("vary"), "accept-encoding");
+}
+
+TEST_F(GroupControllerTest, GetGroupsWithoutVersionTest) {
+    EXPECT_CALL(*groupDelegateMock, GetGroupsVersion(::testing::_))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Tournament not found")));
+    EXPECT_CALL(*groupDelegateMock, GetGroups(::testing::_))
+        .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>(std::vector<std::shared_ptr<domain::Group>>{})));
+
+    crow::request request;
+    request.add_header("If-None-Match", "*");
+    auto response = groupController->GetGroups(request, "tournament-id");
+
+    testing::Mock::VerifyAndClearExpectations(&groupDelegateMock);
+
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_TRUE(response.get_header_value("etag").empty());
+}
+
+TEST_F(GroupControllerTest, GetGroupsCachedBodyTest) {
+    EXPECT_CALL(*groupDelegateMock, GetGroupsVersion(std::string_view("tournament-id")))
+        .WillRepeatedly(testing::Return(std::expected<int64_t, std::string>(4)));
+    // La segunda lectura con la misma versión sale del caché
+    nlohmann::json group = {{"id", "group-id"}, {"name", "name"}, {"region", "region"}, {"conference", "AFC"}, {"tournamentId", "tournament-id"}, {"teams", nlohmann::json::array()}};
+    EXPECT_CALL(*groupDelegateMock, GetGroups(::testing::_))
+        .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>(
+            std::vector<std::shared_ptr<domain::Group>>{std::make_shared<domain::Group>(group)})));
+
+    crow::request request;
+    auto first = groupController->GetGroups(request, "tournament-id");
+    crow::request gzipRequest;
+    gzipRequest.add_header("Accept-Encoding", "gzip, deflate");
+    auto second = groupController->GetGroups(gzipRequest, "tournament-id");
+    auto third = groupController->GetGroups(request, "tournament-id");
+
+    testing::Mock::VerifyAndClearExpectations(&groupDelegateMock);
+
+    EXPECT_EQ(first.code, crow::OK);
+    EXPECT_TRUE(first.get_header_value("content-encoding").empty());
+    EXPECT_EQ(second.code, crow::OK);
+    EXPECT_EQ(second.get_header_value("content-encoding"), "gzip");
+    EXPECT_EQ(second.get_header_value("etag"), "W/\"groups-4\"");
+    EXPECT_NE(second.body, first.body);
+    EXPECT_EQ(third.body, first.body);
+    EXPECT_EQ(nlohmann::json::parse(third.body)[0]["id"], "group-id");
+}
+
+TEST_F(GroupControllerTest, GetGroupsAfterTeamsUpdateTest) {
+    EXPECT_CALL(*groupDelegateMock, GetGroupsVersion(::testing::_))
+        .WillRepeatedly(testing::Return(std::expected<int64_t, std::string>(4)));
+    EXPECT_CALL(*groupDelegateMock, UpdateTeams(::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(testing::Return(std::expected<void, std::string>()));
+    // Agregar equipos suelta los cuerpos del torneo aunque la versión leída no cambie
+    EXPECT_CALL(*groupDelegateMock, GetGroups(::testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>(std::vector<std::shared_ptr<domain::Group>>{})));
+
+    crow::request request;
+    groupController->GetGroups(request, "tournament-id");
+    crow::request teamsRequest;
+    teamsRequest.body = R"([{"id": "team-id", "name": "Team"}])";
+    auto updated = groupController->UpdateTeams(teamsRequest, "tournament-id", "group-id");
+    auto response = groupController->GetGroups(request, "tournament-id");
+
+    testing::Mock::VerifyAndClearExpectations(&groupDelegateMock);
+
+    EXPECT_EQ(updated.code, crow::NO_CONTENT);
+    EXPECT_EQ(response.code, crow::OK);
+}
+
 TEST_F(GroupControllerTest, UpdateGroupSuccessTest) {
     std::string capturedTournamentId;
     domain::Group capturedGroup;
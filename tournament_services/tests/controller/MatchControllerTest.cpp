@@ -5,6 +5,9 @@
 #include <gmock/gmock.h>
 #include <crow.h>
 #include <expected>
+#include <functional>
+#include <stdexcept>
+#include <asio.hpp>
 
 #include "domain/Match.hpp"
 #include "delegate/IMatchDelegate.h"
@@ -13,19 +16,40 @@
 
 class MatchDelegateMock : public IMatchDelegate {
 public:
-    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>), GetMatches, (std::string_view tournamentId, std::optional<std::string> filter), (override));
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Match>, std::string>), GetMatch, (std::string_view tournamentId, std::string_view matchId), (override));
-    MOCK_METHOD((std::expected<void, std::string>), UpdateMatchScore, (std::string_view tournamentId, std::string_view matchId, const domain::Score& score), (override));
+    MOCK_METHOD((asio::awaitable<std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>>), GetMatchesAsync, (std::string tournamentId, std::optional<std::string> filter), (override));
+    MOCK_METHOD((asio::awaitable<std::expected<void, std::string>>), UpdateMatchScoreAsync, (std::string tournamentId, std::string matchId, domain::Score score), (override));
+    MOCK_METHOD((asio::awaitable<std::expected<int64_t, std::string>>), GetMatchesVersionAsync, (std::string tournamentId), (override));
 };
 
+using MatchesResult = std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>;
+using ScoreResult = std::expected<void, std::string>;
+using VersionResult = std::expected<int64_t, std::string>;
+
+template<typename T>
+asio::awaitable<T> Ready(T value) {
+    co_return value;
+}
+
+// Acción para los métodos asíncronos: devuelve una corrutina que termina con el valor dado
+template<typename T>
+auto ReturnReady(T value) {
+    return [value](auto&&...) { return Ready(value); };
+}
+
 class MatchControllerTest : public ::testing::Test{
 protected:
     std::shared_ptr<MatchDelegateMock> matchDelegateMock;
+    std::shared_ptr<ResponseCache> responseCache;
     std::shared_ptr<MatchController> matchController;
 
     void SetUp() override {
         matchDelegateMock = std::make_shared<MatchDelegateMock>();
-        matchController = std::make_shared<MatchController>(MatchController(matchDelegateMock));
+        responseCache = std::make_shared<ResponseCache>(config::CacheConfiguration{}, std::make_shared<CacheMetrics>());
+        matchController = std::make_shared<MatchController>(MatchController(matchDelegateMock, responseCache));
+        // Un awaitable vacío no se puede esperar; los tests que no revisan el ETag reciben una versión cualquiera
+        ON_CALL(*matchDelegateMock, GetMatchesVersionAsync(::testing::_))
+            .WillByDefault(ReturnReady(VersionResult(1)));
     }
 
     // TearDown() function
@@ -33,6 +57,16 @@ protected:
         // teardown code comes here
     }
 
+    // Corre un handler asíncrono hasta que completa la respuesta
+    crow::response Dispatch(crow::request& request, const std::function<void(crow::response&)>& handler) {
+        asio::io_context ioContext;
+        request.io_context = &ioContext;
+        crow::response response;
+        handler(response);
+        ioContext.run();
+        return response;
+    }
+
 };
 
 TEST_F(MatchControllerTest, GetMatchesSuccessTest) {
@@ -47,18 +81,18 @@ TEST_F(MatchControllerTest, GetMatchesSuccessTest) {
     nlohmann::json body2 = {{"id", "match2-id"}, {"tournamentId", "tournament-id"}, {"round", "regular"}, {"home", {{"id", "team3-id"}, {"name", "T3"}}}, {"visitor", {{"id", "team4-id"}, {"name", "T4"}}}};
     matches.push_back(std::make_shared<domain::Match>(body2));
 
-    EXPECT_CALL(*matchDelegateMock, GetMatches(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
                     testing::SaveArg<0>(&capturedTournamentId),
                     testing::SaveArg<1>(&capturedFilter),
-                    testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(matches))
+                    ReturnReady(MatchesResult(matches))
                 )
             );
 
     crow::request mockRequest;
     mockRequest.url = "/tournaments/tournament-id/matches";
     std::string tournamentId = "tournament-id";
-    auto response = matchController->GetMatches(mockRequest, tournamentId);
+    auto response = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
     auto bodyJson = nlohmann::json::parse(response.body);
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
@@ -90,11 +124,11 @@ TEST_F(MatchControllerTest, GetMatchesEmptyTest) {
 
     std::vector<std::shared_ptr<domain::Match>> matches;
 
-    EXPECT_CALL(*matchDelegateMock, GetMatches(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
                     testing::SaveArg<0>(&capturedTournamentId),
                     testing::SaveArg<1>(&capturedFilter),
-                    testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(matches))
+                    ReturnReady(MatchesResult(matches))
                 )
             );
 
@@ -102,7 +136,7 @@ TEST_F(MatchControllerTest, GetMatchesEmptyTest) {
     mockRequest.url = "/tournaments/tournament-id/matches?showMatches=played";
     mockRequest.url_params = crow::query_string(mockRequest.url);
     std::string tournamentId = "tournament-id";
-    auto response = matchController->GetMatches(mockRequest, tournamentId);
+    auto response = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
     auto bodyJson = nlohmann::json::parse(response.body);
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
@@ -116,14 +150,14 @@ TEST_F(MatchControllerTest, GetMatchesEmptyTest) {
 }
 
 TEST_F(MatchControllerTest, GetMatchesWrongFilterTest) {
-    EXPECT_CALL(*matchDelegateMock, GetMatches(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
         .Times(0);
 
     crow::request mockRequest;
     mockRequest.url = "/tournaments/tournament-id/matches?showMatches=wrong";
     mockRequest.url_params = crow::query_string(mockRequest.url);
     std::string tournamentId = "tournament-id";
-    auto response = matchController->GetMatches(mockRequest, tournamentId);
+    auto response = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
     
@@ -135,18 +169,18 @@ TEST_F(MatchControllerTest, GetMatchesTournamentNotFoundTest) {
     std::string capturedTournamentId;
     std::optional<std::string> capturedFilter;
 
-    EXPECT_CALL(*matchDelegateMock, GetMatches(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
                     testing::SaveArg<0>(&capturedTournamentId),
                     testing::SaveArg<1>(&capturedFilter),
-                    testing::Return(std::unexpected<std::string>("Tournament not found"))
+                    ReturnReady(MatchesResult(std::unexpected<std::string>("Tournament not found")))
                 )
             );
 
     crow::request mockRequest;
     mockRequest.url = "/tournaments/tournament-id/matches";
     std::string tournamentId = "tournament-id";
-    auto response = matchController->GetMatches(mockRequest, tournamentId);
+    auto response = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
     
@@ -161,18 +195,18 @@ TEST_F(MatchControllerTest, GetMatchesDataBaseFailTest) {
     std::string capturedTournamentId;
     std::optional<std::string> capturedFilter;
 
-    EXPECT_CALL(*matchDelegateMock, GetMatches(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
                     testing::SaveArg<0>(&capturedTournamentId),
                     testing::SaveArg<1>(&capturedFilter),
-                    testing::Return(std::unexpected<std::string>("Selection fail"))
+                    ReturnReady(MatchesResult(std::unexpected<std::string>("Selection fail")))
                 )
             );
 
     crow::request mockRequest;
     mockRequest.url = "/tournaments/tournament-id/matches";
     std::string tournamentId = "tournament-id";
-    auto response = matchController->GetMatches(mockRequest, tournamentId);
+    auto response = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
     
@@ -183,6 +217,141 @@ TEST_F(MatchControllerTest, GetMatchesDataBaseFailTest) {
     EXPECT_EQ(response.body, "Selection fail");
 }
 
+TEST_F(MatchControllerTest, GetMatchesDelegateThrowsTest) {
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
+        .WillOnce([](auto&&...) -> asio::awaitable<MatchesResult> {
+            throw std::runtime_error("connection lost");
+            co_return MatchesResult();
+        });
+
+    crow::request mockRequest;
+    mockRequest.url = "/tournaments/tournament-id/matches";
+    std::string tournamentId = "tournament-id";
+    auto response = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
+
+    testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
+
+    EXPECT_EQ(response.code, crow::INTERNAL_SERVER_ERROR);
+}
+
+TEST_F(MatchControllerTest, GetMatchesETagTest) {
+    EXPECT_CALL(*matchDelegateMock, GetMatchesVersionAsync("tournament-id"))
+        .WillOnce(ReturnReady(VersionResult(12)));
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(MatchesResult(std::vector<std::shared_ptr<domain::Match>>{})));
+
+    crow::request mockRequest;
+    mockRequest.url = "/tournaments/tournament-id/matches?showMatches=pending";
+    mockRequest.url_params = crow::query_string(mockRequest.url);
+    // Etiqueta de otro filtro: no aplica a este listado
+    mockRequest.add_header("If-None-Match", "\"matches-played-12\"");
+    std::string tournamentId = "tournament-id";
+    auto response = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
+
+    testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
+
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_EQ(response.body, "[]");
+    EXPECT_EQ(response.get_header_value("etag"), "W/\"matches-pending-12\"");
+    EXPECT_EQ(response.get_header_value("cache-control"), "no-cache");
+}
+
+TEST_F(MatchControllerTest, GetMatchesNotModifiedTest) {
+    EXPECT_CALL(*matchDelegateMock, GetMatchesVersionAsync("tournament-id"))
+        .WillOnce(ReturnReady(VersionResult(12)));
+    // Con la versión vigente no se leen los matches
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
+        .Times(0);
+
+    crow::request mockRequest;
+    mockRequest.url = "/tournaments/tournament-id/matches?showMatches=pending";
+    mockRequest.url_params = crow::query_string(mockRequest.url);
+    mockRequest.add_header("If-None-Match", "\"matches-pending-12\"");
+    std::string tournamentId = "tournament-id";
+    auto response = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
+
+    testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
+
+    EXPECT_EQ(response.code, crow::NOT_MODIFIED);
+    EXPECT_TRUE(response.body.empty());
+    EXPECT_EQ(response.get_header_value("etag"), "W/\"matches-pending-12\"");
+    EXPECT_EQ(response.get_header_value("vary"), "accept-encoding");
+}
+
+TEST_F(MatchControllerTest, GetMatchesWithoutVersionTest) {
+    EXPECT_CALL(*matchDelegateMock, GetMatchesVersionAsync(::testing::_))
+        .WillOnce(ReturnReady(VersionResult(std::unexpected<std::string>("Tournament not found"))));
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(MatchesResult(std::unexpected<std::string>("Tournament not found"))));
+
+    crow::request mockRequest;
+    mockRequest.url = "/tournaments/tournament-id/matches";
+    mockRequest.add_header("If-None-Match", "*");
+    std::string tournamentId = "tournament-id";
+    auto response = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
+
+    testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
+
+    EXPECT_EQ(response.code, crow::NOT_FOUND);
+    EXPECT_TRUE(response.get_header_value("etag").empty());
+}
+
+TEST_F(MatchControllerTest, GetMatchesCachedBodyTest) {
+    EXPECT_CALL(*matchDelegateMock, GetMatchesVersionAsync("tournament-id"))
+        .WillOnce(ReturnReady(VersionResult(12)))
+        .WillOnce(ReturnReady(VersionResult(12)))
+        .WillOnce(ReturnReady(VersionResult(13)));
+    // Misma versión: la segunda respuesta copia el cuerpo guardado; la versión 13 vuelve a leer
+    nlohmann::json match = {{"id", "match-id"}, {"tournamentId", "tournament-id"}, {"round", "regular"}, {"home", {{"id", "team1-id"}, {"name", "T1"}}}, {"visitor", {{"id", "team2-id"}, {"name", "T2"}}}};
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(MatchesResult(std::vector<std::shared_ptr<domain::Match>>{std::make_shared<domain::Match>(match)})))
+        .WillOnce(ReturnReady(MatchesResult(std::vector<std::shared_ptr<domain::Match>>{})));
+
+    crow::request mockRequest;
+    mockRequest.url = "/tournaments/tournament-id/matches";
+    mockRequest.add_header("Accept-Encoding", "gzip");
+    std::string tournamentId = "tournament-id";
+    auto first = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
+    auto second = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
+    auto third = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
+
+    testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
+
+    EXPECT_EQ(first.code, crow::OK);
+    EXPECT_EQ(first.get_header_value("content-encoding"), "gzip");
+    EXPECT_EQ(first.get_header_value("vary"), "accept-encoding");
+    EXPECT_EQ(second.code, crow::OK);
+    EXPECT_EQ(second.body, first.body);
+    EXPECT_EQ(second.get_header_value("etag"), "W/\"matches-12\"");
+    EXPECT_EQ(third.get_header_value("etag"), "W/\"matches-13\"");
+    EXPECT_NE(third.body, first.body);
+}
+
+TEST_F(MatchControllerTest, GetMatchesAfterScoreUpdateTest) {
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(ScoreResult()));
+    // El marcador suelta los cuerpos del torneo aunque la versión leída no cambie
+    EXPECT_CALL(*matchDelegateMock, GetMatchesAsync(::testing::_, ::testing::_))
+        .Times(2)
+        .WillRepeatedly(ReturnReady(MatchesResult(std::vector<std::shared_ptr<domain::Match>>{})));
+
+    crow::request mockRequest;
+    mockRequest.url = "/tournaments/tournament-id/matches";
+    std::string tournamentId = "tournament-id";
+    Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
+
+    crow::request scoreRequest;
+    scoreRequest.body = R"({"score": {"home": 6, "visitor": 7}})";
+    auto updated = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, "match-id"); });
+    auto response = Dispatch(mockRequest, [&](crow::response& r) { matchController->GetMatches(mockRequest, r, tournamentId); });
+
+    testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
+
+    EXPECT_EQ(updated.code, crow::NO_CONTENT);
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_EQ(response.body, "[]");
+}
+
 TEST_F(MatchControllerTest, GetMatchSuccessTest) {
     std::string capturedTournamentId;
     std::string capturedMatchId;
@@ -294,12 +463,12 @@ TEST_F(MatchControllerTest, UpdateMatchScoreSuccessTest) {
     std::string capturedMatchId;
     domain::Score capturedScore;
 
-    EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(::testing::_, ::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
                     testing::SaveArg<0>(&capturedTournamentId),
                     testing::SaveArg<1>(&capturedMatchId),
                     testing::SaveArg<2>(&capturedScore),
-                    testing::Return(std::expected<void, std::string>())
+                    ReturnReady(ScoreResult())
                 )
             );
 
@@ -308,7 +477,7 @@ TEST_F(MatchControllerTest, UpdateMatchScoreSuccessTest) {
     scoreRequest.body = scoreRequestBody.dump();
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id";
-    auto response = matchController->UpdateMatchScore(scoreRequest, tournamentId, matchId);
+    auto response = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, matchId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
 
@@ -322,7 +491,7 @@ TEST_F(MatchControllerTest, UpdateMatchScoreSuccessTest) {
 }
 
 TEST_F(MatchControllerTest, UpdateMatchScoreInvalidScoreJsonTest) {
-    EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(::testing::_, ::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
         .Times(0);
 
     nlohmann::json scoreRequestBody = {{"spore", {{"home", 6}, {"visitor", 7}}}};
@@ -330,7 +499,7 @@ TEST_F(MatchControllerTest, UpdateMatchScoreInvalidScoreJsonTest) {
     scoreRequest.body = scoreRequestBody.dump();
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id";
-    auto response = matchController->UpdateMatchScore(scoreRequest, tournamentId, matchId);
+    auto response = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, matchId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
     
@@ -343,12 +512,12 @@ TEST_F(MatchControllerTest, UpdateMatchScoreMatchNotFoundTest) {
     std::string capturedMatchId;
     domain::Score capturedScore;
 
-    EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(::testing::_, ::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
                     testing::SaveArg<0>(&capturedTournamentId),
                     testing::SaveArg<1>(&capturedMatchId),
                     testing::SaveArg<2>(&capturedScore),
-                    testing::Return(std::unexpected<std::string>("Match not found"))
+                    ReturnReady(ScoreResult(std::unexpected<std::string>("Match not found")))
                 )
             );
 
@@ -357,7 +526,7 @@ TEST_F(MatchControllerTest, UpdateMatchScoreMatchNotFoundTest) {
     scoreRequest.body = scoreRequestBody.dump();
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id";
-    auto response = matchController->UpdateMatchScore(scoreRequest, tournamentId, matchId);
+    auto response = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, matchId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
 
@@ -376,12 +545,12 @@ TEST_F(MatchControllerTest, UpdateMatchScoreTournamentNotFoundTest) {
     std::string capturedMatchId;
     domain::Score capturedScore;
 
-    EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(::testing::_, ::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
                     testing::SaveArg<0>(&capturedTournamentId),
                     testing::SaveArg<1>(&capturedMatchId),
                     testing::SaveArg<2>(&capturedScore),
-                    testing::Return(std::unexpected<std::string>("Tournament not found"))
+                    ReturnReady(ScoreResult(std::unexpected<std::string>("Tournament not found")))
                 )
             );
 
@@ -390,7 +559,7 @@ TEST_F(MatchControllerTest, UpdateMatchScoreTournamentNotFoundTest) {
     scoreRequest.body = scoreRequestBody.dump();
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id";
-    auto response = matchController->UpdateMatchScore(scoreRequest, tournamentId, matchId);
+    auto response = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, matchId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
 
@@ -409,12 +578,12 @@ TEST_F(MatchControllerTest, UpdateMatchScoreInvalidScoreTest) {
     std::string capturedMatchId;
     domain::Score capturedScore;
 
-    EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(::testing::_, ::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
                     testing::SaveArg<0>(&capturedTournamentId),
                     testing::SaveArg<1>(&capturedMatchId),
                     testing::SaveArg<2>(&capturedScore),
-                    testing::Return(std::unexpected<std::string>("Invalid score for this tournament format and round"))
+                    ReturnReady(ScoreResult(std::unexpected<std::string>("Invalid score for this tournament format and round")))
                 )
             );
 
@@ -423,7 +592,7 @@ TEST_F(MatchControllerTest, UpdateMatchScoreInvalidScoreTest) {
     scoreRequest.body = scoreRequestBody.dump();
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id";
-    auto response = matchController->UpdateMatchScore(scoreRequest, tournamentId, matchId);
+    auto response = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, matchId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
 
@@ -442,12 +611,12 @@ TEST_F(MatchControllerTest, UpdateMatchScoreInvalidTieTest) {
     std::string capturedMatchId;
     domain::Score capturedScore;
 
-    EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(::testing::_, ::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
                     testing::SaveArg<0>(&capturedTournamentId),
                     testing::SaveArg<1>(&capturedMatchId),
                     testing::SaveArg<2>(&capturedScore),
-                    testing::Return(std::unexpected<std::string>("Tie not allowed"))
+                    ReturnReady(ScoreResult(std::unexpected<std::string>("Tie not allowed")))
                 )
             );
 
@@ -456,7 +625,7 @@ TEST_F(MatchControllerTest, UpdateMatchScoreInvalidTieTest) {
     scoreRequest.body = scoreRequestBody.dump();
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id";
-    auto response = matchController->UpdateMatchScore(scoreRequest, tournamentId, matchId);
+    auto response = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, matchId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
 
@@ -475,12 +644,12 @@ TEST_F(MatchControllerTest, UpdateMatchScoreDataBaseFailTest) {
     std::string capturedMatchId;
     domain::Score capturedScore;
 
-    EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(::testing::_, ::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
                     testing::SaveArg<0>(&capturedTournamentId),
                     testing::SaveArg<1>(&capturedMatchId),
                     testing::SaveArg<2>(&capturedScore),
-                    testing::Return(std::unexpected<std::string>("Database fail"))
+                    ReturnReady(ScoreResult(std::unexpected<std::string>("Database fail")))
                 )
             );
 
@@ -489,7 +658,7 @@ TEST_F(MatchControllerTest, UpdateMatchScoreDataBaseFailTest) {
     scoreRequest.body = scoreRequestBody.dump();
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id";
-    auto response = matchController->UpdateMatchScore(scoreRequest, tournamentId, matchId);
+    auto response = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, matchId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
 
@@ -504,14 +673,14 @@ TEST_F(MatchControllerTest, UpdateMatchScoreDataBaseFailTest) {
 }
 
 TEST_F(MatchControllerTest, UpdateMatchScoreInvalidJSONTest) {
-    EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(::testing::_, ::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
         .Times(0);
 
     crow::request scoreRequest;
     scoreRequest.body = R"({"score": {"home": 6, INVALID}})";
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id";
-    auto response = matchController->UpdateMatchScore(scoreRequest, tournamentId, matchId);
+    auto response = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, matchId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
     
@@ -520,14 +689,14 @@ TEST_F(MatchControllerTest, UpdateMatchScoreInvalidJSONTest) {
 }
 
 TEST_F(MatchControllerTest, UpdateMatchScoreMissingJSONFieldsTest) {
-    EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(::testing::_, ::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
         .Times(0);
 
     crow::request scoreRequest;
     scoreRequest.body = R"({"score": {"home": 6}})";
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id";
-    auto response = matchController->UpdateMatchScore(scoreRequest, tournamentId, matchId);
+    auto response = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, matchId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
     
@@ -536,14 +705,14 @@ TEST_F(MatchControllerTest, UpdateMatchScoreMissingJSONFieldsTest) {
 }
 
 TEST_F(MatchControllerTest, UpdateMatchScoreWrongDataTypesTest) {
-    EXPECT_CALL(*matchDelegateMock, UpdateMatchScore(::testing::_, ::testing::_, ::testing::_))
+    EXPECT_CALL(*matchDelegateMock, UpdateMatchScoreAsync(::testing::_, ::testing::_, ::testing::_))
         .Times(0);
 
     crow::request scoreRequest;
     scoreRequest.body = R"({"score": {"home": "six", "visitor": "seven"}})";
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id";
-    auto response = matchController->UpdateMatchScore(scoreRequest, tournamentId, matchId);
+    auto response = Dispatch(scoreRequest, [&](crow::response& r) { matchController->UpdateMatchScore(scoreRequest, r, tournamentId, matchId); });
 
     testing::Mock::VerifyAndClearExpectations(&matchDelegateMock);
     
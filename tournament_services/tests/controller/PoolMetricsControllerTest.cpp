@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <crow.h>
+#include <nlohmann/json.hpp>
+
+#include "controller/PoolMetricsController.hpp"
+
+class PoolStatsProviderMock : public IDbConnectionProvider {
+public:
+    MOCK_METHOD(PooledConnection, Connection, (), (override));
+    MOCK_METHOD(ConnectionPoolStats, PoolStats, (), (const, override));
+    MOCK_METHOD(std::optional<ConnectionPoolStats>, ReadPoolStats, (), (const, override));
+};
+
+class PoolMetricsControllerTest : public ::testing::Test {
+protected:
+    std::shared_ptr<PoolStatsProviderMock> providerMock;
+    std::shared_ptr<PoolMetricsController> controller;
+
+    void SetUp() override {
+        providerMock = std::make_shared<PoolStatsProviderMock>();
+        controller = std::make_shared<PoolMetricsController>(providerMock);
+    }
+
+    static ConnectionPoolStats Stats(size_t size, size_t inUse, uint64_t waits, std::chrono::microseconds totalWait) {
+        return {
+            .size = size,
+            .inUse = inUse,
+            .minSize = 2,
+            .maxSize = 8,
+            .acquisitions = 40,
+            .waits = waits,
+            .totalWait = totalWait,
+            .maxWait = std::chrono::microseconds(900),
+            .timeouts = 1,
+            .grown = 3,
+            .reaped = 1
+        };
+    }
+};
+
+TEST_F(PoolMetricsControllerTest, GetPoolMetricsTest) {
+    EXPECT_CALL(*providerMock, PoolStats())
+        .WillOnce(testing::Return(Stats(4, 3, 4, std::chrono::microseconds(2000))));
+    EXPECT_CALL(*providerMock, ReadPoolStats())
+        .WillOnce(testing::Return(Stats(2, 0, 0, std::chrono::microseconds(0))));
+
+    crow::response response = controller->GetPoolMetrics();
+    auto body = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_EQ(response.get_header_value("content-type"), "application/json");
+    EXPECT_EQ(body["primary"]["size"], 4);
+    EXPECT_EQ(body["primary"]["inUse"], 3);
+    EXPECT_EQ(body["primary"]["minSize"], 2);
+    EXPECT_EQ(body["primary"]["maxSize"], 8);
+    EXPECT_EQ(body["primary"]["acquisitions"], 40);
+    EXPECT_EQ(body["primary"]["waits"], 4);
+    EXPECT_EQ(body["primary"]["totalWaitUs"], 2000);
+    EXPECT_EQ(body["primary"]["meanWaitUs"], 500);
+    EXPECT_EQ(body["primary"]["maxWaitUs"], 900);
+    EXPECT_EQ(body["primary"]["timeouts"], 1);
+    EXPECT_EQ(body["primary"]["grown"], 3);
+    EXPECT_EQ(body["primary"]["reaped"], 1);
+    EXPECT_EQ(body["replica"]["size"], 2);
+    // Sin esperas el promedio es 0
+    EXPECT_EQ(body["replica"]["meanWaitUs"], 0);
+}
+
+TEST_F(PoolMetricsControllerTest, GetPoolMetricsWithoutReplicaTest) {
+    EXPECT_CALL(*providerMock, PoolStats())
+        .WillOnce(testing::Return(Stats(2, 1, 0, std::chrono::microseconds(0))));
+    EXPECT_CALL(*providerMock, ReadPoolStats())
+        .WillOnce(testing::Return(std::nullopt));
+
+    crow::response response = controller->GetPoolMetrics();
+    auto body = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_EQ(body["primary"]["inUse"], 1);
+    EXPECT_TRUE(body["replica"].is_null());
+}
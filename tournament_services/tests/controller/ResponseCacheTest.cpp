@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+#include "controller/ResponseCache.hpp"
+
+namespace {
+    std::string Gunzip(const std::string& compressed) {
+        z_stream stream{};
+        inflateInit2(&stream, 15 + 16);
+        std::string output(1 << 16, '\0');
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+        stream.avail_in = static_cast<uInt>(compressed.size());
+        stream.next_out = reinterpret_cast<Bytef*>(output.data());
+        stream.avail_out = static_cast<uInt>(output.size());
+        inflate(&stream, Z_FINISH);
+        output.resize(stream.total_out);
+        inflateEnd(&stream);
+        return output;
+    }
+}
+
+class ResponseCacheTest : public ::testing::Test {
+protected:
+    std::shared_ptr<CacheMetrics> metrics;
+
+    void SetUp() override {
+        metrics = std::make_shared<CacheMetrics>();
+    }
+
+    std::shared_ptr<ResponseCache> Cache(size_t capacity, long ttlMs) {
+        config::CacheConfiguration configuration;
+        configuration.capacity = capacity;
+        configuration.shards = 1;
+        configuration.ttlMs = ttlMs;
+        return std::make_shared<ResponseCache>(configuration, metrics);
+    }
+};
+
+TEST_F(ResponseCacheTest, FindSameVersionTest) {
+    auto cache = Cache(16, 60000);
+    cache->Store("tournament-id", "matches", 3, R"([{"id":"match-id"}])");
+
+    const auto found = cache->Find("tournament-id", "matches", 3);
+
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(found->json, R"([{"id":"match-id"}])");
+    EXPECT_EQ(Gunzip(found->gzip), found->json);
+    EXPECT_EQ(cache->Find("tournament-id", "matches-played", 3), nullptr);
+    EXPECT_EQ(cache->Find("other-id", "matches", 3), nullptr);
+}
+
+TEST_F(ResponseCacheTest, FindOtherVersionTest) {
+    auto cache = Cache(16, 60000);
+    cache->Store("tournament-id", "groups", 3, "[]");
+
+    EXPECT_EQ(cache->Find("tournament-id", "groups", 4), nullptr);
+    EXPECT_NE(cache->Find("tournament-id", "groups", 3), nullptr);
+}
+
+TEST_F(ResponseCacheTest, StoreKeepsNewerVersionTest) {
+    auto cache = Cache(16, 60000);
+    cache->Store("tournament-id", "groups", 5, "[1]");
+    // Una lectura lenta que empezó antes no pisa la versión más nueva
+    const auto stored = cache->Store("tournament-id", "groups", 4, "[0]");
+
+    EXPECT_EQ(stored->json, "[0]");
+    EXPECT_EQ(cache->Find("tournament-id", "groups", 4), nullptr);
+    ASSERT_NE(cache->Find("tournament-id", "groups", 5), nullptr);
+    EXPECT_EQ(cache->Find("tournament-id", "groups", 5)->json, "[1]");
+}
+
+TEST_F(ResponseCacheTest, EvictTournamentTest) {
+    auto cache = Cache(16, 60000);
+    cache->Store("tournament-id", "groups", 1, "[]");
+    cache->Store("tournament-id", "matches", 1, "[]");
+    cache->Store("other-id", "matches", 1, "[]");
+
+    cache->Evict("tournament-id");
+
+    EXPECT_EQ(cache->Find("tournament-id", "groups", 1), nullptr);
+    EXPECT_EQ(cache->Find("tournament-id", "matches", 1), nullptr);
+    EXPECT_NE(cache->Find("other-id", "matches", 1), nullptr);
+    EXPECT_EQ(metrics->For(ResponseCache::CACHE).invalidations.load(), 1);
+}
+
+TEST_F(ResponseCacheTest, CapacityEvictsLeastRecentTest) {
+    auto cache = Cache(2, 60000);
+    cache->Store("first-id", "matches", 1, "[]");
+    cache->Store("second-id", "matches", 1, "[]");
+    cache->Find("first-id", "matches", 1);
+    cache->Store("third-id", "matches", 1, "[]");
+
+    EXPECT_NE(cache->Find("first-id", "matches", 1), nullptr);
+    EXPECT_EQ(cache->Find("second-id", "matches", 1), nullptr);
+    EXPECT_NE(cache->Find("third-id", "matches", 1), nullptr);
+    EXPECT_EQ(metrics->For(ResponseCache::CACHE).evictions.load(), 1);
+}
+
+TEST_F(ResponseCacheTest, ExpiredEntryTest) {
+    auto cache = Cache(16, 0);
+    cache->Store("tournament-id", "matches", 1, "[]");
+
+    EXPECT_EQ(cache->Find("tournament-id", "matches", 1), nullptr);
+}
+
+TEST_F(ResponseCacheTest, AcceptsGzipTest) {
+    EXPECT_TRUE(AcceptsGzip("gzip"));
+    EXPECT_TRUE(AcceptsGzip("deflate, gzip;q=0.8, br"));
+    EXPECT_TRUE(AcceptsGzip("*"));
+    EXPECT_FALSE(AcceptsGzip(""));
+    EXPECT_FALSE(AcceptsGzip("deflate, br"));
+    EXPECT_FALSE(AcceptsGzip("gzip;q=0"));
+    EXPECT_FALSE(AcceptsGzip("gzip; q=0.0"));
+}
+
+TEST_F(ResponseCacheTest, CachedBodyResponseTest) {
+    auto cache = Cache(16, 60000);
+    const auto body = cache->Store("tournament-id", "matches", 1, "[]");
+
+    const auto plain = CachedBodyResponse(*body, false);
+    const auto compressed = CachedBodyResponse(*body, true);
+
+    EXPECT_EQ(plain.code, crow::OK);
+    EXPECT_EQ(plain.body, "[]");
+    EXPECT_EQ(plain.get_header_value("content-type"), "application/json");
+    EXPECT_TRUE(plain.get_header_value("content-encoding").empty());
+    EXPECT_EQ(compressed.get_header_value("content-encoding"), "gzip");
+    EXPECT_EQ(Gunzip(compressed.body), "[]");
+}
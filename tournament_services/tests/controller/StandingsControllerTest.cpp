@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <crow.h>
+#include <nlohmann/json.hpp>
+
+#include "delegate/IStandingsDelegate.hpp"
+#include "controller/StandingsController.hpp"
+
+class StandingsDelegateMock : public IStandingsDelegate {
+public:
+    MOCK_METHOD((std::expected<std::vector<domain::Standing>, std::string>), GetStandings, (const std::string_view& tournamentId), (override));
+};
+
+class StandingsControllerTest : public ::testing::Test{
+protected:
+    std::shared_ptr<StandingsDelegateMock> standingsDelegateMock;
+    std::shared_ptr<StandingsController> standingsController;
+
+    void SetUp() override {
+        standingsDelegateMock = std::make_shared<StandingsDelegateMock>();
+        standingsController = std::make_shared<StandingsController>(standingsDelegateMock);
+    }
+};
+
+TEST_F(StandingsControllerTest, GetStandingsTest) {
+    std::vector<domain::Standing> standings = {
+        {"team-1", "Team 1", "group-1", "North", "AFC", 2, 0, 0, 48, 20},
+        {"team-2", "Team 2", "group-1", "North", "AFC", 0, 2, 0, 20, 48}
+    };
+    std::string capturedTournamentId;
+    EXPECT_CALL(*standingsDelegateMock, GetStandings(::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<0>(&capturedTournamentId),
+            testing::Return(standings)
+        ));
+
+    crow::response response = standingsController->GetStandings("tournament-id");
+    auto body = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(capturedTournamentId, "tournament-id");
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_EQ(response.get_header_value("content-type"), "application/json");
+    ASSERT_EQ(body.size(), 2);
+    EXPECT_EQ(body[0]["teamId"], "team-1");
+    EXPECT_EQ(body[0]["teamName"], "Team 1");
+    EXPECT_EQ(body[0]["conference"], "AFC");
+    EXPECT_EQ(body[0]["wins"], 2);
+    EXPECT_EQ(body[0]["pointsFor"], 48);
+    EXPECT_EQ(body[1]["losses"], 2);
+    EXPECT_EQ(body[1]["pointsAgainst"], 48);
+}
+
+TEST_F(StandingsControllerTest, GetStandingsEmptyTest) {
+    EXPECT_CALL(*standingsDelegateMock, GetStandings(::testing::_))
+        .WillOnce(testing::Return(std::vector<domain::Standing>{}));
+
+    crow::response response = standingsController->GetStandings("tournament-id");
+
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_EQ(nlohmann::json::parse(response.body), nlohmann::json::array());
+}
+
+TEST_F(StandingsControllerTest, GetStandingsNotFoundTest) {
+    EXPECT_CALL(*standingsDelegateMock, GetStandings(::testing::_))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Tournament not found")));
+
+    crow::response response = standingsController->GetStandings("tournament-id");
+
+    EXPECT_EQ(response.code, crow::NOT_FOUND);
+}
+
+TEST_F(StandingsControllerTest, GetStandingsErrorTest) {
+    EXPECT_CALL(*standingsDelegateMock, GetStandings(::testing::_))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Database connection failed")));
+
+    crow::response response = standingsController->GetStandings("tournament-id");
+
+    EXPECT_EQ(response.code, crow::INTERNAL_SERVER_ERROR);
+}
+
+TEST_F(StandingsControllerTest, GetStandingsInvalidIdTest) {
+    EXPECT_CALL(*standingsDelegateMock, GetStandings(::testing::_))
+        .Times(0);
+
+    crow::response response = standingsController->GetStandings("tournament id'; --");
+
+    EXPECT_EQ(response.code, crow::BAD_REQUEST);
+    EXPECT_EQ(response.body, "Invalid tournament ID format");
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <crow.h>
+#include <nlohmann/json.hpp>
+
+#include "controller/StatementMetricsController.hpp"
+
+class StatementMetricsControllerTest : public ::testing::Test {
+protected:
+    std::shared_ptr<StatementMetrics> metrics;
+    std::shared_ptr<StatementMetricsController> controller;
+
+    void SetUp() override {
+        metrics = std::make_shared<StatementMetrics>();
+        controller = std::make_shared<StatementMetricsController>(metrics);
+    }
+};
+
+TEST_F(StatementMetricsControllerTest, GetStatementMetricsTest) {
+    using std::chrono::microseconds;
+    metrics->Record("select_match_by_id", microseconds(80), 1, false, microseconds(0));
+    metrics->Record("select_match_by_id", microseconds(3000), 1, false, microseconds(40));
+    metrics->Record("update_match_by_id", microseconds(20000), 0, true, microseconds(0));
+
+    crow::response response = controller->GetStatementMetrics();
+    auto body = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_EQ(response.get_header_value("content-type"), "application/json");
+    ASSERT_EQ(body.size(), 2);
+    // La de mayor latencia acumulada va primero
+    EXPECT_EQ(body[0]["statement"], "update_match_by_id");
+    EXPECT_EQ(body[0]["errors"], 1);
+    EXPECT_EQ(body[1]["statement"], "select_match_by_id");
+    EXPECT_EQ(body[1]["calls"], 2);
+    EXPECT_EQ(body[1]["rows"], 2);
+    EXPECT_EQ(body[1]["errors"], 0);
+    EXPECT_EQ(body[1]["totalLatencyUs"], 3080);
+    EXPECT_EQ(body[1]["meanLatencyUs"], 1540);
+    EXPECT_EQ(body[1]["maxLatencyUs"], 3000);
+    EXPECT_EQ(body[1]["poolWaitUs"], 40);
+    ASSERT_EQ(body[1]["latencyBuckets"].size(), StatementMetrics::BUCKET_COUNT);
+    EXPECT_EQ(body[1]["latencyBuckets"][0]["leUs"], 100);
+    EXPECT_EQ(body[1]["latencyBuckets"][0]["count"], 1);
+    EXPECT_EQ(body[1]["latencyBuckets"][5]["leUs"], 5000);
+    EXPECT_EQ(body[1]["latencyBuckets"][5]["count"], 1);
+    EXPECT_EQ(body[1]["latencyBuckets"][StatementMetrics::BUCKET_COUNT - 1]["leUs"], "inf");
+}
+
+TEST_F(StatementMetricsControllerTest, PoolWaitChargedToNextStatementTest) {
+    using std::chrono::microseconds;
+    StatementMetrics::NotePoolWait(microseconds(250));
+    metrics->Record("select_team_by_id", microseconds(10), 1, false);
+    metrics->Record("select_team_by_id", microseconds(10), 1, false);
+
+    auto body = nlohmann::json::parse(controller->GetStatementMetrics().body);
+
+    ASSERT_EQ(body.size(), 1);
+    EXPECT_EQ(body[0]["poolWaitUs"], 250);
+}
+
+TEST_F(StatementMetricsControllerTest, ResetStatementMetricsTest) {
+    metrics->Record("select_team_by_id", std::chrono::microseconds(10), 1, false, std::chrono::microseconds(0));
+
+    crow::response response = controller->ResetStatementMetrics();
+    auto body = nlohmann::json::parse(controller->GetStatementMetrics().body);
+
+    EXPECT_EQ(response.code, crow::NO_CONTENT);
+    ASSERT_EQ(body.size(), 1);
+    EXPECT_EQ(body[0]["calls"], 0);
+    EXPECT_EQ(body[0]["totalLatencyUs"], 0);
+}
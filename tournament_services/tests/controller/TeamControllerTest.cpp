@@ -5,12 +5,13 @@
 #include "domain/Team.hpp"
 #include "delegate/ITeamDelegate.hpp"
 #include "controller/TeamController.hpp"
+#include "controller/Pagination.hpp"
 
 class TeamDelegateMock : public ITeamDelegate {
     public:
     MOCK_METHOD((std::expected<std::string, std::string>), CreateTeam, (const std::shared_ptr<domain::Team> team), (override));
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Team>, std::string>), GetTeam, (const std::string_view id), (override));
-    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>), ReadAll, (), (override));
+    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>), ReadPage, (const std::optional<std::string>& after, size_t limit), (override));
     MOCK_METHOD((std::expected<std::string, std::string>), UpdateTeam, (const std::string_view id, const std::shared_ptr<domain::Team> team), (override));
     MOCK_METHOD((std::expected<void, std::string>), DeleteTeam, (const std::string_view id), (override));
 };
@@ -162,10 +163,10 @@ TEST_F(TeamControllerTest, GetAllTeamsTest) {
     mockTeamsList.push_back(std::make_shared<domain::Team>(domain::Team{"15-00", "Tales"}));
     mockTeamsList.push_back(std::make_shared<domain::Team>(domain::Team{"2-3-4-5-6", "Zona Minecraft"}));
 
-    EXPECT_CALL(*teamDelegateMock, ReadAll())
+    EXPECT_CALL(*teamDelegateMock, ReadPage(std::optional<std::string>{}, DEFAULT_PAGE_SIZE))
         .WillOnce(testing::Return(mockTeamsList));
 
-    crow::response response = teamController->getAllTeams();
+    crow::response response = teamController->getAllTeams(crow::request{});
 
     auto jsonResponse = crow::json::load(response.body);
 
@@ -185,10 +186,10 @@ TEST_F(TeamControllerTest, GetAllTeamsTest) {
 TEST_F(TeamControllerTest, GetAllTeams_EmptyTest) {
     std::vector<std::shared_ptr<domain::Team>> emptyTeamsList;
 
-    EXPECT_CALL(*teamDelegateMock, ReadAll())
+    EXPECT_CALL(*teamDelegateMock, ReadPage(std::optional<std::string>{}, DEFAULT_PAGE_SIZE))
         .WillOnce(testing::Return(emptyTeamsList));
 
-    crow::response response = teamController->getAllTeams();
+    crow::response response = teamController->getAllTeams(crow::request{});
 
     auto jsonResponse = crow::json::load(response.body);
 
@@ -199,10 +200,10 @@ TEST_F(TeamControllerTest, GetAllTeams_EmptyTest) {
 
 // Prueba 10: Obtener todos los equipos cuando hay error en la base de datos
 TEST_F(TeamControllerTest, GetAllTeams_DBErrorTest) {
-    EXPECT_CALL(*teamDelegateMock, ReadAll())
+    EXPECT_CALL(*teamDelegateMock, ReadPage(std::optional<std::string>{}, DEFAULT_PAGE_SIZE))
         .WillOnce(testing::Return(std::unexpected<std::string>("Database connection failed")));
 
-    crow::response response = teamController->getAllTeams();
+    crow::response response = teamController->getAllTeams(crow::request{});
 
     EXPECT_EQ(crow::INTERNAL_SERVER_ERROR, response.code);
     EXPECT_EQ("Database connection failed", response.body);
@@ -214,10 +215,10 @@ TEST_F(TeamControllerTest, GetAllTeams_ValidWithHeaderTest) {
     mockTeamsList.push_back(std::make_shared<domain::Team>(domain::Team{"id1", "Team1"}));
     mockTeamsList.push_back(std::make_shared<domain::Team>(domain::Team{"id2", "Team2"}));
 
-    EXPECT_CALL(*teamDelegateMock, ReadAll())
+    EXPECT_CALL(*teamDelegateMock, ReadPage(std::optional<std::string>{}, DEFAULT_PAGE_SIZE))
         .WillOnce(testing::Return(mockTeamsList));
 
-    crow::response response = teamController->getAllTeams();
+    crow::response response = teamController->getAllTeams(crow::request{});
 
     EXPECT_EQ(crow::OK, response.code);
     EXPECT_EQ("application/json", response.get_header_value("content-type"));
@@ -383,3 +384,54 @@ TEST_F(TeamControllerTest, DeleteTeam_DBErrorTest) {
     EXPECT_EQ(crow::INTERNAL_SERVER_ERROR, response.code);
     EXPECT_EQ("Database connection failed", response.body);
 }
+
+// Prueba 21: Página con limit y after; una página llena trae el enlace a la siguiente
+TEST_F(TeamControllerTest, GetAllTeams_PageWithCursorTest) {
+    std::vector<std::shared_ptr<domain::Team>> page;
+    page.push_back(std::make_shared<domain::Team>(domain::Team{"2b6f0cc9-4b8c-4f1e-9a57-0c4d3f1e2a01", "Team1"}));
+    page.push_back(std::make_shared<domain::Team>(domain::Team{"2b6f0cc9-4b8c-4f1e-9a57-0c4d3f1e2a02", "Team2"}));
+
+    EXPECT_CALL(*teamDelegateMock, ReadPage(std::optional<std::string>("2b6f0cc9-4b8c-4f1e-9a57-0c4d3f1e2a00"), 2))
+        .WillOnce(testing::Return(page));
+
+    crow::request request;
+    request.url = "/teams?limit=2&after=2b6f0cc9-4b8c-4f1e-9a57-0c4d3f1e2a00";
+    request.url_params = crow::query_string(request.url);
+    crow::response response = teamController->getAllTeams(request);
+
+    EXPECT_EQ(crow::OK, response.code);
+    EXPECT_EQ(2, nlohmann::json::parse(response.body).size());
+    EXPECT_EQ("</teams?limit=2&after=2b6f0cc9-4b8c-4f1e-9a57-0c4d3f1e2a02>; rel=\"next\"", response.get_header_value("link"));
+}
+
+// Prueba 22: Una página incompleta es la última y no trae enlace
+TEST_F(TeamControllerTest, GetAllTeams_LastPageTest) {
+    std::vector<std::shared_ptr<domain::Team>> page;
+    page.push_back(std::make_shared<domain::Team>(domain::Team{"2b6f0cc9-4b8c-4f1e-9a57-0c4d3f1e2a01", "Team1"}));
+
+    EXPECT_CALL(*teamDelegateMock, ReadPage(std::optional<std::string>{}, 5))
+        .WillOnce(testing::Return(page));
+
+    crow::request request;
+    request.url = "/teams?limit=5";
+    request.url_params = crow::query_string(request.url);
+    crow::response response = teamController->getAllTeams(request);
+
+    EXPECT_EQ(crow::OK, response.code);
+    EXPECT_EQ("", response.get_header_value("link"));
+}
+
+// Prueba 23: limit fuera de rango o cursor inválido
+TEST_F(TeamControllerTest, GetAllTeams_InvalidPageTest) {
+    EXPECT_CALL(*teamDelegateMock, ReadPage(::testing::_, ::testing::_))
+        .Times(0);
+
+    for (const std::string url : {"/teams?limit=0", "/teams?limit=5000", "/teams?limit=abc", "/teams?after=not-an-id"}) {
+        crow::request request;
+        request.url = url;
+        request.url_params = crow::query_string(request.url);
+        crow::response response = teamController->getAllTeams(request);
+
+        EXPECT_EQ(crow::BAD_REQUEST, response.code) << url;
+    }
+}
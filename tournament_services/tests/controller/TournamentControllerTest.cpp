@@ -8,13 +8,14 @@
 #include "domain/Tournament.hpp"
 #include "delegate/ITournamentDelegate.hpp"
 #include "controller/TournamentController.hpp"
+#include "controller/Pagination.hpp"
 #include "domain/Utilities.hpp"
 
 class TournamentDelegateMock : public ITournamentDelegate {
 public:
     MOCK_METHOD((std::expected<std::string, std::string>), CreateTournament, (const std::shared_ptr<domain::Tournament> tournament), (override));
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Tournament>, std::string>), GetTournament, (const std::string_view id), (override));
-    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>), ReadAll, (), (override));
+    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>), ReadPage, (const std::optional<std::string>& after, size_t limit), (override));
     MOCK_METHOD((std::expected<std::string, std::string>), UpdateTournament, (const std::string_view id, const std::shared_ptr<domain::Tournament> tournament), (override));
     MOCK_METHOD((std::expected<void, std::string>), DeleteTournament, (const std::string_view id), (override));
 };
@@ -184,10 +185,10 @@ TEST_F(TournamentControllerTest, ReadAllTournamentsSuccessTest) {
     nlohmann::json body2 = {{"id", "second-id"}, {"name", "second tournament"}, {"year", 2026}, {"finished", "no"}};
     tournaments.push_back(std::make_shared<domain::Tournament>(body2));
 
-    EXPECT_CALL(*tournamentDelegateMock, ReadAll())
+    EXPECT_CALL(*tournamentDelegateMock, ReadPage(std::optional<std::string>{}, DEFAULT_PAGE_SIZE))
         .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>(tournaments)));
 
-    auto response = tournamentController->ReadAll();
+    auto response = tournamentController->ReadAll(crow::request{});
     auto bodyJson = nlohmann::json::parse(response.body);
 
     testing::Mock::VerifyAndClearExpectations(&tournamentDelegateMock);
@@ -208,10 +209,10 @@ TEST_F(TournamentControllerTest, ReadAllTournamentsSuccessTest) {
 TEST_F(TournamentControllerTest, ReadAllTournamentsEmptyTest) {
     std::vector<std::shared_ptr<domain::Tournament>> tournaments;
 
-    EXPECT_CALL(*tournamentDelegateMock, ReadAll())
+    EXPECT_CALL(*tournamentDelegateMock, ReadPage(std::optional<std::string>{}, DEFAULT_PAGE_SIZE))
         .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>(tournaments)));
 
-    auto response = tournamentController->ReadAll();
+    auto response = tournamentController->ReadAll(crow::request{});
     auto bodyJson = nlohmann::json::parse(response.body);
 
     testing::Mock::VerifyAndClearExpectations(&tournamentDelegateMock);
@@ -223,10 +224,10 @@ TEST_F(TournamentControllerTest, ReadAllTournamentsEmptyTest) {
 }
 
 TEST_F(TournamentControllerTest, ReadAllTournamentsDBFailTest) {
-    EXPECT_CALL(*tournamentDelegateMock, ReadAll())
+    EXPECT_CALL(*tournamentDelegateMock, ReadPage(std::optional<std::string>{}, DEFAULT_PAGE_SIZE))
         .WillOnce(testing::Return(std::unexpected<std::string>("Database connection failed")));
 
-    auto response = tournamentController->ReadAll();
+    auto response = tournamentController->ReadAll(crow::request{});
 
     testing::Mock::VerifyAndClearExpectations(&tournamentDelegateMock);
     
@@ -234,6 +235,38 @@ TEST_F(TournamentControllerTest, ReadAllTournamentsDBFailTest) {
     EXPECT_EQ(response.body, "Database connection failed");
 }
 
+TEST_F(TournamentControllerTest, ReadAllTournamentsPageTest) {
+    std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+    nlohmann::json body = {{"id", "9f1c2d3e-0000-4000-8000-000000000002"}, {"name", "paged tournament"}, {"year", 2026}, {"finished", "no"}};
+    tournaments.push_back(std::make_shared<domain::Tournament>(body));
+
+    EXPECT_CALL(*tournamentDelegateMock, ReadPage(std::optional<std::string>("9f1c2d3e-0000-4000-8000-000000000001"), 1))
+        .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>(tournaments)));
+
+    crow::request request;
+    request.url = "/tournaments?limit=1&after=9f1c2d3e-0000-4000-8000-000000000001";
+    request.url_params = crow::query_string(request.url);
+    auto response = tournamentController->ReadAll(request);
+
+    testing::Mock::VerifyAndClearExpectations(&tournamentDelegateMock);
+
+    EXPECT_EQ(response.code, crow::OK);
+    EXPECT_EQ(nlohmann::json::parse(response.body).size(), 1);
+    EXPECT_EQ(response.get_header_value("link"), "</tournaments?limit=1&after=9f1c2d3e-0000-4000-8000-000000000002>; rel=\"next\"");
+}
+
+TEST_F(TournamentControllerTest, ReadAllTournamentsInvalidLimitTest) {
+    EXPECT_CALL(*tournamentDelegateMock, ReadPage(testing::_, testing::_))
+        .Times(0);
+
+    crow::request request;
+    request.url = "/tournaments?limit=-1";
+    request.url_params = crow::query_string(request.url);
+    auto response = tournamentController->ReadAll(request);
+
+    EXPECT_EQ(response.code, crow::BAD_REQUEST);
+}
+
 TEST_F(TournamentControllerTest, UpdateTournamentSuccessTest) {
     std::string id;
     std::shared_ptr<domain::Tournament> capturedTournament;
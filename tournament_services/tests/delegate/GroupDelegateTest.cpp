@@ -22,8 +22,10 @@ public:
     MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>), FindByTournamentId, (const std::string_view& tournamentId), (override));
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Group>, std::string>), FindByTournamentIdAndGroupId, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Group>, std::string>), FindByTournamentIdAndTeamId, (const std::string_view& tournamentId, const std::string_view& teamId), (override));
+    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>), FindGroupsContainingAnyTeam, (const std::string_view& tournamentId, std::span<const std::string> teamIds), (override));
     MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>), FindByTournamentIdAndConference, (const std::string_view& tournamentId, const std::string_view& conference), (override));
     MOCK_METHOD((std::expected<void, std::string>), UpdateGroupAddTeam, (const std::string_view& groupId, const std::shared_ptr<domain::Team>& team), (override));
+    MOCK_METHOD((std::expected<int64_t, std::string>), ReadChangeVersion, (const std::string_view& tournamentId), (override));
 };
 
 class TournamentRepositoryMock2 : public TournamentRepository {
@@ -38,6 +40,7 @@ public:
     TeamRepositoryMock2() : TeamRepository(nullptr) {}
 
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Team>, std::string>), ReadById, (std::string id), (override));
+    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>), ReadByIds, (std::span<const std::string> ids), (override));
 };
 
 class QueueMessageProducerMock : public QueueMessageProducer {
@@ -45,6 +48,7 @@ public:
     QueueMessageProducerMock(): QueueMessageProducer(nullptr) {}
 
     MOCK_METHOD(void, SendMessage, (const std::string_view& message, const std::string_view& queue), (override));
+    MOCK_METHOD(void, Publish, (const std::string_view& message, const std::string_view& topic), (override));
 };
 
 class GroupDelegateTest : public ::testing::Test{
@@ -90,10 +94,10 @@ TEST_F(GroupDelegateTest, CreateGroupSucessTest) {
             )
         );
 
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .Times(0);
 
     EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndConference(::testing::_, ::testing::_))
@@ -148,10 +152,10 @@ TEST_F(GroupDelegateTest, CreateGroupDBInsertionFailTest) {
             )
         );
 
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .Times(0);
 
     EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndConference(::testing::_, ::testing::_))
@@ -218,10 +222,10 @@ TEST_F(GroupDelegateTest, CreateGroupOverflowingTournamentTest) {
             )
         );
 
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .Times(0);
     
     EXPECT_CALL(*groupRepositoryMock, Create(::testing::_))
@@ -257,10 +261,10 @@ TEST_F(GroupDelegateTest, CreateGroupTournamentFailTest) {
     EXPECT_CALL(*groupRepositoryMock, FindByTournamentId(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .Times(0);
     
     EXPECT_CALL(*groupRepositoryMock, Create(::testing::_))
@@ -302,10 +306,10 @@ TEST_F(GroupDelegateTest, CreateGroupExistingGroupsFailTest) {
             )
         );
 
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .Times(0);
     
     EXPECT_CALL(*groupRepositoryMock, Create(::testing::_))
@@ -349,10 +353,10 @@ TEST_F(GroupDelegateTest, CreateGroupOverflowingGroupTest) {
             )
         );
 
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .Times(0);
     
     EXPECT_CALL(*groupRepositoryMock, Create(::testing::_))
@@ -411,32 +415,17 @@ TEST_F(GroupDelegateTest, CreateGroupInvalidTeamTest) {
         {"name", "Team 0"}
     };
     auto team1 = std::make_shared<domain::Team>(team1Data);
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
-        .Times(2)
-        .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTeamIds](const std::string& id) {
-                    capturedTeamIds.push_back(id);
-                }),
-                testing::Return(std::expected<std::shared_ptr<domain::Team>, std::string>(team1))
-            )
-        )
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTeamIds](const std::string& id) {
-                    capturedTeamIds.push_back(id);
+                testing::Invoke([&capturedTeamIds](std::span<const std::string> ids) {
+                    capturedTeamIds.assign(ids.begin(), ids.end());
                 }),
-                testing::Return(std::unexpected<std::string>("Team does not exist"))
+                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>(std::vector{team1}))
             )
         );
 
-    std::string_view capturedTournamentIdFindBy;
-    std::string_view capturedTeamIdFindBy;
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdFindBy),
-                testing::SaveArg<1>(&capturedTeamIdFindBy),
-                testing::Return(std::unexpected<std::string>("Group not found"))
-            )
-        );
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
+        .Times(0);
     
     EXPECT_CALL(*groupRepositoryMock, Create(::testing::_))
         .Times(0);
@@ -461,10 +450,8 @@ TEST_F(GroupDelegateTest, CreateGroupInvalidTeamTest) {
     EXPECT_EQ(capturedTeamIds.size(), 2);
     EXPECT_EQ(capturedTeamIds[0], groupRequestBody["teams"][0]["id"].get<std::string>());
     EXPECT_EQ(capturedTeamIds[1], groupRequestBody["teams"][1]["id"].get<std::string>());
-    EXPECT_EQ(capturedTournamentIdFindBy, tournamentId);
-    EXPECT_EQ(capturedTeamIdFindBy, groupRequestBody["teams"][0]["id"].get<std::string>());
     EXPECT_FALSE(response.has_value());
-    EXPECT_EQ(response.error(), "Team does not exist");
+    EXPECT_EQ(response.error(), "Team not found");
 }
 
 TEST_F(GroupDelegateTest, CreateGroupExistingTeamFailTest) {
@@ -501,27 +488,17 @@ TEST_F(GroupDelegateTest, CreateGroupExistingTeamFailTest) {
         {"name", "Team 1"}
     };
     auto team2 = std::make_shared<domain::Team>(team2Data);
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
-        .Times(2)
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTeamIds](const std::string& id) {
-                    capturedTeamIds.push_back(id);
+                testing::Invoke([&capturedTeamIds](std::span<const std::string> ids) {
+                    capturedTeamIds.assign(ids.begin(), ids.end());
                 }),
-                testing::Return(std::expected<std::shared_ptr<domain::Team>, std::string>(team1))
-            )
-        )
-        .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTeamIds](const std::string& id) {
-                    capturedTeamIds.push_back(id);
-                }),
-                testing::Return(std::expected<std::shared_ptr<domain::Team>, std::string>(team2))
+                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>(std::vector{team1, team2}))
             )
         );
 
-    std::string_view capturedTournamentIdFindBy1;
-    std::string_view capturedTeamIdFindBy1;
-    std::string_view capturedTournamentIdFindBy2;
-    std::string_view capturedTeamIdFindBy2;
+    std::string_view capturedTournamentIdFindBy;
+    std::vector<std::string> capturedTeamIdsFindBy;
     nlohmann::json foundGroupData = {
         {"id", "existing-group-id"},
         {"name", "Existing Group"},
@@ -535,18 +512,13 @@ TEST_F(GroupDelegateTest, CreateGroupExistingTeamFailTest) {
         })}
     };
     auto foundGroup = std::make_shared<domain::Group>(foundGroupData);
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
-        .Times(2)
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdFindBy1),
-                testing::SaveArg<1>(&capturedTeamIdFindBy1),
-                testing::Return(std::unexpected<std::string>("Group not found"))
-            )
-        )
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdFindBy2),
-                testing::SaveArg<1>(&capturedTeamIdFindBy2),
-                testing::Return(std::expected<std::shared_ptr<domain::Group>, std::string>(foundGroup))
+                testing::Invoke([&](const std::string_view& tournamentId, std::span<const std::string> teamIds) {
+                    capturedTournamentIdFindBy = tournamentId;
+                    capturedTeamIdsFindBy.assign(teamIds.begin(), teamIds.end());
+                }),
+                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>(std::vector{foundGroup}))
             )
         );
     
@@ -573,14 +545,92 @@ TEST_F(GroupDelegateTest, CreateGroupExistingTeamFailTest) {
     EXPECT_EQ(capturedTeamIds.size(), 2);
     EXPECT_EQ(capturedTeamIds[0], groupRequestBody["teams"][0]["id"].get<std::string>());
     EXPECT_EQ(capturedTeamIds[1], groupRequestBody["teams"][1]["id"].get<std::string>());
-    EXPECT_EQ(capturedTournamentIdFindBy1, tournamentId);
-    EXPECT_EQ(capturedTeamIdFindBy1, groupRequestBody["teams"][0]["id"].get<std::string>());
-    EXPECT_EQ(capturedTournamentIdFindBy2, tournamentId);
-    EXPECT_EQ(capturedTeamIdFindBy2, groupRequestBody["teams"][1]["id"].get<std::string>());
+    EXPECT_EQ(capturedTournamentIdFindBy, tournamentId);
+    EXPECT_EQ(capturedTeamIdsFindBy, capturedTeamIds);
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Team team-id-1 already exists in another group");
 }
 
+// Postgres devuelve los ids en minúsculas; un id con mayúsculas en la petición es el mismo equipo
+TEST_F(GroupDelegateTest, CreateGroupMixedCaseTeamIdTest) {
+    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
+    tournament->Id() = "tournament-id";
+    EXPECT_CALL(*tournamentRepositoryMock2, ReadById(::testing::_))
+        .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament)));
+    EXPECT_CALL(*groupRepositoryMock, FindByTournamentId(::testing::_))
+        .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>(std::vector<std::shared_ptr<domain::Group>>{})));
+    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndConference(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(std::vector<std::shared_ptr<domain::Group>>()));
+
+    std::vector<std::string> capturedTeamIds;
+    auto team = std::make_shared<domain::Team>(domain::Team{"5a1b2c3d-0000-4000-8000-00000000abcd", "Team 0"});
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
+        .WillOnce(testing::DoAll(
+                testing::Invoke([&capturedTeamIds](std::span<const std::string> ids) {
+                    capturedTeamIds.assign(ids.begin(), ids.end());
+                }),
+                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>(std::vector{team}))
+            )
+        );
+    std::vector<std::string> capturedTeamIdsFindBy;
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
+        .WillOnce(testing::DoAll(
+                testing::Invoke([&capturedTeamIdsFindBy](const std::string_view&, std::span<const std::string> teamIds) {
+                    capturedTeamIdsFindBy.assign(teamIds.begin(), teamIds.end());
+                }),
+                testing::Return(std::vector<std::shared_ptr<domain::Group>>())
+            )
+        );
+    EXPECT_CALL(*groupRepositoryMock, Create(::testing::_))
+        .WillOnce(testing::Return(std::expected<std::string, std::string>("new-id")));
+
+    nlohmann::json groupRequestBody = {{"name", "new name"}, {"region", "new region"}, {"conference", "AFC"},
+                                       {"teams", {{{"id", "5A1B2C3D-0000-4000-8000-00000000ABCD"}, {"name", "Team 0"}}}}};
+    const domain::Group group = groupRequestBody;
+    auto response = groupDelegate->CreateGroup("tournament-id", group);
+
+    testing::Mock::VerifyAndClearExpectations(&groupRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&teamRepositoryMock2);
+
+    ASSERT_TRUE(response.has_value());
+    EXPECT_EQ(*response, "new-id");
+    EXPECT_EQ(capturedTeamIds, std::vector<std::string>{"5a1b2c3d-0000-4000-8000-00000000abcd"});
+    EXPECT_EQ(capturedTeamIdsFindBy, capturedTeamIds);
+}
+
+TEST_F(GroupDelegateTest, CreateGroupMixedCaseExistingTeamFailTest) {
+    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
+    tournament->Id() = "tournament-id";
+    EXPECT_CALL(*tournamentRepositoryMock2, ReadById(::testing::_))
+        .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament)));
+    EXPECT_CALL(*groupRepositoryMock, FindByTournamentId(::testing::_))
+        .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>(std::vector<std::shared_ptr<domain::Group>>{})));
+    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndConference(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(std::vector<std::shared_ptr<domain::Group>>()));
+
+    auto team = std::make_shared<domain::Team>(domain::Team{"5a1b2c3d-0000-4000-8000-00000000abcd", "Team 0"});
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
+        .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>(std::vector{team})));
+    // El otro grupo guardó el id con otro caso
+    auto foundGroup = std::make_shared<domain::Group>("Existing Group", "Existing Region", "existing-group-id");
+    foundGroup->Teams().push_back(domain::Team{"5A1B2C3D-0000-4000-8000-00000000abcd", "Team 0"});
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
+        .WillOnce(testing::Return(std::vector{foundGroup}));
+    EXPECT_CALL(*groupRepositoryMock, Create(::testing::_))
+        .Times(0);
+
+    nlohmann::json groupRequestBody = {{"name", "new name"}, {"region", "new region"}, {"conference", "AFC"},
+                                       {"teams", {{{"id", "5a1b2c3d-0000-4000-8000-00000000ABCD"}, {"name", "Team 0"}}}}};
+    const domain::Group group = groupRequestBody;
+    auto response = groupDelegate->CreateGroup("tournament-id", group);
+
+    testing::Mock::VerifyAndClearExpectations(&groupRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&teamRepositoryMock2);
+
+    EXPECT_FALSE(response.has_value());
+    EXPECT_EQ(response.error(), "Team 5a1b2c3d-0000-4000-8000-00000000ABCD already exists in another group");
+}
+
 TEST_F(GroupDelegateTest, GetGroupsSuccessTest) {
     std::string_view capturedTournamentId;
     std::vector<std::shared_ptr<domain::Group>> existingGroups;
@@ -642,6 +692,21 @@ TEST_F(GroupDelegateTest, GetGroupsEmptyTest) {
     EXPECT_TRUE(response.value().empty());
 }
 
+TEST_F(GroupDelegateTest, GetGroupsVersionTest) {
+    EXPECT_CALL(*groupRepositoryMock, ReadChangeVersion(std::string_view("tournament-id")))
+        .WillOnce(testing::Return(std::expected<int64_t, std::string>(7)));
+    EXPECT_CALL(*groupRepositoryMock, ReadChangeVersion(std::string_view("missing-id")))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Tournament not found")));
+
+    auto version = groupDelegate->GetGroupsVersion("tournament-id");
+    auto missing = groupDelegate->GetGroupsVersion("missing-id");
+
+    ASSERT_TRUE(version.has_value());
+    EXPECT_EQ(*version, 7);
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error(), "Tournament not found");
+}
+
 TEST_F(GroupDelegateTest, GetGroupsFailTest) {
     std::string_view capturedTournamentId;
     EXPECT_CALL(*groupRepositoryMock, FindByTournamentId(::testing::_))
@@ -747,10 +812,10 @@ TEST_F(GroupDelegateTest, UpdateGroupSuccessTest) {
     EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndConference(::testing::_, ::testing::_))
         .WillOnce(::testing::Return(std::vector<std::shared_ptr<domain::Group>>()));
     
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .Times(0);
 
     std::string capturedGroupIdGroupUpdate;
@@ -786,6 +851,57 @@ TEST_F(GroupDelegateTest, UpdateGroupSuccessTest) {
     EXPECT_TRUE(response.has_value());
 }
 
+TEST_F(GroupDelegateTest, UpdateGroupKeepsOwnTeamsTest) {
+    nlohmann::json groupData = {
+        {"id", "update-id"},
+        {"name", "Test Group"},
+        {"region", "Test Region"},
+        {"conference", "AFC"},
+        {"teams", nlohmann::json::array({{{"id", "team-id-0"}, {"name", "Team 0"}}})}
+    };
+    auto returnGroup = std::make_shared<domain::Group>(groupData);
+    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndGroupId(::testing::_, ::testing::_))
+        .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Group>, std::string>(returnGroup)));
+
+    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
+    tournament->Id() = "tournament-id";
+    EXPECT_CALL(*tournamentRepositoryMock2, ReadById(::testing::_))
+        .WillRepeatedly(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament)));
+
+    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndConference(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(std::vector<std::shared_ptr<domain::Group>>()));
+
+    auto team0 = std::make_shared<domain::Team>(domain::Team{"team-id-0", "Team 0"});
+    auto team1 = std::make_shared<domain::Team>(domain::Team{"team-id-1", "Team 1"});
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
+        .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>(std::vector{team0, team1})));
+
+    // El único grupo que ya tiene a team-id-0 es el que se está actualizando
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
+        .WillOnce(testing::Return(std::vector{returnGroup}));
+
+    domain::Group capturedGroupGroupUpdate;
+    EXPECT_CALL(*groupRepositoryMock, Update(::testing::_, ::testing::_))
+        .WillOnce(testing::DoAll(
+                testing::SaveArg<1>(&capturedGroupGroupUpdate),
+                testing::Return(std::expected<std::string, std::string>("update-id"))
+            )
+        );
+
+    std::string_view tournamentId = "tournament-id";
+    nlohmann::json groupRequestBody = {{"id", "update-id"}, {"name", "update name"}, {"region", "update region"}, {"conference", "AFC"},
+        {"teams", nlohmann::json::array({{{"id", "team-id-0"}, {"name", "Team 0"}}, {{"id", "team-id-1"}, {"name", "Team 1"}}})}};
+    domain::Group group = groupRequestBody;
+    group.Id() = "update-id";
+    auto response = groupDelegate->UpdateGroup(tournamentId, group, true);
+
+    testing::Mock::VerifyAndClearExpectations(&groupRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&teamRepositoryMock2);
+
+    EXPECT_TRUE(response.has_value());
+    EXPECT_EQ(capturedGroupGroupUpdate.Teams().size(), 2);
+}
+
 TEST_F(GroupDelegateTest, UpdateGroupFailTest) {
     std::string capturedTournamentIdGroupFindBy;
     std::string capturedGroupIdGroupFindBy;
@@ -803,10 +919,10 @@ TEST_F(GroupDelegateTest, UpdateGroupFailTest) {
     EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndConference(::testing::_, ::testing::_))
         .Times(0);
     
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .Times(0);
 
     EXPECT_CALL(*groupRepositoryMock, Update(::testing::_, ::testing::_))
@@ -974,55 +1090,25 @@ TEST_F(GroupDelegateTest, UpdateTeamsSuccessTest) {
         {"name", "Team 1"}
     };
     auto team2 = std::make_shared<domain::Team>(team2Data);
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
-        .Times(4)
-        .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTeamIds](const std::string& id) {
-                    capturedTeamIds.push_back(id);
-                }),
-                testing::Return(std::expected<std::shared_ptr<domain::Team>, std::string>(team1))
-            )
-        )
-        .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTeamIds](const std::string& id) {
-                    capturedTeamIds.push_back(id);
-                }),
-                testing::Return(std::expected<std::shared_ptr<domain::Team>, std::string>(team2))
-            )
-        )
+    // El repositorio no garantiza orden; los equipos se agregan en el orden de la petición
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTeamIds](const std::string& id) {
-                    capturedTeamIds.push_back(id);
+                testing::Invoke([&capturedTeamIds](std::span<const std::string> ids) {
+                    capturedTeamIds.assign(ids.begin(), ids.end());
                 }),
-                testing::Return(std::expected<std::shared_ptr<domain::Team>, std::string>(team1))
-            )
-        )
-        .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTeamIds](const std::string& id) {
-                    capturedTeamIds.push_back(id);
-                }),
-                testing::Return(std::expected<std::shared_ptr<domain::Team>, std::string>(team2))
+                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>(std::vector{team2, team1}))
             )
         );
 
-    std::vector<std::string> capturedTournamentIdsFindBy;
+    std::string capturedTournamentIdFindBy;
     std::vector<std::string> capturedTeamIdsFindBy;
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
-        .Times(2)
-        .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTournamentIdsFindBy, &capturedTeamIdsFindBy](const std::string_view& tournId, const std::string_view& teamId) {
-                    capturedTournamentIdsFindBy.push_back(std::string(tournId));
-                    capturedTeamIdsFindBy.push_back(std::string(teamId));
-                }),
-                testing::Return(std::unexpected<std::string>("Group not found"))
-            )
-        )
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTournamentIdsFindBy, &capturedTeamIdsFindBy](const std::string_view& tournId, const std::string_view& teamId) {
-                    capturedTournamentIdsFindBy.push_back(std::string(tournId));
-                    capturedTeamIdsFindBy.push_back(std::string(teamId));
+                testing::Invoke([&capturedTournamentIdFindBy, &capturedTeamIdsFindBy](const std::string_view& tournId, std::span<const std::string> teamIds) {
+                    capturedTournamentIdFindBy = tournId;
+                    capturedTeamIdsFindBy.assign(teamIds.begin(), teamIds.end());
                 }),
-                testing::Return(std::unexpected<std::string>("Group not found"))
+                testing::Return(std::vector<std::shared_ptr<domain::Group>>())
             )
         );
 
@@ -1084,17 +1170,11 @@ TEST_F(GroupDelegateTest, UpdateTeamsSuccessTest) {
     EXPECT_EQ(capturedTournamentIdGroupFindBy, tournamentId.data());
     EXPECT_EQ(capturedGroupIdGroupFindBy, groupId.data());
     EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId.data());
-    EXPECT_EQ(capturedTeamIds.size(), 4);
+    EXPECT_EQ(capturedTeamIds.size(), 2);
     EXPECT_EQ(capturedTeamIds[0], team1DataExe["id"].get<std::string>());
     EXPECT_EQ(capturedTeamIds[1], team2DataExe["id"].get<std::string>());
-    EXPECT_EQ(capturedTeamIds[2], team1DataExe["id"].get<std::string>());
-    EXPECT_EQ(capturedTeamIds[3], team2DataExe["id"].get<std::string>());
-    EXPECT_EQ(capturedTournamentIdsFindBy.size(), 2);
-    EXPECT_EQ(capturedTournamentIdsFindBy[0], tournamentId);
-    EXPECT_EQ(capturedTournamentIdsFindBy[1], tournamentId);
-    EXPECT_EQ(capturedTeamIdsFindBy.size(), 2);
-    EXPECT_EQ(capturedTeamIdsFindBy[0], team1DataExe["id"].get<std::string>());
-    EXPECT_EQ(capturedTeamIdsFindBy[1], team2DataExe["id"].get<std::string>());
+    EXPECT_EQ(capturedTournamentIdFindBy, tournamentId);
+    EXPECT_EQ(capturedTeamIdsFindBy, capturedTeamIds);
     EXPECT_EQ(capturedGroupIds.size(), 2);
     EXPECT_EQ(capturedGroupIds[0], groupId);
     EXPECT_EQ(capturedGroupIds[1], groupId);
@@ -1139,35 +1219,17 @@ TEST_F(GroupDelegateTest, UpdateTeamsTeamFailTest) {
         {"name", "Team 0"}
     };
     auto team1 = std::make_shared<domain::Team>(team1Data);
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
-        .Times(2)
-        .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTeamIds](const std::string& id) {
-                    capturedTeamIds.push_back(id);
-                }),
-                testing::Return(std::expected<std::shared_ptr<domain::Team>, std::string>(team1))
-            )
-        )
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTeamIds](const std::string& id) {
-                    capturedTeamIds.push_back(id);
+                testing::Invoke([&capturedTeamIds](std::span<const std::string> ids) {
+                    capturedTeamIds.assign(ids.begin(), ids.end());
                 }),
-                testing::Return(std::unexpected<std::string>("Team not found"))
+                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>(std::vector{team1}))
             )
         );
 
-    std::vector<std::string> capturedTournamentIdsFindBy;
-    std::vector<std::string> capturedTeamIdsFindBy;
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
-        .Times(1)
-        .WillOnce(testing::DoAll(
-                testing::Invoke([&capturedTournamentIdsFindBy, &capturedTeamIdsFindBy](const std::string_view& tournId, const std::string_view& teamId) {
-                    capturedTournamentIdsFindBy.push_back(std::string(tournId));
-                    capturedTeamIdsFindBy.push_back(std::string(teamId));
-                }),
-                testing::Return(std::unexpected<std::string>("Group not found"))
-            )
-        );
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
+        .Times(0);
 
     EXPECT_CALL(*groupRepositoryMock, UpdateGroupAddTeam(::testing::_, ::testing::_))
         .Times(0);
@@ -1197,10 +1259,6 @@ TEST_F(GroupDelegateTest, UpdateTeamsTeamFailTest) {
     EXPECT_EQ(capturedTeamIds.size(), 2);
     EXPECT_EQ(capturedTeamIds[0], team1DataExe["id"].get<std::string>());
     EXPECT_EQ(capturedTeamIds[1], team2DataExe["id"].get<std::string>());
-    EXPECT_EQ(capturedTournamentIdsFindBy.size(), 1);
-    EXPECT_EQ(capturedTournamentIdsFindBy[0], tournamentId);
-    EXPECT_EQ(capturedTeamIdsFindBy.size(), 1);
-    EXPECT_EQ(capturedTeamIdsFindBy[0], team1DataExe["id"].get<std::string>());
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Team not found");
 }
@@ -1238,10 +1296,10 @@ TEST_F(GroupDelegateTest, UpdateTeamsOverflowingGroupTest) {
             )
         );
 
-    EXPECT_CALL(*teamRepositoryMock2, ReadById(::testing::_))
+    EXPECT_CALL(*teamRepositoryMock2, ReadByIds(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*groupRepositoryMock, FindByTournamentIdAndTeamId(::testing::_, ::testing::_))
+    EXPECT_CALL(*groupRepositoryMock, FindGroupsContainingAnyTeam(::testing::_, ::testing::_))
         .Times(0);
 
     EXPECT_CALL(*groupRepositoryMock, UpdateGroupAddTeam(::testing::_, ::testing::_))
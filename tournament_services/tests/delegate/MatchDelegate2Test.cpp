@@ -10,6 +10,7 @@
 #include "persistence/repository/MatchRepository.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
 #include "persistence/repository/GroupRepository.hpp"
+#include "persistence/repository/StandingsRepository.hpp"
 #include "delegate/MatchDelegate2.hpp"
 #include "domain/Utilities.hpp"
 
@@ -20,8 +21,10 @@ public:
     MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>), FindByTournamentId, (const std::string_view& tournamentId), (override));
     MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>), FindPendingMatchesByTournamentId, (const std::string_view& tournamentId), (override));
     MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>), FindByTournamentIdAndRound, (const std::string_view& tournamentId, domain::RoundType round), (override));
+    MOCK_METHOD((std::expected<size_t, std::string>), Count, (const MatchQuery& query), (override));
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Match>, std::string>), ReadById, (const std::string& id), (override));
     MOCK_METHOD((std::expected<std::string, std::string>), Create, (const domain::Match& match), (override));
+    MOCK_METHOD((std::expected<std::vector<std::string>, std::string>), CreateMany, (const std::vector<domain::Match>& matches), (override));
     MOCK_METHOD((std::expected<std::string, std::string>), Update, (const std::string& id, const domain::Match& match), (override));
 };
 
@@ -40,18 +43,29 @@ public:
     MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>), FindByTournamentId, (const std::string_view& tournamentId), (override));
 };
 
+class StandingsRepositoryMock2 : public StandingsRepository {
+public:
+    StandingsRepositoryMock2() : StandingsRepository(nullptr) {}
+
+    MOCK_METHOD((std::expected<std::optional<domain::MatchResult>, std::string>), LockAppliedResult, (const std::string_view& matchId), (override));
+    MOCK_METHOD((std::expected<std::optional<domain::MatchResult>, std::string>), ReadMatchResult, (const std::string_view& matchId), (override));
+    MOCK_METHOD((std::expected<void, std::string>), Apply, (const std::string_view& matchId, const std::string_view& tournamentId, const std::vector<domain::StandingChange>& changes, const std::optional<domain::MatchResult>& result), (override));
+};
+
 class MatchDelegate2Test : public ::testing::Test{
 protected:
     std::shared_ptr<MatchRepositoryMock2> matchRepositoryMock2;
     std::shared_ptr<GroupRepositoryMock3> groupRepositoryMock3;
     std::shared_ptr<TournamentRepositoryMock4> tournamentRepositoryMock4;
+    std::shared_ptr<StandingsRepositoryMock2> standingsRepositoryMock2;
     std::shared_ptr<MatchDelegate2> matchDelegate2;
 
     void SetUp() override {
         matchRepositoryMock2 = std::make_shared<MatchRepositoryMock2>();
         groupRepositoryMock3 = std::make_shared<GroupRepositoryMock3>();
         tournamentRepositoryMock4 = std::make_shared<TournamentRepositoryMock4>();
-        matchDelegate2 = std::make_shared<MatchDelegate2>(MatchDelegate2(matchRepositoryMock2, groupRepositoryMock3, tournamentRepositoryMock4));
+        standingsRepositoryMock2 = std::make_shared<StandingsRepositoryMock2>();
+        matchDelegate2 = std::make_shared<MatchDelegate2>(MatchDelegate2(matchRepositoryMock2, groupRepositoryMock3, tournamentRepositoryMock4, standingsRepositoryMock2));
     }
 
     // TearDown() function
@@ -196,14 +210,14 @@ TEST_F(MatchDelegate2Test, ProcessTeamAdditionSuccessTournamentCompleteTest) {
         );
 
     std::vector<domain::Match> capturedMatches;
-    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
-        .Times(272)
-        .WillRepeatedly(testing::DoAll(
-            testing::Invoke([&capturedMatches](const domain::Match& match) {
-                capturedMatches.push_back(match);
-            }),
-            testing::Return(std::expected<std::string, std::string>("generated-match-id"))
+    EXPECT_CALL(*matchRepositoryMock2, CreateMany(::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<0>(&capturedMatches),
+            testing::Return(std::expected<std::vector<std::string>, std::string>(
+                std::vector<std::string>(272, "generated-match-id")))
         ));
+    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
+        .Times(0);
     
     TeamAddEvent teamAddEvent{"tournament-id", "group-id", "team-id"};
     matchDelegate2->ProcessTeamAddition(teamAddEvent);
@@ -271,7 +285,7 @@ TEST_F(MatchDelegate2Test, ProcessTeamAdditionStrategyIncompleteGroupTest) {
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, CreateMany(::testing::_))
         .Times(0);
     
     TeamAddEvent teamAddEvent{"tournament-id", "group-id", "team-id"};
@@ -319,7 +333,7 @@ TEST_F(MatchDelegate2Test, ProcessTeamAdditionSecondGroupSelectionFailTest) {
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, CreateMany(::testing::_))
         .Times(0);
     
     TeamAddEvent teamAddEvent{"tournament-id", "group-id", "team-id"};
@@ -361,7 +375,7 @@ TEST_F(MatchDelegate2Test, ProcessTeamAdditionSecondTournamentSelectionFailTest)
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, CreateMany(::testing::_))
         .Times(0);
     
     TeamAddEvent teamAddEvent{"tournament-id", "group-id", "team-id"};
@@ -396,7 +410,7 @@ TEST_F(MatchDelegate2Test, ProcessTeamAdditionIncompleteTournamentTest) {
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, CreateMany(::testing::_))
         .Times(0);
     
     TeamAddEvent teamAddEvent{"tournament-id", "group-id", "team-id"};
@@ -428,7 +442,7 @@ TEST_F(MatchDelegate2Test, ProcessTeamAdditionTournamentSelectionFailTest) {
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, CreateMany(::testing::_))
         .Times(0);
     
     TeamAddEvent teamAddEvent{"tournament-id", "group-id", "team-id"};
@@ -455,7 +469,7 @@ TEST_F(MatchDelegate2Test, ProcessTeamAdditionGroupSelectionFailTest) {
     EXPECT_CALL(*tournamentRepositoryMock4, ReadById(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, CreateMany(::testing::_))
         .Times(0);
     
     TeamAddEvent teamAddEvent{"tournament-id", "group-id", "team-id"};
@@ -468,146 +482,38 @@ TEST_F(MatchDelegate2Test, ProcessTeamAdditionGroupSelectionFailTest) {
     EXPECT_EQ(capturedTournamentIdGroup, teamAddEvent.tournamentId);
 }
 
-TEST_F(MatchDelegate2Test, ProcessScoreUpdateSuccessTest) {
-    std::string capturedTournamentIdMatchPending;
-    std::vector<std::shared_ptr<domain::Match>> pendingMatches;
-    EXPECT_CALL(*matchRepositoryMock2, FindPendingMatchesByTournamentId(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchPending),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(pendingMatches))
-            )
-        );
+TEST_F(MatchDelegate2Test, ProcessTeamAdditionCreateManyFailTest) {   
+    auto groups = CreateCompleteGroups();
+    EXPECT_CALL(*groupRepositoryMock3, FindByTournamentId(::testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>(groups)));
 
-    std::string capturedTournamentIdTournament1;
-    std::string capturedTournamentIdTournament2;
     auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
     tournament->Id() = "tournament-id";
     EXPECT_CALL(*tournamentRepositoryMock4, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournament1),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        )
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournament2),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedTournamentIdMatchRound;
-    domain::RoundType capturedRoundType;
-    std::vector<std::shared_ptr<domain::Match>> regularMatches;
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(regularMatches))
-            )
-        );
-
-    std::string capturedTournamentIdGroup;
-    auto groups = CreateCompleteGroups();
-    EXPECT_CALL(*groupRepositoryMock3, FindByTournamentId(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdGroup),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>(groups))
-            )
-        );
-
-    std::string capturedTournamentIdMatch;
-    auto matches = CreateRegularSeasonMatches();
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentId(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatch),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(matches))
-            )
-        );
+        .Times(2)
+        .WillRepeatedly(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament)));
 
     std::vector<domain::Match> capturedMatches;
-    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
-        .Times(13)
-        .WillRepeatedly(testing::DoAll(
-            testing::Invoke([&capturedMatches](const domain::Match& match) {
-                capturedMatches.push_back(match);
-            }),
-            testing::Return(std::expected<std::string, std::string>("generated-match-id"))
+    EXPECT_CALL(*matchRepositoryMock2, CreateMany(::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<0>(&capturedMatches),
+            testing::Return(std::unexpected<std::string>("Database connection failed"))
         ));
-
-    std::vector<std::string> capturedMatchesIds;
-    std::vector<std::shared_ptr<domain::Match>> playoffMatches;
-
-    auto make = [&](const std::string& id, domain::RoundType round) {
-        domain::Home h{ id + "-home", "Home " + id };
-        domain::Visitor v{ id + "-visitor", "Visitor " + id };
-
-        auto m = std::make_shared<domain::Match>("tournament-id", h, v, round);
-        m->Id() = id;
-        return m;
-    };
-
-    playoffMatches.push_back(make("wildcard-1", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("wildcard-2", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("wildcard-3", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("wildcard-4", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("wildcard-5", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("wildcard-6", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("divisional-1", domain::RoundType::DIVISIONAL));
-    playoffMatches.push_back(make("divisional-2", domain::RoundType::DIVISIONAL));
-    playoffMatches.push_back(make("divisional-3", domain::RoundType::DIVISIONAL));
-    playoffMatches.push_back(make("divisional-4", domain::RoundType::DIVISIONAL));
-    playoffMatches.push_back(make("championship-1", domain::RoundType::CHAMPIONSHIP));
-    playoffMatches.push_back(make("championship-2", domain::RoundType::CHAMPIONSHIP));
-    playoffMatches.push_back(make("superbowl-1", domain::RoundType::SUPERBOWL));
+    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
+        .Times(0);
     
-    size_t readIndex = 0;
-    EXPECT_CALL(*matchRepositoryMock2, ReadById(::testing::_))
-        .Times(13)
-        .WillRepeatedly(testing::Invoke(
-            [&](const std::string& matchId)
-                -> std::expected<std::shared_ptr<domain::Match>, std::string>
-            {
-                capturedMatchesIds.push_back(matchId);
-
-                return playoffMatches[readIndex++];
-            }
-        ));
-
-    std::vector<std::string> capturedPlayoffMatchesIds;
-    std::vector<domain::Match> capturedPlayoffMatches;
-    EXPECT_CALL(*matchRepositoryMock2, Update(::testing::_, ::testing::_))
-        .Times(13)
-        .WillRepeatedly(testing::Invoke(
-            [&](const std::string& id, const domain::Match& match)
-                -> std::expected<std::string, std::string>
-            {
-                capturedPlayoffMatchesIds.push_back(id);
-                capturedPlayoffMatches.push_back(match);
-
-                return "generated-match-id";
-            }
-        ));
-
-    ScoreUpdateEvent scoreUpdateEvent{"tournament-id", "match-id"};
-    matchDelegate2->ProcessScoreUpdate(scoreUpdateEvent);
+    TeamAddEvent teamAddEvent{"tournament-id", "group-id", "team-id"};
+    matchDelegate2->ProcessTeamAddition(teamAddEvent);
     
     testing::Mock::VerifyAndClearExpectations(&groupRepositoryMock3);
     testing::Mock::VerifyAndClearExpectations(&tournamentRepositoryMock4);
     testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock2);
 
-    EXPECT_EQ(capturedTournamentIdMatchPending, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedTournamentIdTournament1, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedTournamentIdTournament2, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedTournamentIdMatchRound, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedRoundType, domain::RoundType::WILDCARD);
-    EXPECT_EQ(capturedTournamentIdGroup, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedTournamentIdMatch, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedMatches.size(), 13);
-    EXPECT_EQ(capturedMatchesIds.size(), 13);
-    EXPECT_EQ(capturedPlayoffMatchesIds.size(), 13);
-    EXPECT_EQ(capturedPlayoffMatches.size(), 13);
+    EXPECT_EQ(capturedMatches.size(), 272);
 }
 
-TEST_F(MatchDelegate2Test, ProcessScoreUpdateFinalMatchUpdateFailTest) {
+TEST_F(MatchDelegate2Test, ProcessScoreUpdateSuccessTest) {
     std::string capturedTournamentIdMatchPending;
     std::vector<std::shared_ptr<domain::Match>> pendingMatches;
     EXPECT_CALL(*matchRepositoryMock2, FindPendingMatchesByTournamentId(::testing::_))
@@ -636,11 +542,13 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateFinalMatchUpdateFailTest) {
     std::string capturedTournamentIdMatchRound;
     domain::RoundType capturedRoundType;
     std::vector<std::shared_ptr<domain::Match>> regularMatches;
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(regularMatches))
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
+                testing::Return(std::expected<size_t, std::string>(regularMatches.size()))
             )
         );
 
@@ -663,158 +571,18 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateFinalMatchUpdateFailTest) {
         );
 
     std::vector<domain::Match> capturedMatches;
-    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
-        .Times(13)
-        .WillRepeatedly(testing::DoAll(
-            testing::Invoke([&capturedMatches](const domain::Match& match) {
-                capturedMatches.push_back(match);
-            }),
-            testing::Return(std::expected<std::string, std::string>("generated-match-id"))
-        ));
-
-    std::vector<std::string> capturedMatchesIds;
-    std::vector<std::shared_ptr<domain::Match>> playoffMatches;
-
-    auto make = [&](const std::string& id, domain::RoundType round) {
-        domain::Home h{ id + "-home", "Home " + id };
-        domain::Visitor v{ id + "-visitor", "Visitor " + id };
-
-        auto m = std::make_shared<domain::Match>("tournament-id", h, v, round);
-        m->Id() = id;
-        return m;
-    };
-
-    playoffMatches.push_back(make("wildcard-1", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("wildcard-2", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("wildcard-3", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("wildcard-4", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("wildcard-5", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("wildcard-6", domain::RoundType::WILDCARD));
-    playoffMatches.push_back(make("divisional-1", domain::RoundType::DIVISIONAL));
-    playoffMatches.push_back(make("divisional-2", domain::RoundType::DIVISIONAL));
-    playoffMatches.push_back(make("divisional-3", domain::RoundType::DIVISIONAL));
-    playoffMatches.push_back(make("divisional-4", domain::RoundType::DIVISIONAL));
-    playoffMatches.push_back(make("championship-1", domain::RoundType::CHAMPIONSHIP));
-    playoffMatches.push_back(make("championship-2", domain::RoundType::CHAMPIONSHIP));
-    playoffMatches.push_back(make("superbowl-1", domain::RoundType::SUPERBOWL));
-    
-    size_t readIndex = 0;
-    EXPECT_CALL(*matchRepositoryMock2, ReadById(::testing::_))
-        .Times(13)
-        .WillRepeatedly(testing::Invoke(
-            [&](const std::string& matchId)
-                -> std::expected<std::shared_ptr<domain::Match>, std::string>
-            {
-                capturedMatchesIds.push_back(matchId);
-
-                return playoffMatches[readIndex++];
-            }
-        ));
-
-    std::string capturedPlayoffMatchId;
-    domain::Match capturedPlayoffMatch;
-    EXPECT_CALL(*matchRepositoryMock2, Update(::testing::_, ::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedPlayoffMatchId),
-                testing::SaveArg<1>(&capturedPlayoffMatch),
-                testing::Return(std::unexpected<std::string>("Database connection failed"))
-            )
-        );
-
-    ScoreUpdateEvent scoreUpdateEvent{"tournament-id", "match-id"};
-    matchDelegate2->ProcessScoreUpdate(scoreUpdateEvent);
-    
-    testing::Mock::VerifyAndClearExpectations(&groupRepositoryMock3);
-    testing::Mock::VerifyAndClearExpectations(&tournamentRepositoryMock4);
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock2);
-
-    EXPECT_EQ(capturedTournamentIdMatchPending, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedTournamentIdTournament1, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedTournamentIdTournament2, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedTournamentIdMatchRound, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedRoundType, domain::RoundType::WILDCARD);
-    EXPECT_EQ(capturedTournamentIdGroup, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedTournamentIdMatch, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedMatches.size(), 13);
-    EXPECT_EQ(capturedMatchesIds.size(), 13);
-    EXPECT_EQ(capturedPlayoffMatchId, playoffMatches[0]->Id());
-    EXPECT_EQ(capturedPlayoffMatch.Id(), playoffMatches[0]->Id());
-    EXPECT_EQ(capturedPlayoffMatch.Round(), playoffMatches[0]->Round());
-    EXPECT_EQ(capturedPlayoffMatch.TournamentId(), playoffMatches[0]->TournamentId());
-    EXPECT_EQ(capturedPlayoffMatch.getHome().id, playoffMatches[0]->getHome().id);
-    EXPECT_EQ(capturedPlayoffMatch.getVisitor().id, playoffMatches[0]->getVisitor().id);
-}
-
-TEST_F(MatchDelegate2Test, ProcessScoreUpdateFinalMatchReadFailTest) {
-    std::string capturedTournamentIdMatchPending;
-    std::vector<std::shared_ptr<domain::Match>> pendingMatches;
-    EXPECT_CALL(*matchRepositoryMock2, FindPendingMatchesByTournamentId(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchPending),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(pendingMatches))
-            )
-        );
-
-    std::string capturedTournamentIdTournament1;
-    std::string capturedTournamentIdTournament2;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock4, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournament1),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        )
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournament2),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedTournamentIdMatchRound;
-    domain::RoundType capturedRoundType;
-    std::vector<std::shared_ptr<domain::Match>> regularMatches;
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, CreateMany(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(regularMatches))
-            )
-        );
-
-    std::string capturedTournamentIdGroup;
-    auto groups = CreateCompleteGroups();
-    EXPECT_CALL(*groupRepositoryMock3, FindByTournamentId(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdGroup),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Group>>, std::string>(groups))
-            )
-        );
-
-    std::string capturedTournamentIdMatch;
-    auto matches = CreateRegularSeasonMatches();
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentId(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatch),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(matches))
-            )
-        );
+            testing::SaveArg<0>(&capturedMatches),
+            testing::Return(std::expected<std::vector<std::string>, std::string>(
+                std::vector<std::string>(13, "generated-match-id")))
+        ));
 
-    domain::Match capturedMatch;
     EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatch),
-                testing::Return(std::expected<std::string, std::string>("generated-match-id"))
-            )
-        );
+        .Times(0);
 
-    std::string capturedMatchesIds;    
     EXPECT_CALL(*matchRepositoryMock2, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchesIds),
-                testing::Return(std::unexpected<std::string>("Database connection failed"))
-            )
-        );
+        .Times(0);
 
     EXPECT_CALL(*matchRepositoryMock2, Update(::testing::_, ::testing::_))
         .Times(0);
@@ -833,8 +601,25 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateFinalMatchReadFailTest) {
     EXPECT_EQ(capturedRoundType, domain::RoundType::WILDCARD);
     EXPECT_EQ(capturedTournamentIdGroup, scoreUpdateEvent.tournamentId);
     EXPECT_EQ(capturedTournamentIdMatch, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedMatch.Round(), domain::RoundType::WILDCARD);
-    EXPECT_NE(capturedMatchesIds, "");
+    ASSERT_EQ(capturedMatches.size(), 13);
+
+    std::unordered_set<std::string> ids;
+    for (const auto& match : capturedMatches) {
+        EXPECT_FALSE(match.Id().empty());
+        ids.insert(match.Id());
+    }
+    EXPECT_EQ(ids.size(), 13);
+
+    const std::vector<std::pair<size_t, size_t>> advances = {
+        {0, 6}, {1, 7}, {2, 7}, {3, 8}, {4, 9}, {5, 9},
+        {6, 10}, {7, 10}, {8, 11}, {9, 11}, {10, 12}, {11, 12}
+    };
+    for (const auto& [from, to] : advances) {
+        EXPECT_EQ(capturedMatches[from].WinnerNextMatchId(), capturedMatches[to].Id());
+    }
+    EXPECT_TRUE(capturedMatches[12].WinnerNextMatchId().empty());
+    EXPECT_EQ(capturedMatches[0].Round(), domain::RoundType::WILDCARD);
+    EXPECT_EQ(capturedMatches[12].Round(), domain::RoundType::SUPERBOWL);
 }
 
 TEST_F(MatchDelegate2Test, ProcessScoreUpdateFinalMatchCreateFailTest) {
@@ -866,11 +651,13 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateFinalMatchCreateFailTest) {
     std::string capturedTournamentIdMatchRound;
     domain::RoundType capturedRoundType;
     std::vector<std::shared_ptr<domain::Match>> regularMatches;
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(regularMatches))
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
+                testing::Return(std::expected<size_t, std::string>(regularMatches.size()))
             )
         );
 
@@ -892,14 +679,17 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateFinalMatchCreateFailTest) {
             )
         );
 
-    domain::Match capturedMatch;
-    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
+    std::vector<domain::Match> capturedMatches;
+    EXPECT_CALL(*matchRepositoryMock2, CreateMany(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatch),
+                testing::SaveArg<0>(&capturedMatches),
                 testing::Return(std::unexpected<std::string>("Database connection failed"))
             )
         );
 
+    EXPECT_CALL(*matchRepositoryMock2, Create(::testing::_))
+        .Times(0);
+
     EXPECT_CALL(*matchRepositoryMock2, ReadById(::testing::_))
         .Times(0);
 
@@ -920,7 +710,8 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateFinalMatchCreateFailTest) {
     EXPECT_EQ(capturedRoundType, domain::RoundType::WILDCARD);
     EXPECT_EQ(capturedTournamentIdGroup, scoreUpdateEvent.tournamentId);
     EXPECT_EQ(capturedTournamentIdMatch, scoreUpdateEvent.tournamentId);
-    EXPECT_EQ(capturedMatch.Round(), domain::RoundType::WILDCARD);
+    ASSERT_EQ(capturedMatches.size(), 13);
+    EXPECT_EQ(capturedMatches[0].Round(), domain::RoundType::WILDCARD);
 }
 
 TEST_F(MatchDelegate2Test, ProcessScoreUpdateRegularMatchesReadFailTest) {
@@ -952,11 +743,13 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateRegularMatchesReadFailTest) {
     std::string capturedTournamentIdMatchRound;
     domain::RoundType capturedRoundType;
     std::vector<std::shared_ptr<domain::Match>> regularMatches;
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(regularMatches))
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
+                testing::Return(std::expected<size_t, std::string>(regularMatches.size()))
             )
         );
 
@@ -1031,11 +824,13 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateGroupsReadFailTest) {
     std::string capturedTournamentIdMatchRound;
     domain::RoundType capturedRoundType;
     std::vector<std::shared_ptr<domain::Match>> regularMatches;
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(regularMatches))
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
+                testing::Return(std::expected<size_t, std::string>(regularMatches.size()))
             )
         );
 
@@ -1103,11 +898,13 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateSecondTournamentReadFailTest) {
     std::string capturedTournamentIdMatchRound;
     domain::RoundType capturedRoundType;
     std::vector<std::shared_ptr<domain::Match>> regularMatches;
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(regularMatches))
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
+                testing::Return(std::expected<size_t, std::string>(regularMatches.size()))
             )
         );
 
@@ -1162,10 +959,12 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateWilcardMatchesReadFailTest) {
 
     std::string capturedTournamentIdMatchRound;
     domain::RoundType capturedRoundType;
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
                 testing::Return(std::unexpected<std::string>("Database connection failed"))
             )
         );
@@ -1216,7 +1015,7 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateFirstTournamentReadFailTest) {
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .Times(0);
 
     EXPECT_CALL(*groupRepositoryMock3, FindByTournamentId(::testing::_))
@@ -1258,7 +1057,7 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdatePendingMatchesFailTest) {
     EXPECT_CALL(*tournamentRepositoryMock4, ReadById(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .Times(0);
 
     EXPECT_CALL(*groupRepositoryMock3, FindByTournamentId(::testing::_))
@@ -1332,11 +1131,13 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateAdvanceSuccessTest) {
     wildcardMatches.push_back(make("wildcard-6", domain::RoundType::WILDCARD));
     wildcardMatches[5]->WinnerNextMatchId() = "divisional-4";
     
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(wildcardMatches))
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
+                testing::Return(std::expected<size_t, std::string>(wildcardMatches.size()))
             )
         );
 
@@ -1390,6 +1191,120 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateAdvanceSuccessTest) {
     EXPECT_EQ(capturedUpdatedMatch.getHome().id, "wildcard-1-home");
 }
 
+TEST_F(MatchDelegate2Test, ProcessScoreUpdateAdvanceVersionConflictTest) {
+    std::string capturedTournamentIdMatchPending;
+    std::vector<std::shared_ptr<domain::Match>> pendingMatches;
+    EXPECT_CALL(*matchRepositoryMock2, FindPendingMatchesByTournamentId(::testing::_))
+        .WillOnce(testing::DoAll(
+                testing::SaveArg<0>(&capturedTournamentIdMatchPending),
+                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(pendingMatches))
+            )
+        );
+
+    std::string capturedTournamentIdTournament;
+    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
+    tournament->Id() = "tournament-id";
+    EXPECT_CALL(*tournamentRepositoryMock4, ReadById(::testing::_))
+        .WillOnce(testing::DoAll(
+                testing::SaveArg<0>(&capturedTournamentIdTournament),
+                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
+            )
+        );
+
+    std::string capturedTournamentIdMatchRound;
+    domain::RoundType capturedRoundType;
+    std::vector<std::shared_ptr<domain::Match>> wildcardMatches;
+
+    auto make = [&](const std::string& id, domain::RoundType round) {
+        domain::Home h{ id + "-home", "Home " + id };
+        domain::Visitor v{ id + "-visitor", "Visitor " + id };
+
+        auto m = std::make_shared<domain::Match>("tournament-id", h, v, round);
+        m->Id() = id;
+        return m;
+    };
+
+    wildcardMatches.push_back(make("wildcard-1", domain::RoundType::WILDCARD));
+    wildcardMatches[0]->WinnerNextMatchId() = "divisional-1";
+    wildcardMatches.push_back(make("wildcard-2", domain::RoundType::WILDCARD));
+    wildcardMatches[1]->WinnerNextMatchId() = "divisional-2";
+    wildcardMatches.push_back(make("wildcard-3", domain::RoundType::WILDCARD));
+    wildcardMatches[2]->WinnerNextMatchId() = "divisional-2";
+    wildcardMatches.push_back(make("wildcard-4", domain::RoundType::WILDCARD));
+    wildcardMatches[3]->WinnerNextMatchId() = "divisional-3";
+    wildcardMatches.push_back(make("wildcard-5", domain::RoundType::WILDCARD));
+    wildcardMatches[4]->WinnerNextMatchId() = "divisional-4";
+    wildcardMatches.push_back(make("wildcard-6", domain::RoundType::WILDCARD));
+    wildcardMatches[5]->WinnerNextMatchId() = "divisional-4";
+    
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
+        .WillOnce(testing::DoAll(
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
+                testing::Return(std::expected<size_t, std::string>(wildcardMatches.size()))
+            )
+        );
+
+    std::string capturedMatchId1;
+    std::string capturedMatchId2;
+    auto advancingMatch = make("wildcard-1", domain::RoundType::WILDCARD);
+    advancingMatch->WinnerNextMatchId() = "divisional-1";
+    advancingMatch->MatchScore() = domain::Score{8, 4};
+
+    // El otro partido que alimenta a divisional-1 terminó al mismo tiempo y ocupó home primero
+    domain::Home h{ "", "" };
+    domain::Visitor v{ "", "" };
+    auto staleNextMatch = std::make_shared<domain::Match>("tournament-id", h, v, domain::RoundType::DIVISIONAL);
+    staleNextMatch->Id() = "divisional-1";
+    auto currentNextMatch = std::make_shared<domain::Match>("tournament-id", domain::Home{"wildcard-9-home", "Home wildcard-9"}, v, domain::RoundType::DIVISIONAL);
+    currentNextMatch->Id() = "divisional-1";
+    currentNextMatch->Version() = 1;
+    EXPECT_CALL(*matchRepositoryMock2, ReadById(::testing::_))
+        .WillOnce(testing::DoAll(
+                testing::SaveArg<0>(&capturedMatchId1),
+                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(advancingMatch))
+            )
+        )
+        .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(staleNextMatch)))
+        .WillOnce(testing::DoAll(
+                testing::SaveArg<0>(&capturedMatchId2),
+                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(currentNextMatch))
+            )
+        );
+
+    std::vector<domain::Match> capturedUpdatedMatches;
+    EXPECT_CALL(*matchRepositoryMock2, Update(::testing::_, ::testing::_))
+        .WillOnce(testing::DoAll(
+                testing::Invoke([&capturedUpdatedMatches](const std::string&, const domain::Match& match) {
+                    capturedUpdatedMatches.push_back(match);
+                }),
+                testing::Return(std::expected<std::string, std::string>(std::unexpected(std::string(MATCH_VERSION_CONFLICT))))
+            )
+        )
+        .WillOnce(testing::DoAll(
+                testing::Invoke([&capturedUpdatedMatches](const std::string&, const domain::Match& match) {
+                    capturedUpdatedMatches.push_back(match);
+                }),
+                testing::Return(std::expected<std::string, std::string>("divisional-1"))
+            )
+        );
+
+    ScoreUpdateEvent scoreUpdateEvent{"tournament-id", "wildcard-1"};
+    matchDelegate2->ProcessScoreUpdate(scoreUpdateEvent);
+
+    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock2);
+
+    EXPECT_EQ(capturedMatchId1, scoreUpdateEvent.matchId);
+    EXPECT_EQ(capturedMatchId2, "divisional-1");
+    ASSERT_EQ(capturedUpdatedMatches.size(), 2);
+    EXPECT_EQ(capturedUpdatedMatches[0].getHome().id, "wildcard-1-home");
+    EXPECT_EQ(capturedUpdatedMatches[1].Version(), 1);
+    EXPECT_EQ(capturedUpdatedMatches[1].getHome().id, "wildcard-9-home");
+    EXPECT_EQ(capturedUpdatedMatches[1].getVisitor().id, "wildcard-1-home");
+}
+
 TEST_F(MatchDelegate2Test, ProcessScoreUpdateAdvanceUpdateFailTest) {
     std::string capturedTournamentIdMatchPending;
     std::vector<std::shared_ptr<domain::Match>> pendingMatches;
@@ -1436,11 +1351,13 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateAdvanceUpdateFailTest) {
     wildcardMatches.push_back(make("wildcard-6", domain::RoundType::WILDCARD));
     wildcardMatches[5]->WinnerNextMatchId() = "divisional-4";
     
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(wildcardMatches))
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
+                testing::Return(std::expected<size_t, std::string>(wildcardMatches.size()))
             )
         );
 
@@ -1540,11 +1457,13 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateAdvanceSecondMatchReadFailTest) {
     wildcardMatches.push_back(make("wildcard-6", domain::RoundType::WILDCARD));
     wildcardMatches[5]->WinnerNextMatchId() = "divisional-4";
     
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(wildcardMatches))
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
+                testing::Return(std::expected<size_t, std::string>(wildcardMatches.size()))
             )
         );
 
@@ -1630,11 +1549,13 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateAdvanceFirstMatchReadFailTest) {
     wildcardMatches.push_back(make("wildcard-6", domain::RoundType::WILDCARD));
     wildcardMatches[5]->WinnerNextMatchId() = "divisional-4";
     
-    EXPECT_CALL(*matchRepositoryMock2, FindByTournamentIdAndRound(::testing::_, ::testing::_))
+    EXPECT_CALL(*matchRepositoryMock2, Count(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdMatchRound),
-                testing::SaveArg<1>(&capturedRoundType),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(wildcardMatches))
+                testing::Invoke([&](const MatchQuery& query) {
+                    capturedTournamentIdMatchRound = query.Tournament().value_or("");
+                    capturedRoundType = query.Round().value_or(domain::RoundType::REGULAR);
+                }),
+                testing::Return(std::expected<size_t, std::string>(wildcardMatches.size()))
             )
         );
 
@@ -1661,4 +1582,112 @@ TEST_F(MatchDelegate2Test, ProcessScoreUpdateAdvanceFirstMatchReadFailTest) {
     EXPECT_EQ(capturedTournamentIdMatchRound, scoreUpdateEvent.tournamentId);
     EXPECT_EQ(capturedRoundType, domain::RoundType::WILDCARD);
     EXPECT_EQ(capturedMatchId, scoreUpdateEvent.matchId);
-}
\ No newline at end of file
+}
+
+TEST_F(MatchDelegate2Test, ProcessScoreUpdateStandingsFirstResultTest) {
+    domain::MatchResult current{"tournament-id", "home-id", "visitor-id", domain::Score{21, 14}};
+    EXPECT_CALL(*standingsRepositoryMock2, LockAppliedResult(::testing::Eq("match-id")))
+        .WillOnce(testing::Return(std::optional<domain::MatchResult>{}));
+    EXPECT_CALL(*standingsRepositoryMock2, ReadMatchResult(::testing::Eq("match-id")))
+        .WillOnce(testing::Return(std::optional<domain::MatchResult>{current}));
+
+    std::vector<domain::StandingChange> capturedChanges;
+    std::optional<domain::MatchResult> capturedResult;
+    EXPECT_CALL(*standingsRepositoryMock2, Apply(::testing::Eq("match-id"), ::testing::Eq("tournament-id"), ::testing::_, ::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<2>(&capturedChanges),
+            testing::SaveArg<3>(&capturedResult),
+            testing::Return(std::expected<void, std::string>{})
+        ));
+
+    EXPECT_CALL(*matchRepositoryMock2, FindPendingMatchesByTournamentId(::testing::_))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Database connection failed")));
+
+    ScoreUpdateEvent scoreUpdateEvent{"tournament-id", "match-id"};
+    matchDelegate2->ProcessScoreUpdate(scoreUpdateEvent);
+
+    testing::Mock::VerifyAndClearExpectations(&standingsRepositoryMock2);
+
+    ASSERT_EQ(capturedChanges.size(), 2);
+    EXPECT_EQ(capturedChanges[0].teamId, "home-id");
+    EXPECT_EQ(capturedChanges[0].wins, 1);
+    EXPECT_EQ(capturedChanges[0].losses, 0);
+    EXPECT_EQ(capturedChanges[0].pointsFor, 21);
+    EXPECT_EQ(capturedChanges[0].pointsAgainst, 14);
+    EXPECT_EQ(capturedChanges[1].teamId, "visitor-id");
+    EXPECT_EQ(capturedChanges[1].wins, 0);
+    EXPECT_EQ(capturedChanges[1].losses, 1);
+    EXPECT_EQ(capturedChanges[1].pointsFor, 14);
+    EXPECT_EQ(capturedChanges[1].pointsAgainst, 21);
+    ASSERT_TRUE(capturedResult.has_value());
+    EXPECT_EQ(capturedResult->score.homeTeamScore, 21);
+}
+
+TEST_F(MatchDelegate2Test, ProcessScoreUpdateStandingsDuplicateEventTest) {
+    domain::MatchResult current{"tournament-id", "home-id", "visitor-id", domain::Score{21, 14}};
+    EXPECT_CALL(*standingsRepositoryMock2, LockAppliedResult(::testing::_))
+        .WillOnce(testing::Return(std::optional<domain::MatchResult>{current}));
+    EXPECT_CALL(*standingsRepositoryMock2, ReadMatchResult(::testing::_))
+        .WillOnce(testing::Return(std::optional<domain::MatchResult>{current}));
+    EXPECT_CALL(*standingsRepositoryMock2, Apply(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(0);
+
+    EXPECT_CALL(*matchRepositoryMock2, FindPendingMatchesByTournamentId(::testing::_))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Database connection failed")));
+
+    ScoreUpdateEvent scoreUpdateEvent{"tournament-id", "match-id"};
+    matchDelegate2->ProcessScoreUpdate(scoreUpdateEvent);
+}
+
+TEST_F(MatchDelegate2Test, ProcessScoreUpdateStandingsCorrectedScoreTest) {
+    domain::MatchResult applied{"tournament-id", "home-id", "visitor-id", domain::Score{21, 14}};
+    domain::MatchResult current{"tournament-id", "home-id", "visitor-id", domain::Score{14, 17}};
+    EXPECT_CALL(*standingsRepositoryMock2, LockAppliedResult(::testing::_))
+        .WillOnce(testing::Return(std::optional<domain::MatchResult>{applied}));
+    EXPECT_CALL(*standingsRepositoryMock2, ReadMatchResult(::testing::_))
+        .WillOnce(testing::Return(std::optional<domain::MatchResult>{current}));
+
+    std::vector<domain::StandingChange> capturedChanges;
+    EXPECT_CALL(*standingsRepositoryMock2, Apply(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<2>(&capturedChanges),
+            testing::Return(std::expected<void, std::string>{})
+        ));
+
+    EXPECT_CALL(*matchRepositoryMock2, FindPendingMatchesByTournamentId(::testing::_))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Database connection failed")));
+
+    ScoreUpdateEvent scoreUpdateEvent{"tournament-id", "match-id"};
+    matchDelegate2->ProcessScoreUpdate(scoreUpdateEvent);
+
+    testing::Mock::VerifyAndClearExpectations(&standingsRepositoryMock2);
+
+    // La victoria del local pasa a derrota y viceversa
+    ASSERT_EQ(capturedChanges.size(), 2);
+    EXPECT_EQ(capturedChanges[0].teamId, "home-id");
+    EXPECT_EQ(capturedChanges[0].wins, -1);
+    EXPECT_EQ(capturedChanges[0].losses, 1);
+    EXPECT_EQ(capturedChanges[0].pointsFor, -7);
+    EXPECT_EQ(capturedChanges[0].pointsAgainst, 3);
+    EXPECT_EQ(capturedChanges[1].teamId, "visitor-id");
+    EXPECT_EQ(capturedChanges[1].wins, 1);
+    EXPECT_EQ(capturedChanges[1].losses, -1);
+    EXPECT_EQ(capturedChanges[1].pointsFor, 3);
+    EXPECT_EQ(capturedChanges[1].pointsAgainst, -7);
+}
+
+TEST_F(MatchDelegate2Test, ProcessScoreUpdateStandingsLockFailTest) {
+    EXPECT_CALL(*standingsRepositoryMock2, LockAppliedResult(::testing::_))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Database connection failed")));
+    EXPECT_CALL(*standingsRepositoryMock2, ReadMatchResult(::testing::_))
+        .Times(0);
+    EXPECT_CALL(*standingsRepositoryMock2, Apply(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(0);
+
+    // La tabla no detiene el avance del torneo
+    EXPECT_CALL(*matchRepositoryMock2, FindPendingMatchesByTournamentId(::testing::_))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Database connection failed")));
+
+    ScoreUpdateEvent scoreUpdateEvent{"tournament-id", "match-id"};
+    matchDelegate2->ProcessScoreUpdate(scoreUpdateEvent);
+}
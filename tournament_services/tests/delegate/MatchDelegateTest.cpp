@@ -1,11 +1,14 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <crow.h>
+#include <thread>
+#include <asio.hpp>
 
 #include "domain/Match.hpp"
 #include "persistence/repository/MatchRepository.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
-#include "persistence/repository/GroupRepository.hpp"
+#include "persistence/repository/IAsyncMatchRepository.hpp"
+#include "persistence/repository/IAsyncTournamentRepository.hpp"
 #include "delegate/MatchDelegate.hpp"
 #include "domain/Utilities.hpp"
 
@@ -13,11 +16,7 @@ class MatchRepositoryMock : public MatchRepository {
 public:
     MatchRepositoryMock() : MatchRepository(nullptr) {}
 
-    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>), FindByTournamentId, (const std::string_view& tournamentId), (override));
-    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>), FindPlayedMatchesByTournamentId, (const std::string_view& tournamentId), (override));
-    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>), FindPendingMatchesByTournamentId, (const std::string_view& tournamentId), (override));
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Match>, std::string>), ReadById, (const std::string& id), (override));
-    MOCK_METHOD((std::expected<std::string, std::string>), Update, (const std::string& id, const domain::Match& match), (override));
 };
 
 class TournamentRepositoryMock3 : public TournamentRepository {
@@ -25,14 +24,18 @@ public:
     TournamentRepositoryMock3() : TournamentRepository(nullptr) {}
 
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Tournament>, std::string>), ReadById, (std::string id), (override));
-    MOCK_METHOD((std::expected<std::string, std::string>), Update, (std::string id, const domain::Tournament & entity), (override));
 };
 
-class GroupRepositoryMock2 : public GroupRepository {
+class AsyncMatchRepositoryMock : public IAsyncMatchRepository {
 public:
-    GroupRepositoryMock2() : GroupRepository(nullptr) {}
+    MOCK_METHOD((asio::awaitable<std::expected<ScoreUpdate, std::string>>), UpdateScore, (std::string tournamentId, std::string matchId, domain::Score score, std::vector<domain::RoundType> validRounds), (override));
+    MOCK_METHOD((asio::awaitable<std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>>), Find, (MatchQuery query), (override));
+    MOCK_METHOD((asio::awaitable<std::expected<int64_t, std::string>>), ReadChangeVersion, (std::string tournamentId), (override));
+};
 
-    
+class AsyncTournamentRepositoryMock : public IAsyncTournamentRepository {
+public:
+    MOCK_METHOD((asio::awaitable<std::expected<std::shared_ptr<domain::Tournament>, std::string>>), ReadById, (std::string id), (override));
 };
 
 class QueueMessageProducerMock2 : public QueueMessageProducer {
@@ -40,22 +43,42 @@ public:
     QueueMessageProducerMock2(): QueueMessageProducer(nullptr) {}
 
     MOCK_METHOD(void, SendMessage, (const std::string_view& message, const std::string_view& queue), (override));
+    MOCK_METHOD(void, Publish, (const std::string_view& message, const std::string_view& topic), (override));
 };
 
+using TournamentResult = std::expected<std::shared_ptr<domain::Tournament>, std::string>;
+using MatchesResult = std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>;
+using UpdateResult = std::expected<ScoreUpdate, std::string>;
+using VersionResult = std::expected<int64_t, std::string>;
+
+template<typename T>
+asio::awaitable<T> Ready(T value) {
+    co_return value;
+}
+
+// Acción para los métodos asíncronos: devuelve una corrutina que termina con el valor dado
+template<typename T>
+auto ReturnReady(T value) {
+    return [value](auto&&...) { return Ready(value); };
+}
+
 class MatchDelegateTest : public ::testing::Test{
 protected:
     std::shared_ptr<MatchRepositoryMock> matchRepositoryMock;
     std::shared_ptr<TournamentRepositoryMock3> tournamentRepositoryMock3;
-    std::shared_ptr<GroupRepositoryMock2> groupRepositoryMock2;
+    std::shared_ptr<AsyncMatchRepositoryMock> asyncMatchRepositoryMock;
+    std::shared_ptr<AsyncTournamentRepositoryMock> asyncTournamentRepositoryMock;
     std::shared_ptr<QueueMessageProducerMock2> producerMock2;
     std::shared_ptr<MatchDelegate> matchDelegate;
 
     void SetUp() override {
         matchRepositoryMock = std::make_shared<MatchRepositoryMock>();
         tournamentRepositoryMock3 = std::make_shared<TournamentRepositoryMock3>();
-        groupRepositoryMock2 = std::make_shared<GroupRepositoryMock2>();
+        asyncMatchRepositoryMock = std::make_shared<AsyncMatchRepositoryMock>();
+        asyncTournamentRepositoryMock = std::make_shared<AsyncTournamentRepositoryMock>();
         producerMock2 = std::make_shared<QueueMessageProducerMock2>();
-        matchDelegate = std::make_shared<MatchDelegate>(MatchDelegate(matchRepositoryMock, tournamentRepositoryMock3, groupRepositoryMock2, producerMock2));
+        matchDelegate = std::make_shared<MatchDelegate>(matchRepositoryMock, tournamentRepositoryMock3, producerMock2,
+                                                        asyncMatchRepositoryMock, asyncTournamentRepositoryMock);
     }
 
     // TearDown() function
@@ -63,395 +86,228 @@ protected:
         // teardown code comes here
     }
 
+    // Corre la corrutina del delegate en un io_context propio hasta que termina
+    template<typename T>
+    T Run(asio::awaitable<T> operation) {
+        asio::io_context ioContext;
+        auto result = asio::co_spawn(ioContext, std::move(operation), asio::use_future);
+        ioContext.run();
+        return result.get();
+    }
+
+    static std::vector<std::shared_ptr<domain::Match>> TwoMatches() {
+        std::vector<std::shared_ptr<domain::Match>> matches;
+        for (int i = 0; i < 2; i++) {
+            nlohmann::json matchData = {
+                {"id", "match-id-" + std::to_string(i)},
+                {"round", "regular"},
+                {"tournamentId", "tournament-id-" + std::to_string(i)},
+                {"home", {
+                    {"id", "team-" + std::to_string(i * 2) + "-id"},
+                    {"name", "Team " + std::to_string(i * 2)}
+                }},
+                {"visitor", {
+                    {"id", "team-" + std::to_string(i * 2 + 1) + "-id"},
+                    {"name", "Team " + std::to_string(i * 2 + 1)}
+                }}
+            };
+            matches.push_back(std::make_shared<domain::Match>(matchData));
+        }
+        return matches;
+    }
+
+    static TournamentResult ExistingTournament() {
+        auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
+        tournament->Id() = "tournament-id";
+        return tournament;
+    }
+
+    static void ExpectTwoMatches(const MatchesResult& response) {
+        ASSERT_TRUE(response.has_value());
+        EXPECT_EQ(response.value().size(), 2);
+        EXPECT_EQ(response.value()[0]->Id(), "match-id-0");
+        EXPECT_EQ(response.value()[0]->Round(), domain::RoundType::REGULAR);
+        EXPECT_EQ(response.value()[0]->TournamentId(), "tournament-id-0");
+        EXPECT_EQ(response.value()[0]->getHome().id, "team-0-id");
+        EXPECT_EQ(response.value()[0]->getHome().name, "Team 0");
+        EXPECT_EQ(response.value()[0]->getVisitor().id, "team-1-id");
+        EXPECT_EQ(response.value()[0]->getVisitor().name, "Team 1");
+        EXPECT_EQ(response.value()[1]->Id(), "match-id-1");
+        EXPECT_EQ(response.value()[1]->Round(), domain::RoundType::REGULAR);
+        EXPECT_EQ(response.value()[1]->TournamentId(), "tournament-id-1");
+        EXPECT_EQ(response.value()[1]->getHome().id, "team-2-id");
+        EXPECT_EQ(response.value()[1]->getHome().name, "Team 2");
+        EXPECT_EQ(response.value()[1]->getVisitor().id, "team-3-id");
+        EXPECT_EQ(response.value()[1]->getVisitor().name, "Team 3");
+    }
+
 };
 
 TEST_F(MatchDelegateTest, GetMatchesSuccessTest) {
     std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
+    EXPECT_CALL(*asyncTournamentRepositoryMock, ReadById(::testing::_))
         .WillOnce(testing::DoAll(
                 testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
+                ReturnReady(ExistingTournament())
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock, FindPlayedMatchesByTournamentId(::testing::_))
-        .Times(0);
-
-    EXPECT_CALL(*matchRepositoryMock, FindPendingMatchesByTournamentId(::testing::_))
-        .Times(0);
-
-    std::string capturedTournamentId;
-
-    std::vector<std::shared_ptr<domain::Match>> existingMatches;
-    for (int i = 0; i < 2; i++) {
-        nlohmann::json matchData = {
-            {"id", "match-id-" + std::to_string(i)},
-            {"round", "regular"},
-            {"tournamentId", "tournament-id-" + std::to_string(i)},
-            {"home", {
-                {"id", "team-" + std::to_string(i * 2) + "-id"},
-                {"name", "Team " + std::to_string(i * 2)}
-            }},
-            {"visitor", {
-                {"id", "team-" + std::to_string(i * 2 + 1) + "-id"},
-                {"name", "Team " + std::to_string(i * 2 + 1)}
-            }}
-        };
-        auto match = std::make_shared<domain::Match>(matchData);
-        existingMatches.push_back(match);
-    }
-
-    EXPECT_CALL(*matchRepositoryMock, FindByTournamentId(::testing::_))
+    MatchQuery capturedQuery;
+    EXPECT_CALL(*asyncMatchRepositoryMock, Find(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentId),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(existingMatches))
+                testing::SaveArg<0>(&capturedQuery),
+                ReturnReady(MatchesResult(TwoMatches()))
             )
         );
 
-    std::string_view tournamentId = "tournament-id";
-    std::optional<std::string> filter;
-    auto response = matchDelegate->GetMatches(tournamentId, filter);
-
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    std::string tournamentId = "tournament-id";
+    auto response = Run(matchDelegate->GetMatchesAsync(tournamentId, std::nullopt));
 
     EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedTournamentId, tournamentId);
-    EXPECT_EQ(response.value().size(), 2);
-    EXPECT_EQ(response.value()[0]->Id(), "match-id-0");
-    EXPECT_EQ(response.value()[0]->Round(), domain::RoundType::REGULAR);
-    EXPECT_EQ(response.value()[0]->TournamentId(), "tournament-id-0");
-    EXPECT_EQ(response.value()[0]->getHome().id, "team-0-id");
-    EXPECT_EQ(response.value()[0]->getHome().name, "Team 0");
-    EXPECT_EQ(response.value()[0]->getVisitor().id, "team-1-id");
-    EXPECT_EQ(response.value()[0]->getVisitor().name, "Team 1");
-    EXPECT_EQ(response.value()[1]->Id(), "match-id-1");
-    EXPECT_EQ(response.value()[1]->Round(), domain::RoundType::REGULAR);
-    EXPECT_EQ(response.value()[1]->TournamentId(), "tournament-id-1");
-    EXPECT_EQ(response.value()[1]->getHome().id, "team-2-id");
-    EXPECT_EQ(response.value()[1]->getHome().name, "Team 2");
-    EXPECT_EQ(response.value()[1]->getVisitor().id, "team-3-id");
-    EXPECT_EQ(response.value()[1]->getVisitor().name, "Team 3");
+    EXPECT_EQ(capturedQuery.Tournament(), tournamentId);
+    // Sin filtro no se filtra por jugado
+    EXPECT_FALSE(capturedQuery.Played().has_value());
+    ExpectTwoMatches(response);
 }
 
 TEST_F(MatchDelegateTest, GetMatchesEmptyTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    EXPECT_CALL(*matchRepositoryMock, FindPlayedMatchesByTournamentId(::testing::_))
-        .Times(0);
-
-    EXPECT_CALL(*matchRepositoryMock, FindPendingMatchesByTournamentId(::testing::_))
-        .Times(0);
-
-    std::string capturedTournamentId;
+    EXPECT_CALL(*asyncTournamentRepositoryMock, ReadById("tournament-id"))
+        .WillOnce(ReturnReady(ExistingTournament()));
 
-    std::vector<std::shared_ptr<domain::Match>> existingMatches;
+    EXPECT_CALL(*asyncMatchRepositoryMock, Find(::testing::_))
+        .WillOnce(ReturnReady(MatchesResult(std::vector<std::shared_ptr<domain::Match>>{})));
 
-    EXPECT_CALL(*matchRepositoryMock, FindByTournamentId(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentId),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(existingMatches))
-            )
-        );
-
-    std::string_view tournamentId = "tournament-id";
-    std::optional<std::string> filter;
-    auto response = matchDelegate->GetMatches(tournamentId, filter);
-
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    auto response = Run(matchDelegate->GetMatchesAsync("tournament-id", std::nullopt));
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedTournamentId, tournamentId);
+    ASSERT_TRUE(response.has_value());
     EXPECT_TRUE(response.value().empty());
 }
 
 TEST_F(MatchDelegateTest, GetMatchesPlayedFilterTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedTournamentId;
-
-    std::vector<std::shared_ptr<domain::Match>> existingMatches;
-    for (int i = 0; i < 2; i++) {
-        nlohmann::json matchData = {
-            {"id", "match-id-" + std::to_string(i)},
-            {"round", "regular"},
-            {"tournamentId", "tournament-id-" + std::to_string(i)},
-            {"home", {
-                {"id", "team-" + std::to_string(i * 2) + "-id"},
-                {"name", "Team " + std::to_string(i * 2)}
-            }},
-            {"visitor", {
-                {"id", "team-" + std::to_string(i * 2 + 1) + "-id"},
-                {"name", "Team " + std::to_string(i * 2 + 1)}
-            }}
-        };
-        auto match = std::make_shared<domain::Match>(matchData);
-        existingMatches.push_back(match);
-    }
+    EXPECT_CALL(*asyncTournamentRepositoryMock, ReadById("tournament-id"))
+        .WillOnce(ReturnReady(ExistingTournament()));
 
-    EXPECT_CALL(*matchRepositoryMock, FindPlayedMatchesByTournamentId(::testing::_))
+    MatchQuery capturedQuery;
+    EXPECT_CALL(*asyncMatchRepositoryMock, Find(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentId),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(existingMatches))
+                testing::SaveArg<0>(&capturedQuery),
+                ReturnReady(MatchesResult(TwoMatches()))
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock, FindPendingMatchesByTournamentId(::testing::_))
-        .Times(0);
-
-    EXPECT_CALL(*matchRepositoryMock, FindByTournamentId(::testing::_))
-        .Times(0);
-
-    std::string_view tournamentId = "tournament-id";
-    std::optional<std::string> filter = "played";
-    auto response = matchDelegate->GetMatches(tournamentId, filter);
-
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    auto response = Run(matchDelegate->GetMatchesAsync("tournament-id", "played"));
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedTournamentId, tournamentId);
-    EXPECT_EQ(response.value().size(), 2);
-    EXPECT_EQ(response.value()[0]->Id(), "match-id-0");
-    EXPECT_EQ(response.value()[0]->Round(), domain::RoundType::REGULAR);
-    EXPECT_EQ(response.value()[0]->TournamentId(), "tournament-id-0");
-    EXPECT_EQ(response.value()[0]->getHome().id, "team-0-id");
-    EXPECT_EQ(response.value()[0]->getHome().name, "Team 0");
-    EXPECT_EQ(response.value()[0]->getVisitor().id, "team-1-id");
-    EXPECT_EQ(response.value()[0]->getVisitor().name, "Team 1");
-    EXPECT_EQ(response.value()[1]->Id(), "match-id-1");
-    EXPECT_EQ(response.value()[1]->Round(), domain::RoundType::REGULAR);
-    EXPECT_EQ(response.value()[1]->TournamentId(), "tournament-id-1");
-    EXPECT_EQ(response.value()[1]->getHome().id, "team-2-id");
-    EXPECT_EQ(response.value()[1]->getHome().name, "Team 2");
-    EXPECT_EQ(response.value()[1]->getVisitor().id, "team-3-id");
-    EXPECT_EQ(response.value()[1]->getVisitor().name, "Team 3");
+    EXPECT_EQ(capturedQuery.Tournament(), "tournament-id");
+    EXPECT_EQ(capturedQuery.Played(), true);
+    ExpectTwoMatches(response);
 }
 
 TEST_F(MatchDelegateTest, GetMatchesPendingFilterTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
+    EXPECT_CALL(*asyncTournamentRepositoryMock, ReadById("tournament-id"))
+        .WillOnce(ReturnReady(ExistingTournament()));
+
+    MatchQuery capturedQuery;
+    EXPECT_CALL(*asyncMatchRepositoryMock, Find(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
+                testing::SaveArg<0>(&capturedQuery),
+                ReturnReady(MatchesResult(TwoMatches()))
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock, FindPlayedMatchesByTournamentId(::testing::_))
-        .Times(0);
+    auto response = Run(matchDelegate->GetMatchesAsync("tournament-id", "pending"));
 
-    std::string capturedTournamentId;
+    EXPECT_EQ(capturedQuery.Tournament(), "tournament-id");
+    EXPECT_EQ(capturedQuery.Played(), false);
+    ExpectTwoMatches(response);
+}
 
-    std::vector<std::shared_ptr<domain::Match>> existingMatches;
-    for (int i = 0; i < 2; i++) {
-        nlohmann::json matchData = {
-            {"id", "match-id-" + std::to_string(i)},
-            {"round", "regular"},
-            {"tournamentId", "tournament-id-" + std::to_string(i)},
-            {"home", {
-                {"id", "team-" + std::to_string(i * 2) + "-id"},
-                {"name", "Team " + std::to_string(i * 2)}
-            }},
-            {"visitor", {
-                {"id", "team-" + std::to_string(i * 2 + 1) + "-id"},
-                {"name", "Team " + std::to_string(i * 2 + 1)}
-            }}
-        };
-        auto match = std::make_shared<domain::Match>(matchData);
-        existingMatches.push_back(match);
-    }
+TEST_F(MatchDelegateTest, GetMatchesUnknownFilterTest) {
+    EXPECT_CALL(*asyncTournamentRepositoryMock, ReadById("tournament-id"))
+        .WillOnce(ReturnReady(ExistingTournament()));
 
-    EXPECT_CALL(*matchRepositoryMock, FindPendingMatchesByTournamentId(::testing::_))
+    // Un filtro desconocido lista todos los matches
+    MatchQuery capturedQuery;
+    EXPECT_CALL(*asyncMatchRepositoryMock, Find(::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentId),
-                testing::Return(std::expected<std::vector<std::shared_ptr<domain::Match>>, std::string>(existingMatches))
+                testing::SaveArg<0>(&capturedQuery),
+                ReturnReady(MatchesResult(TwoMatches()))
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock, FindByTournamentId(::testing::_))
-        .Times(0);
-
-    std::string_view tournamentId = "tournament-id";
-    std::optional<std::string> filter = "pending";
-    auto response = matchDelegate->GetMatches(tournamentId, filter);
-
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    auto response = Run(matchDelegate->GetMatchesAsync("tournament-id", "upcoming"));
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedTournamentId, tournamentId);
-    EXPECT_EQ(response.value().size(), 2);
-    EXPECT_EQ(response.value()[0]->Id(), "match-id-0");
-    EXPECT_EQ(response.value()[0]->Round(), domain::RoundType::REGULAR);
-    EXPECT_EQ(response.value()[0]->TournamentId(), "tournament-id-0");
-    EXPECT_EQ(response.value()[0]->getHome().id, "team-0-id");
-    EXPECT_EQ(response.value()[0]->getHome().name, "Team 0");
-    EXPECT_EQ(response.value()[0]->getVisitor().id, "team-1-id");
-    EXPECT_EQ(response.value()[0]->getVisitor().name, "Team 1");
-    EXPECT_EQ(response.value()[1]->Id(), "match-id-1");
-    EXPECT_EQ(response.value()[1]->Round(), domain::RoundType::REGULAR);
-    EXPECT_EQ(response.value()[1]->TournamentId(), "tournament-id-1");
-    EXPECT_EQ(response.value()[1]->getHome().id, "team-2-id");
-    EXPECT_EQ(response.value()[1]->getHome().name, "Team 2");
-    EXPECT_EQ(response.value()[1]->getVisitor().id, "team-3-id");
-    EXPECT_EQ(response.value()[1]->getVisitor().name, "Team 3");
+    EXPECT_FALSE(capturedQuery.Played().has_value());
+    ExpectTwoMatches(response);
 }
 
 TEST_F(MatchDelegateTest, GetMatchesFailTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    EXPECT_CALL(*matchRepositoryMock, FindPlayedMatchesByTournamentId(::testing::_))
-        .Times(0);
-
-    EXPECT_CALL(*matchRepositoryMock, FindPendingMatchesByTournamentId(::testing::_))
-        .Times(0);
-
-    std::string capturedTournamentId;
-    EXPECT_CALL(*matchRepositoryMock, FindByTournamentId(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentId),
-                testing::Return(std::unexpected<std::string>("Database connection failed"))
-            )
-        );
+    EXPECT_CALL(*asyncTournamentRepositoryMock, ReadById("tournament-id"))
+        .WillOnce(ReturnReady(ExistingTournament()));
 
-    std::string_view tournamentId = "tournament-id";
-    std::optional<std::string> filter;
-    auto response = matchDelegate->GetMatches(tournamentId, filter);
+    EXPECT_CALL(*asyncMatchRepositoryMock, Find(::testing::_))
+        .WillOnce(ReturnReady(MatchesResult(std::unexpected<std::string>("Database connection failed"))));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    auto response = Run(matchDelegate->GetMatchesAsync("tournament-id", std::nullopt));
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedTournamentId, tournamentId);
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Database connection failed");
 }
 
 TEST_F(MatchDelegateTest, GetMatchesPlayedFilterFailTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedTournamentId;
-    EXPECT_CALL(*matchRepositoryMock, FindPlayedMatchesByTournamentId(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentId),
-                testing::Return(std::unexpected<std::string>("Database connection failed"))
-            )
-        );
-
-    EXPECT_CALL(*matchRepositoryMock, FindPendingMatchesByTournamentId(::testing::_))
-        .Times(0);
+    EXPECT_CALL(*asyncTournamentRepositoryMock, ReadById("tournament-id"))
+        .WillOnce(ReturnReady(ExistingTournament()));
 
-    EXPECT_CALL(*matchRepositoryMock, FindByTournamentId(::testing::_))
-        .Times(0);
-
-    std::string_view tournamentId = "tournament-id";
-    std::optional<std::string> filter = "played";
-    auto response = matchDelegate->GetMatches(tournamentId, filter);
+    EXPECT_CALL(*asyncMatchRepositoryMock, Find(::testing::Property(&MatchQuery::Played, std::optional<bool>(true))))
+        .WillOnce(ReturnReady(MatchesResult(std::unexpected<std::string>("Database connection failed"))));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    auto response = Run(matchDelegate->GetMatchesAsync("tournament-id", "played"));
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedTournamentId, tournamentId);
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Database connection failed");
 }
 
 TEST_F(MatchDelegateTest, GetMatchesPendingFilterFailTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    EXPECT_CALL(*matchRepositoryMock, FindPlayedMatchesByTournamentId(::testing::_))
-        .Times(0);
-
-    std::string capturedTournamentId;
-    EXPECT_CALL(*matchRepositoryMock, FindPendingMatchesByTournamentId(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentId),
-                testing::Return(std::unexpected<std::string>("Database connection failed"))
-            )
-        );
-
-    EXPECT_CALL(*matchRepositoryMock, FindByTournamentId(::testing::_))
-        .Times(0);
+    EXPECT_CALL(*asyncTournamentRepositoryMock, ReadById("tournament-id"))
+        .WillOnce(ReturnReady(ExistingTournament()));
 
-    std::string_view tournamentId = "tournament-id";
-    std::optional<std::string> filter = "pending";
-    auto response = matchDelegate->GetMatches(tournamentId, filter);
+    EXPECT_CALL(*asyncMatchRepositoryMock, Find(::testing::Property(&MatchQuery::Played, std::optional<bool>(false))))
+        .WillOnce(ReturnReady(MatchesResult(std::unexpected<std::string>("Database connection failed"))));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    auto response = Run(matchDelegate->GetMatchesAsync("tournament-id", "pending"));
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedTournamentId, tournamentId);
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Database connection failed");
 }
 
 TEST_F(MatchDelegateTest, GetMatchesTournamentNotFoundTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::unexpected<std::string>("Tournament not found"))
-            )
-        );
+    EXPECT_CALL(*asyncTournamentRepositoryMock, ReadById("tournament-id"))
+        .WillOnce(ReturnReady(TournamentResult(std::unexpected<std::string>("Tournament not found"))));
 
-    EXPECT_CALL(*matchRepositoryMock, FindPlayedMatchesByTournamentId(::testing::_))
+    EXPECT_CALL(*asyncMatchRepositoryMock, Find(::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*matchRepositoryMock, FindPendingMatchesByTournamentId(::testing::_))
-        .Times(0);
+    auto response = Run(matchDelegate->GetMatchesAsync("tournament-id", std::nullopt));
 
-    EXPECT_CALL(*matchRepositoryMock, FindByTournamentId(::testing::_))
-        .Times(0);
+    EXPECT_FALSE(response.has_value());
+    EXPECT_EQ(response.error(), "Tournament not found");
+}
 
-    std::string_view tournamentId = "tournament-id";
-    std::optional<std::string> filter;
-    auto response = matchDelegate->GetMatches(tournamentId, filter);
+TEST_F(MatchDelegateTest, GetMatchesVersionTest) {
+    EXPECT_CALL(*asyncMatchRepositoryMock, ReadChangeVersion("tournament-id"))
+        .WillOnce(ReturnReady(VersionResult(7)));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    auto response = Run(matchDelegate->GetMatchesVersionAsync("tournament-id"));
+
+    ASSERT_TRUE(response.has_value());
+    EXPECT_EQ(response.value(), 7);
+}
+
+TEST_F(MatchDelegateTest, GetMatchesVersionTournamentNotFoundTest) {
+    EXPECT_CALL(*asyncMatchRepositoryMock, ReadChangeVersion("tournament-id"))
+        .WillOnce(ReturnReady(VersionResult(std::unexpected<std::string>("Tournament not found"))));
+
+    auto response = Run(matchDelegate->GetMatchesVersionAsync("tournament-id"));
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Tournament not found");
 }
@@ -608,18 +464,8 @@ TEST_F(MatchDelegateTest, GetMatchWrongMatchTest) {
     EXPECT_EQ(response.error(), "Match does not belong to the specified tournament");
 }
 
-TEST_F(MatchDelegateTest, UpdateMatchScoreSuccessTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
 
-    std::string capturedMatchIdRead;
+TEST_F(MatchDelegateTest, UpdateMatchScoreSuccessTest) {
     nlohmann::json matchData = {
         {"id", "match-id-0"},
         {"round", "regular"},
@@ -631,24 +477,31 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreSuccessTest) {
         {"visitor", {
             {"id", "team-1-id"},
             {"name", "Team 1"}
+        }},
+        {"score", {
+            {"home", 6},
+            {"visitor", 7}
         }}
     };
     auto match = std::make_shared<domain::Match>(matchData);
 
+    // El torneo y el match no se leen antes de escribir
+    EXPECT_CALL(*asyncTournamentRepositoryMock, ReadById(::testing::_))
+        .Times(0);
     EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(match))
-            )
-        );
+        .Times(0);
 
-    std::string capturedMatchIdUpdate;
-    domain::Match capturedMatch;
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
+    std::string capturedTournamentId;
+    std::string capturedMatchId;
+    domain::Score capturedScore{};
+    std::vector<domain::RoundType> capturedRounds;
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdUpdate),
-                testing::SaveArg<1>(&capturedMatch),
-                testing::Return(std::expected<std::string, std::string>("match-id-0"))
+                testing::SaveArg<0>(&capturedTournamentId),
+                testing::SaveArg<1>(&capturedMatchId),
+                testing::SaveArg<2>(&capturedScore),
+                testing::SaveArg<3>(&capturedRounds),
+                ReturnReady(UpdateResult(ScoreUpdate{match, true}))
             )
         );
 
@@ -664,27 +517,23 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreSuccessTest) {
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id-0";
     domain::Score score{6, 7};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
     testing::Mock::VerifyAndClearExpectations(&producerMock2);
 
     nlohmann::json messageJson = nlohmann::json::parse(capturedMessage);
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
-    EXPECT_EQ(capturedMatchIdUpdate, matchId);
-    EXPECT_EQ(capturedMatch.Id(), "match-id-0");
-    EXPECT_EQ(capturedMatch.Round(), domain::RoundType::REGULAR);
-    EXPECT_EQ(capturedMatch.TournamentId(), "tournament-id");
-    EXPECT_EQ(capturedMatch.getHome().id, "team-0-id");
-    EXPECT_EQ(capturedMatch.getHome().name, "Team 0");
-    EXPECT_EQ(capturedMatch.getVisitor().id, "team-1-id");
-    EXPECT_EQ(capturedMatch.getVisitor().name, "Team 1");
-    EXPECT_EQ(capturedMatch.MatchScore().value().homeTeamScore, score.homeTeamScore);
-    EXPECT_EQ(capturedMatch.MatchScore().value().visitorTeamScore, score.visitorTeamScore);
+    EXPECT_EQ(capturedTournamentId, tournamentId);
+    EXPECT_EQ(capturedMatchId, matchId);
+    EXPECT_EQ(capturedScore.homeTeamScore, score.homeTeamScore);
+    EXPECT_EQ(capturedScore.visitorTeamScore, score.visitorTeamScore);
+    EXPECT_EQ(capturedRounds, (std::vector<domain::RoundType>{
+        domain::RoundType::REGULAR, domain::RoundType::WILDCARD, domain::RoundType::DIVISIONAL,
+        domain::RoundType::CHAMPIONSHIP, domain::RoundType::SUPERBOWL}));
     EXPECT_EQ(messageJson["tournamentId"], tournamentId);
     EXPECT_EQ(messageJson["matchId"], matchId);
+    EXPECT_EQ(messageJson["round"], static_cast<int>(domain::RoundType::REGULAR));
     EXPECT_EQ(messageJson["homeTeamId"], "team-0-id");
     EXPECT_EQ(messageJson["visitorTeamId"], "team-1-id");
     EXPECT_EQ(messageJson["homeScore"], score.homeTeamScore);
@@ -694,17 +543,6 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreSuccessTest) {
 }
 
 TEST_F(MatchDelegateTest, UpdateMatchScorePlayoffSuccessTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedMatchIdRead;
     nlohmann::json matchData = {
         {"id", "match-id-0"},
         {"round", "championship"},
@@ -716,26 +554,17 @@ TEST_F(MatchDelegateTest, UpdateMatchScorePlayoffSuccessTest) {
         {"visitor", {
             {"id", "team-1-id"},
             {"name", "Team 1"}
-        }}
+        }},
+        {"score", {
+            {"home", 6},
+            {"visitor", 7}
+        }},
+        {"winnerNextMatchId", "match-id-1"}
     };
     auto match = std::make_shared<domain::Match>(matchData);
 
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(match))
-            )
-        );
-
-    std::string capturedMatchIdUpdate;
-    domain::Match capturedMatch;
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdUpdate),
-                testing::SaveArg<1>(&capturedMatch),
-                testing::Return(std::expected<std::string, std::string>("match-id-0"))
-            )
-        );
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore("tournament-id", "match-id-0", ::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(UpdateResult(ScoreUpdate{match, true})));
 
     std::string capturedMessage;
     std::string capturedQueue;
@@ -749,71 +578,29 @@ TEST_F(MatchDelegateTest, UpdateMatchScorePlayoffSuccessTest) {
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id-0";
     domain::Score score{6, 7};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
     testing::Mock::VerifyAndClearExpectations(&producerMock2);
 
     nlohmann::json messageJson = nlohmann::json::parse(capturedMessage);
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
-    EXPECT_EQ(capturedMatchIdUpdate, matchId);
-    EXPECT_EQ(capturedMatch.Id(), "match-id-0");
-    EXPECT_EQ(capturedMatch.Round(), domain::RoundType::CHAMPIONSHIP);
-    EXPECT_EQ(capturedMatch.TournamentId(), "tournament-id");
-    EXPECT_EQ(capturedMatch.getHome().id, "team-0-id");
-    EXPECT_EQ(capturedMatch.getHome().name, "Team 0");
-    EXPECT_EQ(capturedMatch.getVisitor().id, "team-1-id");
-    EXPECT_EQ(capturedMatch.getVisitor().name, "Team 1");
-    EXPECT_EQ(capturedMatch.MatchScore().value().homeTeamScore, score.homeTeamScore);
-    EXPECT_EQ(capturedMatch.MatchScore().value().visitorTeamScore, score.visitorTeamScore);
     EXPECT_EQ(messageJson["tournamentId"], tournamentId);
     EXPECT_EQ(messageJson["matchId"], matchId);
+    EXPECT_EQ(messageJson["round"], static_cast<int>(domain::RoundType::CHAMPIONSHIP));
     EXPECT_EQ(messageJson["homeTeamId"], "team-0-id");
     EXPECT_EQ(messageJson["visitorTeamId"], "team-1-id");
     EXPECT_EQ(messageJson["homeScore"], score.homeTeamScore);
     EXPECT_EQ(messageJson["visitorScore"], score.visitorTeamScore);
+    EXPECT_EQ(messageJson["winnerNextMatchId"], "match-id-1");
     EXPECT_EQ(capturedQueue, "match.score-updated");
     EXPECT_TRUE(response.has_value());
 }
 
 TEST_F(MatchDelegateTest, UpdateMatchScoreInvalidScoreTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedMatchIdRead;
-    nlohmann::json matchData = {
-        {"id", "match-id-0"},
-        {"round", "regular"},
-        {"tournamentId", "tournament-id"},
-        {"home", {
-            {"id", "team-0-id"},
-            {"name", "Team 0"}
-        }},
-        {"visitor", {
-            {"id", "team-1-id"},
-            {"name", "Team 1"}
-        }}
-    };
-    auto match = std::make_shared<domain::Match>(matchData);
-
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(match))
-            )
-        );
-
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .Times(0);
+    // Un score inválido en todas las rondas no llega a la base
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(0);
 
     EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
         .Times(0);
@@ -821,29 +608,16 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreInvalidScoreTest) {
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id-0";
     domain::Score score{6, 11};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
     testing::Mock::VerifyAndClearExpectations(&producerMock2);
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Invalid score for this tournament format and round");
 }
 
 TEST_F(MatchDelegateTest, UpdateMatchScoreInvalidTieTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedMatchIdRead;
     nlohmann::json matchData = {
         {"id", "match-id-0"},
         {"round", "championship"},
@@ -859,45 +633,32 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreInvalidTieTest) {
     };
     auto match = std::make_shared<domain::Match>(matchData);
 
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
+    // El empate solo vale en temporada regular; el UPDATE no escribe en un playoff
+    std::vector<domain::RoundType> capturedRounds;
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(match))
+                testing::SaveArg<3>(&capturedRounds),
+                ReturnReady(UpdateResult(ScoreUpdate{match, false}))
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .Times(0);
-
     EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
         .Times(0);
 
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id-0";
     domain::Score score{6, 6};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
     testing::Mock::VerifyAndClearExpectations(&producerMock2);
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
+    EXPECT_EQ(capturedRounds, std::vector<domain::RoundType>{domain::RoundType::REGULAR});
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Invalid score for this tournament format and round");
 }
 
 TEST_F(MatchDelegateTest, UpdateMatchScoreFinalizedTournamentTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedMatchIdRead;
     nlohmann::json matchData = {
         {"id", "match-id-0"},
         {"round", "super bowl"},
@@ -909,26 +670,16 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreFinalizedTournamentTest) {
         {"visitor", {
             {"id", "team-1-id"},
             {"name", "Team 1"}
+        }},
+        {"score", {
+            {"home", 6},
+            {"visitor", 7}
         }}
     };
     auto match = std::make_shared<domain::Match>(matchData);
 
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(match))
-            )
-        );
-
-    std::string capturedMatchIdUpdate;
-    domain::Match capturedMatch;
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdUpdate),
-                testing::SaveArg<1>(&capturedMatch),
-                testing::Return(std::expected<std::string, std::string>("match-id-0"))
-            )
-        );
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(UpdateResult(ScoreUpdate{match, true})));
 
     std::string capturedMessage;
     std::string capturedQueue;
@@ -939,69 +690,78 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreFinalizedTournamentTest) {
             )
         );
 
-    std::string capturedTournamentIdTournamentRepo2;
-    domain::Tournament capturedTournament;
-    EXPECT_CALL(*tournamentRepositoryMock3, Update(::testing::_, ::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo2),
-                testing::SaveArg<1>(&capturedTournament),
-                testing::Return(std::expected<std::string, std::string>("tournament-id"))
-            )
-        );
+    // Los demás nodos sacan el torneo (ya terminado) de sus cachés
+    EXPECT_CALL(*producerMock2, Publish("tournament-id", "tournament.updated"))
+        .Times(1);
 
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id-0";
     domain::Score score{6, 7};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
     testing::Mock::VerifyAndClearExpectations(&producerMock2);
 
     nlohmann::json messageJson = nlohmann::json::parse(capturedMessage);
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
-    EXPECT_EQ(capturedMatchIdUpdate, matchId);
-    EXPECT_EQ(capturedMatch.Id(), "match-id-0");
-    EXPECT_EQ(capturedMatch.Round(), domain::RoundType::SUPERBOWL);
-    EXPECT_EQ(capturedMatch.TournamentId(), "tournament-id");
-    EXPECT_EQ(capturedMatch.getHome().id, "team-0-id");
-    EXPECT_EQ(capturedMatch.getHome().name, "Team 0");
-    EXPECT_EQ(capturedMatch.getVisitor().id, "team-1-id");
-    EXPECT_EQ(capturedMatch.getVisitor().name, "Team 1");
-    EXPECT_EQ(capturedMatch.MatchScore().value().homeTeamScore, score.homeTeamScore);
-    EXPECT_EQ(capturedMatch.MatchScore().value().visitorTeamScore, score.visitorTeamScore);
     EXPECT_EQ(messageJson["tournamentId"], tournamentId);
     EXPECT_EQ(messageJson["matchId"], matchId);
-    EXPECT_EQ(messageJson["homeTeamId"], "team-0-id");
-    EXPECT_EQ(messageJson["visitorTeamId"], "team-1-id");
+    EXPECT_EQ(messageJson["round"], static_cast<int>(domain::RoundType::SUPERBOWL));
     EXPECT_EQ(messageJson["homeScore"], score.homeTeamScore);
     EXPECT_EQ(messageJson["visitorScore"], score.visitorTeamScore);
     EXPECT_EQ(capturedQueue, "match.score-updated");
-    EXPECT_EQ(capturedTournamentIdTournamentRepo2, tournamentId);
-    EXPECT_EQ(capturedTournament.Id(), tournament->Id());
-    EXPECT_EQ(capturedTournament.Name(), tournament->Name());
-    EXPECT_EQ(capturedTournament.Year(), tournament->Year());
-    EXPECT_EQ(capturedTournament.Finished(), tournament->Finished());
-    EXPECT_EQ(capturedTournament.Finished(), "yes");
     EXPECT_TRUE(response.has_value());
 }
 
 TEST_F(MatchDelegateTest, UpdateMatchScoreFinalizedTournamentFailTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
+    // Marcador y cierre del torneo van en el mismo statement: si falla no se publica nada
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(UpdateResult(std::unexpected(std::string("Database connection failed")))));
+
+    EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
+        .Times(0);
+
+    std::string tournamentId = "tournament-id";
+    std::string matchId = "match-id-0";
+    domain::Score score{6, 7};
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
+
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&producerMock2);
+
+    EXPECT_FALSE(response.has_value());
+    EXPECT_EQ(response.error(), "Database connection failed");
+}
+
+TEST_F(MatchDelegateTest, UpdateMatchScoreFailTest) {
+    std::string capturedMatchId;
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
+                testing::SaveArg<1>(&capturedMatchId),
+                ReturnReady(UpdateResult(std::unexpected(std::string("SQL error: syntax error"))))
             )
         );
 
-    std::string capturedMatchIdRead;
+    EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
+        .Times(0);
+
+    std::string tournamentId = "tournament-id";
+    std::string matchId = "match-id-0";
+    domain::Score score{6, 7};
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
+
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&producerMock2);
+
+    EXPECT_EQ(capturedMatchId, matchId);
+    EXPECT_FALSE(response.has_value());
+    EXPECT_EQ(response.error(), "SQL error: syntax error");
+}
+
+TEST_F(MatchDelegateTest, UpdateMatchScoreVersionConflictRetryTest) {
     nlohmann::json matchData = {
         {"id", "match-id-0"},
-        {"round", "super bowl"},
+        {"round", "regular"},
         {"tournamentId", "tournament-id"},
         {"home", {
             {"id", "team-0-id"},
@@ -1012,95 +772,26 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreFinalizedTournamentFailTest) {
             {"name", "Team 1"}
         }}
     };
-    auto match = std::make_shared<domain::Match>(matchData);
+    auto unchangedMatch = std::make_shared<domain::Match>(matchData);
+    auto scoredMatch = std::make_shared<domain::Match>(matchData);
+    scoredMatch->MatchScore() = domain::Score{6, 7};
 
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(match))
-            )
-        );
+    // Otro escritor cambió el match durante el primer UPDATE: no escribió aunque todas
+    // las reglas se cumplen, así que se reintenta
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore("tournament-id", "match-id-0", ::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(UpdateResult(ScoreUpdate{unchangedMatch, false})))
+        .WillOnce(ReturnReady(UpdateResult(ScoreUpdate{scoredMatch, true})));
 
-    std::string capturedMatchIdUpdate;
-    domain::Match capturedMatch;
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdUpdate),
-                testing::SaveArg<1>(&capturedMatch),
-                testing::Return(std::expected<std::string, std::string>("match-id-0"))
-            )
-        );
+    EXPECT_CALL(*producerMock2, SendMessage(::testing::_, "match.score-updated"))
+        .Times(1);
 
-    std::string capturedMessage;
-    std::string capturedQueue;
-    EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMessage),
-                testing::SaveArg<1>(&capturedQueue)
-            )
-        );
-
-    std::string capturedTournamentIdTournamentRepo2;
-    domain::Tournament capturedTournament;
-    EXPECT_CALL(*tournamentRepositoryMock3, Update(::testing::_, ::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo2),
-                testing::SaveArg<1>(&capturedTournament),
-                testing::Return(std::unexpected<std::string>("Database connection failed"))
-            )
-        );
-
-    std::string tournamentId = "tournament-id";
-    std::string matchId = "match-id-0";
     domain::Score score{6, 7};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
-
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
-    testing::Mock::VerifyAndClearExpectations(&producerMock2);
-
-    nlohmann::json messageJson = nlohmann::json::parse(capturedMessage);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync("tournament-id", "match-id-0", score));
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
-    EXPECT_EQ(capturedMatchIdUpdate, matchId);
-    EXPECT_EQ(capturedMatch.Id(), "match-id-0");
-    EXPECT_EQ(capturedMatch.Round(), domain::RoundType::SUPERBOWL);
-    EXPECT_EQ(capturedMatch.TournamentId(), "tournament-id");
-    EXPECT_EQ(capturedMatch.getHome().id, "team-0-id");
-    EXPECT_EQ(capturedMatch.getHome().name, "Team 0");
-    EXPECT_EQ(capturedMatch.getVisitor().id, "team-1-id");
-    EXPECT_EQ(capturedMatch.getVisitor().name, "Team 1");
-    EXPECT_EQ(capturedMatch.MatchScore().value().homeTeamScore, score.homeTeamScore);
-    EXPECT_EQ(capturedMatch.MatchScore().value().visitorTeamScore, score.visitorTeamScore);
-    EXPECT_EQ(messageJson["tournamentId"], tournamentId);
-    EXPECT_EQ(messageJson["matchId"], matchId);
-    EXPECT_EQ(messageJson["homeTeamId"], "team-0-id");
-    EXPECT_EQ(messageJson["visitorTeamId"], "team-1-id");
-    EXPECT_EQ(messageJson["homeScore"], score.homeTeamScore);
-    EXPECT_EQ(messageJson["visitorScore"], score.visitorTeamScore);
-    EXPECT_EQ(capturedQueue, "match.score-updated");
-    EXPECT_EQ(capturedTournamentIdTournamentRepo2, tournamentId);
-    EXPECT_EQ(capturedTournament.Id(), tournament->Id());
-    EXPECT_EQ(capturedTournament.Name(), tournament->Name());
-    EXPECT_EQ(capturedTournament.Year(), tournament->Year());
-    EXPECT_EQ(capturedTournament.Finished(), tournament->Finished());
-    EXPECT_EQ(capturedTournament.Finished(), "yes");
-    EXPECT_FALSE(response.has_value());
-    EXPECT_EQ(response.error(), "Database connection failed");
+    EXPECT_TRUE(response.has_value());
 }
 
-TEST_F(MatchDelegateTest, UpdateMatchScoreFailTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedMatchIdRead;
+TEST_F(MatchDelegateTest, UpdateMatchScoreVersionConflictExhaustedTest) {
     nlohmann::json matchData = {
         {"id", "match-id-0"},
         {"round", "regular"},
@@ -1114,67 +805,24 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreFailTest) {
             {"name", "Team 1"}
         }}
     };
-    auto match = std::make_shared<domain::Match>(matchData);
 
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(match))
-            )
-        );
-
-    std::string capturedMatchIdUpdate;
-    domain::Match capturedMatch;
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdUpdate),
-                testing::SaveArg<1>(&capturedMatch),
-                testing::Return(std::unexpected<std::string>("Database connection failed"))
-            )
-        );
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(MATCH_UPDATE_ATTEMPTS)
+        .WillRepeatedly(testing::Invoke([&matchData](std::string, std::string, domain::Score, std::vector<domain::RoundType>) {
+            return Ready(UpdateResult(ScoreUpdate{std::make_shared<domain::Match>(matchData), false}));
+        }));
 
     EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*tournamentRepositoryMock3, Update(::testing::_, ::testing::_))
-        .Times(0);
-
-    std::string tournamentId = "tournament-id";
-    std::string matchId = "match-id-0";
     domain::Score score{6, 7};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync("tournament-id", "match-id-0", score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
-    testing::Mock::VerifyAndClearExpectations(&producerMock2);
-
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
-    EXPECT_EQ(capturedMatchIdUpdate, matchId);
-    EXPECT_EQ(capturedMatch.Id(), "match-id-0");
-    EXPECT_EQ(capturedMatch.Round(), domain::RoundType::REGULAR);
-    EXPECT_EQ(capturedMatch.TournamentId(), "tournament-id");
-    EXPECT_EQ(capturedMatch.getHome().id, "team-0-id");
-    EXPECT_EQ(capturedMatch.getHome().name, "Team 0");
-    EXPECT_EQ(capturedMatch.getVisitor().id, "team-1-id");
-    EXPECT_EQ(capturedMatch.getVisitor().name, "Team 1");
-    EXPECT_EQ(capturedMatch.MatchScore().value().homeTeamScore, score.homeTeamScore);
-    EXPECT_EQ(capturedMatch.MatchScore().value().visitorTeamScore, score.visitorTeamScore);
     EXPECT_FALSE(response.has_value());
-    EXPECT_EQ(response.error(), "Database connection failed");
+    EXPECT_EQ(response.error(), MATCH_VERSION_CONFLICT);
 }
 
 TEST_F(MatchDelegateTest, UpdateMatchScoreAlreadyPlayedPlayoffTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedMatchIdRead;
     nlohmann::json matchData = {
         {"id", "match-id-0"},
         {"round", "divisional"},
@@ -1194,48 +842,25 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreAlreadyPlayedPlayoffTest) {
     };
     auto match = std::make_shared<domain::Match>(matchData);
 
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(match))
-            )
-        );
-
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .Times(0);
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(UpdateResult(ScoreUpdate{match, false})));
 
     EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*tournamentRepositoryMock3, Update(::testing::_, ::testing::_))
-        .Times(0);
-
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id-0";
     domain::Score score{6, 7};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
     testing::Mock::VerifyAndClearExpectations(&producerMock2);
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Cannot modify an already played playoff game");
 }
 
 TEST_F(MatchDelegateTest, UpdateMatchScoreMissingTeamTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedMatchIdRead;
     nlohmann::json matchData = {
         {"id", "match-id-0"},
         {"round", "regular"},
@@ -1251,48 +876,25 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreMissingTeamTest) {
     };
     auto match = std::make_shared<domain::Match>(matchData);
 
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(match))
-            )
-        );
-
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .Times(0);
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(UpdateResult(ScoreUpdate{match, false})));
 
     EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*tournamentRepositoryMock3, Update(::testing::_, ::testing::_))
-        .Times(0);
-
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id-0";
     domain::Score score{6, 7};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
     testing::Mock::VerifyAndClearExpectations(&producerMock2);
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Match teams are not ready");
 }
 
 TEST_F(MatchDelegateTest, UpdateMatchScoreForeignMatchTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedMatchIdRead;
     nlohmann::json matchData = {
         {"id", "match-id-0"},
         {"round", "regular"},
@@ -1308,109 +910,98 @@ TEST_F(MatchDelegateTest, UpdateMatchScoreForeignMatchTest) {
     };
     auto match = std::make_shared<domain::Match>(matchData);
 
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::expected<std::shared_ptr<domain::Match>, std::string>(match))
-            )
-        );
-
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .Times(0);
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(UpdateResult(ScoreUpdate{match, false})));
 
     EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*tournamentRepositoryMock3, Update(::testing::_, ::testing::_))
-        .Times(0);
-
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id-0";
     domain::Score score{6, 7};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
     testing::Mock::VerifyAndClearExpectations(&producerMock2);
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Match does not belong to the specified tournament");
 }
 
-TEST_F(MatchDelegateTest, UpdateMatchScoreMatchSelectionFailTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
-    tournament->Id() = "tournament-id";
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::expected<std::shared_ptr<domain::Tournament>, std::string>(tournament))
-            )
-        );
-
-    std::string capturedMatchIdRead;
-
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedMatchIdRead),
-                testing::Return(std::unexpected<std::string>("Selection failed"))
-            )
-        );
-
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .Times(0);
+TEST_F(MatchDelegateTest, UpdateMatchScoreMatchNotFoundTest) {
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(UpdateResult(std::unexpected(std::string("Match not found")))));
 
     EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*tournamentRepositoryMock3, Update(::testing::_, ::testing::_))
-        .Times(0);
-
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id-0";
     domain::Score score{6, 7};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
     testing::Mock::VerifyAndClearExpectations(&producerMock2);
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
-    EXPECT_EQ(capturedMatchIdRead, matchId);
     EXPECT_FALSE(response.has_value());
-    EXPECT_EQ(response.error(), "Selection failed");
+    EXPECT_EQ(response.error(), "Match not found");
 }
 
 TEST_F(MatchDelegateTest, UpdateMatchScoreTournamentNotFoundTest) {
-    std::string capturedTournamentIdTournamentRepo;
-    EXPECT_CALL(*tournamentRepositoryMock3, ReadById(::testing::_))
+    std::string capturedTournamentId;
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
-                testing::SaveArg<0>(&capturedTournamentIdTournamentRepo),
-                testing::Return(std::unexpected<std::string>("Tournament not found"))
+                testing::SaveArg<0>(&capturedTournamentId),
+                ReturnReady(UpdateResult(std::unexpected(std::string("Tournament not found"))))
             )
         );
 
-    EXPECT_CALL(*matchRepositoryMock, ReadById(::testing::_))
-        .Times(0);
-
-    EXPECT_CALL(*matchRepositoryMock, Update(::testing::_, ::testing::_))
-        .Times(0);
-
     EXPECT_CALL(*producerMock2, SendMessage(::testing::_, ::testing::_))
         .Times(0);
 
-    EXPECT_CALL(*tournamentRepositoryMock3, Update(::testing::_, ::testing::_))
-        .Times(0);
-
     std::string tournamentId = "tournament-id";
     std::string matchId = "match-id-0";
     domain::Score score{6, 7};
-    auto response = matchDelegate->UpdateMatchScore(tournamentId, matchId, score);
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync(tournamentId, matchId, score));
 
-    testing::Mock::VerifyAndClearExpectations(&matchRepositoryMock);
+    testing::Mock::VerifyAndClearExpectations(&asyncMatchRepositoryMock);
     testing::Mock::VerifyAndClearExpectations(&producerMock2);
 
-    EXPECT_EQ(capturedTournamentIdTournamentRepo, tournamentId);
+    EXPECT_EQ(capturedTournamentId, tournamentId);
     EXPECT_FALSE(response.has_value());
     EXPECT_EQ(response.error(), "Tournament not found");
-}
\ No newline at end of file
+}
+
+TEST_F(MatchDelegateTest, UpdateMatchScorePublishesOffCallerThreadTest) {
+    nlohmann::json matchData = {
+        {"id", "match-id-0"},
+        {"round", "regular"},
+        {"tournamentId", "tournament-id"},
+        {"home", {
+            {"id", "team-0-id"},
+            {"name", "Team 0"}
+        }},
+        {"visitor", {
+            {"id", "team-1-id"},
+            {"name", "Team 1"}
+        }}
+    };
+    auto match = std::make_shared<domain::Match>(matchData);
+
+    EXPECT_CALL(*asyncMatchRepositoryMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(ReturnReady(UpdateResult(ScoreUpdate{match, true})));
+
+    // El envío al broker no ocupa el hilo del io_context
+    std::thread::id publishThread;
+    EXPECT_CALL(*producerMock2, SendMessage(::testing::_, "match.score-updated"))
+        .WillOnce(testing::Invoke([&publishThread](const std::string_view&, const std::string_view&) {
+            publishThread = std::this_thread::get_id();
+        }));
+
+    domain::Score score{6, 7};
+    auto response = Run(matchDelegate->UpdateMatchScoreAsync("tournament-id", "match-id-0", score));
+
+    EXPECT_TRUE(response.has_value());
+    EXPECT_NE(publishThread, std::thread::id());
+    EXPECT_NE(publishThread, std::this_thread::get_id());
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "delegate/StandingsDelegate.hpp"
+
+class StandingsTournamentRepositoryMock : public IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>> {
+public:
+    MOCK_METHOD((std::expected<std::string, std::string>), Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>), ReadAll, (), (override));
+    MOCK_METHOD((std::expected<std::shared_ptr<domain::Tournament>, std::string>), ReadById, (std::string id), (override));
+    MOCK_METHOD((std::expected<std::string, std::string>), Update, (std::string id, const domain::Tournament& entity), (override));
+    MOCK_METHOD((std::expected<void, std::string>), Delete, (std::string id), (override));
+};
+
+class StandingsRepositoryMock : public StandingsRepository {
+public:
+    StandingsRepositoryMock() : StandingsRepository(nullptr) {}
+
+    MOCK_METHOD((std::expected<std::vector<domain::Standing>, std::string>), FindByTournamentId, (const std::string_view& tournamentId), (override));
+};
+
+class StandingsDelegateTest : public ::testing::Test{
+protected:
+    std::shared_ptr<StandingsTournamentRepositoryMock> tournamentRepositoryMock;
+    std::shared_ptr<StandingsRepositoryMock> standingsRepositoryMock;
+    std::shared_ptr<StandingsDelegate> standingsDelegate;
+
+    void SetUp() override {
+        tournamentRepositoryMock = std::make_shared<StandingsTournamentRepositoryMock>();
+        standingsRepositoryMock = std::make_shared<StandingsRepositoryMock>();
+        standingsDelegate = std::make_shared<StandingsDelegate>(tournamentRepositoryMock, standingsRepositoryMock);
+    }
+};
+
+TEST_F(StandingsDelegateTest, GetStandingsTest) {
+    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
+    EXPECT_CALL(*tournamentRepositoryMock, ReadById("tournament-id"))
+        .WillOnce(testing::Return(tournament));
+
+    std::vector<domain::Standing> standings = {{"team-1", "Team 1", "group-1", "North", "AFC", 1, 0, 0, 21, 14}};
+    std::string capturedTournamentId;
+    EXPECT_CALL(*standingsRepositoryMock, FindByTournamentId(::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<0>(&capturedTournamentId),
+            testing::Return(standings)
+        ));
+
+    auto result = standingsDelegate->GetStandings("tournament-id");
+
+    EXPECT_EQ(capturedTournamentId, "tournament-id");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 1);
+    EXPECT_EQ((*result)[0].teamId, "team-1");
+    EXPECT_EQ((*result)[0].wins, 1);
+}
+
+TEST_F(StandingsDelegateTest, GetStandingsTournamentNotFoundTest) {
+    EXPECT_CALL(*tournamentRepositoryMock, ReadById(::testing::_))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Tournament not found")));
+    EXPECT_CALL(*standingsRepositoryMock, FindByTournamentId(::testing::_))
+        .Times(0);
+
+    auto result = standingsDelegate->GetStandings("tournament-id");
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), "Tournament not found");
+}
+
+TEST_F(StandingsDelegateTest, GetStandingsReadFailTest) {
+    auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
+    EXPECT_CALL(*tournamentRepositoryMock, ReadById(::testing::_))
+        .WillOnce(testing::Return(tournament));
+    EXPECT_CALL(*standingsRepositoryMock, FindByTournamentId(::testing::_))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Database connection failed")));
+
+    auto result = standingsDelegate->GetStandings("tournament-id");
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), "Database connection failed");
+}
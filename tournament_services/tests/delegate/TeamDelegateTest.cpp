@@ -9,14 +9,17 @@
 #include <expected>
 
 #include "domain/Team.hpp"
+#include "persistence/repository/IPagedRepository.hpp"
 #include "persistence/repository/IRepository.hpp"
 #include "delegate/TeamDelegate.hpp"
 
 // Mock del repositorio
-class TeamRepositoryMock : public IRepository<domain::Team, std::string, std::expected<std::string, std::string>> {
+class TeamRepositoryMock : public IRepository<domain::Team, std::string, std::expected<std::string, std::string>>,
+                           public IPagedRepository<domain::Team, std::string> {
 public:
     MOCK_METHOD((std::expected<std::string, std::string>), Create, (const domain::Team& entity), (override));
     MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>), ReadAll, (), (override));
+    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>), ReadPage, (const std::optional<std::string>& after, size_t limit), (override));
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Team>, std::string>), ReadById, (std::string id), (override));
     MOCK_METHOD((std::expected<std::string, std::string>), Update, (std::string id, const domain::Team& entity), (override));
     MOCK_METHOD((std::expected<void, std::string>), Delete, (std::string id), (override));
@@ -29,7 +32,7 @@ protected:
 
     void SetUp() override {
         teamRepositoryMock = std::make_shared<TeamRepositoryMock>();
-        teamDelegate = std::make_shared<TeamDelegate>(teamRepositoryMock);
+        teamDelegate = std::make_shared<TeamDelegate>(teamRepositoryMock, teamRepositoryMock);
     }
 
     void TearDown() override {
@@ -141,12 +144,12 @@ TEST_F(TeamDelegateTest, ReadAllTeamsWithResultsTest) {
     expectedTeams.push_back(team1);
     expectedTeams.push_back(team2);
 
-    EXPECT_CALL(*teamRepositoryMock, ReadAll())
+    EXPECT_CALL(*teamRepositoryMock, ReadPage(std::optional<std::string>{}, 100))
         .WillOnce(::testing::Return(
             std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>(expectedTeams)
         ));
 
-    auto result = teamDelegate->ReadAll();
+    auto result = teamDelegate->ReadPage(std::nullopt, 100);
 
     ::testing::Mock::VerifyAndClearExpectations(&teamRepositoryMock);
 
@@ -162,12 +165,12 @@ TEST_F(TeamDelegateTest, ReadAllTeamsWithResultsTest) {
 TEST_F(TeamDelegateTest, ReadAllTeamsEmptyListTest) {
     std::vector<std::shared_ptr<domain::Team>> emptyList;
 
-    EXPECT_CALL(*teamRepositoryMock, ReadAll())
+    EXPECT_CALL(*teamRepositoryMock, ReadPage(std::optional<std::string>{}, 100))
         .WillOnce(::testing::Return(
             std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>(emptyList)
         ));
 
-    auto result = teamDelegate->ReadAll();
+    auto result = teamDelegate->ReadPage(std::nullopt, 100);
 
     ::testing::Mock::VerifyAndClearExpectations(&teamRepositoryMock);
 
@@ -332,12 +335,12 @@ TEST_F(TeamDelegateTest, ReadAllTeamsMultipleResultsTest) {
         expectedTeams.push_back(team);
     }
 
-    EXPECT_CALL(*teamRepositoryMock, ReadAll())
+    EXPECT_CALL(*teamRepositoryMock, ReadPage(std::optional<std::string>{}, 100))
         .WillOnce(::testing::Return(
             std::expected<std::vector<std::shared_ptr<domain::Team>>, std::string>(expectedTeams)
         ));
 
-    auto result = teamDelegate->ReadAll();
+    auto result = teamDelegate->ReadPage(std::nullopt, 100);
 
     ::testing::Mock::VerifyAndClearExpectations(&teamRepositoryMock);
 
@@ -349,12 +352,12 @@ TEST_F(TeamDelegateTest, ReadAllTeamsMultipleResultsTest) {
 
 // Test 15: Búsqueda de todos - error de timeout en base de datos
 TEST_F(TeamDelegateTest, ReadAllTeamsDatabaseTimeoutTest) {
-    EXPECT_CALL(*teamRepositoryMock, ReadAll())
+    EXPECT_CALL(*teamRepositoryMock, ReadPage(std::optional<std::string>{}, 100))
         .WillOnce(::testing::Return(
             std::unexpected<std::string>("Database error: connection timeout")
         ));
 
-    auto result = teamDelegate->ReadAll();
+    auto result = teamDelegate->ReadPage(std::nullopt, 100);
 
     ::testing::Mock::VerifyAndClearExpectations(&teamRepositoryMock);
 
@@ -364,12 +367,12 @@ TEST_F(TeamDelegateTest, ReadAllTeamsDatabaseTimeoutTest) {
 
 // Test 16: Búsqueda de todos - error SQL (tabla no existe)
 TEST_F(TeamDelegateTest, ReadAllTeamsSQLTableNotExistsTest) {
-    EXPECT_CALL(*teamRepositoryMock, ReadAll())
+    EXPECT_CALL(*teamRepositoryMock, ReadPage(std::optional<std::string>{}, 100))
         .WillOnce(::testing::Return(
             std::unexpected<std::string>("SQL error: table 'teams' does not exist")
         ));
 
-    auto result = teamDelegate->ReadAll();
+    auto result = teamDelegate->ReadPage(std::nullopt, 100);
 
     ::testing::Mock::VerifyAndClearExpectations(&teamRepositoryMock);
 
@@ -379,12 +382,12 @@ TEST_F(TeamDelegateTest, ReadAllTeamsSQLTableNotExistsTest) {
 
 // Test 17: Búsqueda de todos - error de permisos
 TEST_F(TeamDelegateTest, ReadAllTeamsPermissionDeniedTest) {
-    EXPECT_CALL(*teamRepositoryMock, ReadAll())
+    EXPECT_CALL(*teamRepositoryMock, ReadPage(std::optional<std::string>{}, 100))
         .WillOnce(::testing::Return(
             std::unexpected<std::string>("Database error: permission denied")
         ));
 
-    auto result = teamDelegate->ReadAll();
+    auto result = teamDelegate->ReadPage(std::nullopt, 100);
 
     ::testing::Mock::VerifyAndClearExpectations(&teamRepositoryMock);
 
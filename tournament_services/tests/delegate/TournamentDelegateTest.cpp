@@ -14,6 +14,7 @@ public:
 
     MOCK_METHOD((std::expected<std::string, std::string>), Create, (const domain::Tournament& entity), (override));
     MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>), ReadAll, (), (override));
+    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>), ReadPage, (const std::optional<std::string>& after, size_t limit), (override));
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Tournament>, std::string>), ReadById, (const std::string id), (override));
     MOCK_METHOD((std::expected<std::string, std::string>), Update, (const std::string id, const domain::Tournament& entity), (override));
     MOCK_METHOD((std::expected<void, std::string>), Delete, (const std::string id), (override));
@@ -24,6 +25,7 @@ public:
     QueueMessageProducerMock(): QueueMessageProducer(nullptr) {}
 
     MOCK_METHOD(void, SendMessage, (const std::string_view& message, const std::string_view& queue), (override));
+    MOCK_METHOD(void, Publish, (const std::string_view& message, const std::string_view& topic), (override));
 };
 
 class TournamentDelegateTest : public ::testing::Test{
@@ -35,7 +37,7 @@ protected:
     void SetUp() override {
         tournamentRepositoryMock = std::make_shared<TournamentRepositoryMock>();
         producerMock = std::make_shared<QueueMessageProducerMock>();
-        tournamentDelegate = std::make_shared<TournamentDelegate>(TournamentDelegate(tournamentRepositoryMock, producerMock));
+        tournamentDelegate = std::make_shared<TournamentDelegate>(TournamentDelegate(tournamentRepositoryMock, tournamentRepositoryMock, producerMock));
     }
 
     // TearDown() function
@@ -55,7 +57,7 @@ TEST_F(TournamentDelegateTest, CreateTournamentSucessTest) {
             )
         );
 
-    EXPECT_CALL(*producerMock, SendMessage("new-id", "tournament.created"))
+    EXPECT_CALL(*producerMock, Publish("new-id", "tournament.created"))
         .Times(1);
 
     nlohmann::json body = {{"id", "new-id"}, {"name", "new tournament"}, {"year", 2025}, {"finished", "no"}};
@@ -81,7 +83,7 @@ TEST_F(TournamentDelegateTest, CreateTournamentFailureTest) {
             )
         );
 
-    EXPECT_CALL(*producerMock, SendMessage(::testing::_, ::testing::_))
+    EXPECT_CALL(*producerMock, Publish(::testing::_, ::testing::_))
         .Times(0);
 
     nlohmann::json body = {{"id", "new-id"}, {"name", "new tournament"}, {"year", 2025}, {"finished", "no"}};
@@ -141,10 +143,10 @@ TEST_F(TournamentDelegateTest, ReadAllTournamentsSuccessTest) {
     tournamentsList.push_back(std::make_shared<domain::Tournament>(tournament1Data));
     tournamentsList.push_back(std::make_shared<domain::Tournament>(tournament2Data));
 
-    EXPECT_CALL(*tournamentRepositoryMock, ReadAll())
+    EXPECT_CALL(*tournamentRepositoryMock, ReadPage(std::optional<std::string>{}, 100))
         .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>(tournamentsList)));
 
-    auto response = tournamentDelegate->ReadAll();
+    auto response = tournamentDelegate->ReadPage(std::nullopt, 100);
 
     testing::Mock::VerifyAndClearExpectations(&tournamentRepositoryMock);
 
@@ -159,10 +161,10 @@ TEST_F(TournamentDelegateTest, ReadAllTournamentsSuccessTest) {
 TEST_F(TournamentDelegateTest, ReadAllTournamentsEmptyListTest) {
     std::vector<std::shared_ptr<domain::Tournament>> emptyList;
 
-    EXPECT_CALL(*tournamentRepositoryMock, ReadAll())
+    EXPECT_CALL(*tournamentRepositoryMock, ReadPage(std::optional<std::string>{}, 100))
         .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>(emptyList)));
 
-    auto response = tournamentDelegate->ReadAll();
+    auto response = tournamentDelegate->ReadPage(std::nullopt, 100);
 
     testing::Mock::VerifyAndClearExpectations(&tournamentRepositoryMock);
 
@@ -182,7 +184,7 @@ TEST_F(TournamentDelegateTest, UpdateTournamentSuccessTest) {
             )
         );
 
-    EXPECT_CALL(*producerMock, SendMessage(tournamentId, "tournament.updated"))
+    EXPECT_CALL(*producerMock, Publish(tournamentId, "tournament.updated"))
         .Times(1);
 
     nlohmann::json updatedData = {{"id", tournamentId}, {"name", "Updated Tournament"}, {"year", 2026}, {"finished", "no"}};
@@ -206,7 +208,7 @@ TEST_F(TournamentDelegateTest, UpdateTournamentNotFoundTest) {
     EXPECT_CALL(*tournamentRepositoryMock, Update(tournamentId, ::testing::_))
         .WillOnce(testing::Return(std::unexpected<std::string>("Tournament not found for update")));
 
-    EXPECT_CALL(*producerMock, SendMessage(::testing::_, ::testing::_))
+    EXPECT_CALL(*producerMock, Publish(::testing::_, ::testing::_))
         .Times(0);
 
     nlohmann::json updatedData = {{"id", tournamentId}, {"name", "Updated Tournament"}, {"year", 2026}, {"finished", "no"}};
@@ -226,7 +228,7 @@ TEST_F(TournamentDelegateTest, DeleteTournamentSuccessTest) {
     EXPECT_CALL(*tournamentRepositoryMock, Delete(tournamentId))
         .WillOnce(testing::Return(std::expected<void, std::string>()));
 
-    EXPECT_CALL(*producerMock, SendMessage(tournamentId, "tournament.deleted"))
+    EXPECT_CALL(*producerMock, Publish(tournamentId, "tournament.deleted"))
         .Times(1);
 
     auto response = tournamentDelegate->DeleteTournament(tournamentId);
@@ -243,7 +245,7 @@ TEST_F(TournamentDelegateTest, DeleteTournamentNotFoundTest) {
     EXPECT_CALL(*tournamentRepositoryMock, Delete(tournamentId))
         .WillOnce(testing::Return(std::unexpected<std::string>("Tournament not found for deletion")));
 
-    EXPECT_CALL(*producerMock, SendMessage(::testing::_, ::testing::_))
+    EXPECT_CALL(*producerMock, Publish(::testing::_, ::testing::_))
         .Times(0);
 
     auto response = tournamentDelegate->DeleteTournament(tournamentId);
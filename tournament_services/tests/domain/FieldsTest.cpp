@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "domain/Fields.hpp"
+#include "domain/Utilities.hpp"
+
+TEST(FieldsTest, MatchRoundTripTest) {
+    domain::Match match("tournament-id", domain::Home{"home-id", "Home"}, domain::Visitor{"visitor-id", "Visitor"},
+                        domain::RoundType::DIVISIONAL);
+    match.Id() = "match-id";
+    match.MatchScore() = domain::Score{21, 14};
+    match.WinnerNextMatchId() = "next-id";
+
+    const nlohmann::json json = match;
+    EXPECT_EQ(json["round"], "divisional");
+    EXPECT_EQ(json["score"]["home"], 21);
+
+    const auto decoded = json.get<domain::Match>();
+    EXPECT_EQ(decoded.Id(), "match-id");
+    EXPECT_EQ(decoded.TournamentId(), "tournament-id");
+    EXPECT_EQ(decoded.getVisitor().name, "Visitor");
+    EXPECT_EQ(decoded.Round(), domain::RoundType::DIVISIONAL);
+    ASSERT_TRUE(decoded.MatchScore().has_value());
+    EXPECT_EQ(decoded.MatchScore()->visitorTeamScore, 14);
+    EXPECT_EQ(decoded.WinnerNextMatchId(), "next-id");
+}
+
+// El documento guardado lleva la ronda como entero y no lleva el id (vive en su columna)
+TEST(FieldsTest, MatchDocumentTest) {
+    domain::Match match("tournament-id", domain::Home{"home-id", "Home"}, domain::Visitor{"visitor-id", "Visitor"},
+                        domain::RoundType::SUPERBOWL);
+    match.Id() = "match-id";
+
+    const auto document = domain::ToDocument(match);
+
+    EXPECT_EQ(document, nlohmann::json::parse(R"({
+        "tournamentId": "tournament-id",
+        "home": {"id": "home-id", "name": "Home"},
+        "visitor": {"id": "visitor-id", "name": "Visitor"},
+        "round": 4
+    })"));
+}
+
+TEST(FieldsTest, OmitsEmptyFieldsTest) {
+    const nlohmann::json team = domain::Team{"", "Team"};
+    EXPECT_FALSE(team.contains("id"));
+
+    const nlohmann::json match = domain::Match{};
+    EXPECT_FALSE(match.contains("id"));
+    EXPECT_FALSE(match.contains("score"));
+    EXPECT_FALSE(match.contains("winnerNextMatchId"));
+    EXPECT_TRUE(match.contains("tournamentId"));
+}
+
+TEST(FieldsTest, RequiredFieldMissingThrowsTest) {
+    const auto body = nlohmann::json::parse(R"({"name": "Group A", "region": "North"})");
+
+    EXPECT_THROW(body.get<domain::Group>(), nlohmann::json::out_of_range);
+}
+
+TEST(FieldsTest, GroupDecodeTest) {
+    const auto body = nlohmann::json::parse(R"({
+        "name": "Group A", "region": "North", "conference": "NFC", "tournamentId": null,
+        "teams": [{"id": "team-1"}, {"name": "Team 2"}]
+    })");
+
+    const auto group = body.get<domain::Group>();
+
+    EXPECT_EQ(group.getConference(), domain::Conference::NFC);
+    EXPECT_TRUE(group.TournamentId().empty());
+    ASSERT_EQ(group.Teams().size(), 2);
+    EXPECT_EQ(group.Teams()[0].Id, "team-1");
+    EXPECT_EQ(group.Teams()[1].Name, "Team 2");
+}
+
+TEST(FieldsTest, TournamentFormatTypeTest) {
+    const auto body = nlohmann::json::parse(R"({
+        "name": "Season", "year": 2026, "finished": "false",
+        "format": {"numberOfGroups": 2, "type": "ROUND_ROBIN"}
+    })");
+
+    const auto tournament = body.get<domain::Tournament>();
+    EXPECT_EQ(tournament.Format().Type(), domain::TournamentType::ROUND_ROBIN);
+    EXPECT_EQ(tournament.Format().NumberOfGroups(), 2);
+    EXPECT_EQ(tournament.Format().MaxTeamsPerGroup(), 4);
+
+    const nlohmann::json json = tournament;
+    EXPECT_EQ(json["format"]["type"], "ROUND_ROBIN");
+    EXPECT_EQ(json["year"], 2026);
+}
+
+TEST(FieldsTest, WriteJsonLikeDumpTest) {
+    domain::Standing standing{"team-id", "Team", "group-id", "North", "AFC", 3, 1, 0, 70, 41};
+    std::string out;
+    domain::JsonWriter writer(out);
+    domain::WriteJson(writer, standing);
+
+    EXPECT_EQ(out, nlohmann::json(standing).dump());
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "domain/JsonWriter.hpp"
+#include "domain/Utilities.hpp"
+
+namespace {
+    std::shared_ptr<domain::Match> CreateMatch(const std::string& id, const std::string& homeName) {
+        auto match = std::make_shared<domain::Match>("tournament-id", domain::Home{"home-id", homeName},
+                                                     domain::Visitor{"visitor-id", "Visitor"});
+        match->Id() = id;
+        return match;
+    }
+}
+
+TEST(JsonWriterTest, CommasAndNestingTest) {
+    std::string out;
+    domain::JsonWriter writer(out);
+    writer.BeginObject()
+        .Key("a").BeginArray().Int(1).Int(-2).BeginObject().EndObject().BeginArray().EndArray().EndArray()
+        .Key("b").Bool(true)
+        .Key("c").BeginObject().Key("d").String("x").EndObject()
+        .EndObject();
+
+    EXPECT_EQ(out, R"({"a":[1,-2,{},[]],"b":true,"c":{"d":"x"}})");
+    EXPECT_NO_THROW(nlohmann::json::parse(out));
+}
+
+TEST(JsonWriterTest, EscapesLikeDumpTest) {
+    const std::string value = std::string("quote\" back\\ tab\t nl\n bell\x07 nul") + '\0' + " ñandú /";
+    std::string out;
+    domain::JsonWriter(out).String(value);
+
+    EXPECT_EQ(out, nlohmann::json(value).dump());
+}
+
+TEST(JsonWriterTest, MatchesLikeDumpTest) {
+    std::vector<std::shared_ptr<domain::Match>> matches;
+    matches.push_back(CreateMatch("match-1", "Home \"One\""));
+    auto played = CreateMatch("match-2", "Home Two");
+    played->MatchScore() = domain::Score{21, 14};
+    played->Round() = domain::RoundType::WILDCARD;
+    played->WinnerNextMatchId() = "match-3";
+    matches.push_back(played);
+    // Sin id: la clave se omite igual que en to_json
+    matches.push_back(CreateMatch("", "Home Three"));
+
+    const nlohmann::json expected = matches;
+
+    EXPECT_EQ(domain::ToJsonString(matches), expected.dump());
+}
+
+TEST(JsonWriterTest, GroupsLikeDumpTest) {
+    std::vector<std::shared_ptr<domain::Group>> groups;
+    auto first = std::make_shared<domain::Group>("North", "Region", "group-1", domain::Conference::NFC);
+    first->TournamentId() = "tournament-id";
+    first->Teams().push_back(domain::Team{"team-1", "Team 1"});
+    first->Teams().push_back(domain::Team{"team-2", "Team\\2"});
+    groups.push_back(first);
+    groups.push_back(std::make_shared<domain::Group>("South", "Region"));
+
+    const nlohmann::json expected = groups;
+
+    EXPECT_EQ(domain::ToJsonString(groups), expected.dump());
+}
+
+TEST(JsonWriterTest, EmptyListTest) {
+    EXPECT_EQ(domain::ToJsonString(std::vector<std::shared_ptr<domain::Match>>{}), "[]");
+}
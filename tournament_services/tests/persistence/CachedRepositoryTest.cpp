@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "domain/Tournament.hpp"
+#include "persistence/repository/CachedRepository.hpp"
+
+class CachedTournamentStoreMock : public IRepository<domain::Tournament, std::string, std::expected<std::string, std::string>> {
+public:
+    MOCK_METHOD((std::expected<std::string, std::string>), Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Tournament>>, std::string>), ReadAll, (), (override));
+    MOCK_METHOD((std::expected<std::shared_ptr<domain::Tournament>, std::string>), ReadById, (std::string id), (override));
+    MOCK_METHOD((std::expected<std::string, std::string>), Update, (std::string id, const domain::Tournament& entity), (override));
+    MOCK_METHOD((std::expected<void, std::string>), Delete, (std::string id), (override));
+};
+
+class CachedRepositoryTest : public ::testing::Test {
+protected:
+    std::shared_ptr<CacheMetrics> metrics;
+    std::shared_ptr<CachedTournamentStoreMock> repositoryMock;
+
+    void SetUp() override {
+        metrics = std::make_shared<CacheMetrics>();
+        repositoryMock = std::make_shared<CachedTournamentStoreMock>();
+    }
+
+    std::shared_ptr<CachedRepository<domain::Tournament>> Cache(size_t capacity, long ttlMs) {
+        config::CacheConfiguration configuration;
+        configuration.capacity = capacity;
+        configuration.shards = 1;
+        configuration.ttlMs = ttlMs;
+        return std::make_shared<CachedRepository<domain::Tournament>>(repositoryMock, "tournament", configuration, metrics);
+    }
+
+    CacheMetrics::Counters& Counters() {
+        return metrics->For("tournament");
+    }
+
+    static std::expected<std::shared_ptr<domain::Tournament>, std::string> TournamentWithId(const std::string& id) {
+        auto tournament = std::make_shared<domain::Tournament>("Test Tournament", 2025);
+        tournament->Id() = id;
+        return tournament;
+    }
+};
+
+TEST_F(CachedRepositoryTest, SecondReadIsServedFromCacheTest) {
+    auto cache = Cache(16, 60000);
+    EXPECT_CALL(*repositoryMock, ReadById("tournament-id"))
+        .WillOnce(testing::Return(TournamentWithId("tournament-id")));
+
+    const auto first = cache->ReadById("tournament-id");
+    const auto second = cache->ReadById("tournament-id");
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ((*second)->Id(), "tournament-id");
+    // Cada lectura recibe su propia copia
+    EXPECT_NE(first->get(), second->get());
+    EXPECT_EQ(Counters().hits.load(), 1);
+    EXPECT_EQ(Counters().misses.load(), 1);
+}
+
+TEST_F(CachedRepositoryTest, UpdateInvalidatesEntryTest) {
+    auto cache = Cache(16, 60000);
+    EXPECT_CALL(*repositoryMock, ReadById("tournament-id"))
+        .Times(2)
+        .WillRepeatedly(testing::Return(TournamentWithId("tournament-id")));
+    EXPECT_CALL(*repositoryMock, Update("tournament-id", testing::_))
+        .WillOnce(testing::Return(std::expected<std::string, std::string>("tournament-id")));
+
+    cache->ReadById("tournament-id");
+    cache->Update("tournament-id", domain::Tournament("Renamed", 2025));
+    cache->ReadById("tournament-id");
+
+    EXPECT_EQ(Counters().hits.load(), 0);
+    EXPECT_EQ(Counters().misses.load(), 2);
+    EXPECT_EQ(Counters().invalidations.load(), 1);
+}
+
+TEST_F(CachedRepositoryTest, UpdateInsideUnitOfWorkInvalidatesOnCommitTest) {
+    auto cache = Cache(16, 60000);
+    EXPECT_CALL(*repositoryMock, ReadById("tournament-id"))
+        .Times(2)
+        .WillRepeatedly(testing::Return(TournamentWithId("tournament-id")));
+    EXPECT_CALL(*repositoryMock, Update("tournament-id", testing::_))
+        .WillOnce(testing::Return(std::expected<std::string, std::string>("tournament-id")));
+
+    cache->ReadById("tournament-id");
+    {
+        UnitOfWork unit;
+        cache->Update("tournament-id", domain::Tournament("Renamed", 2025));
+        // Hasta el commit la entrada sigue siendo la versión confirmada
+        cache->ReadById("tournament-id");
+        EXPECT_EQ(Counters().invalidations.load(), 0);
+        ASSERT_TRUE(unit.Commit().has_value());
+        EXPECT_EQ(Counters().invalidations.load(), 1);
+    }
+    cache->ReadById("tournament-id");
+
+    EXPECT_EQ(Counters().hits.load(), 1);
+    EXPECT_EQ(Counters().misses.load(), 2);
+}
+
+TEST_F(CachedRepositoryTest, UpdateInsideRolledBackUnitOfWorkInvalidatesTest) {
+    auto cache = Cache(16, 60000);
+    EXPECT_CALL(*repositoryMock, ReadById("tournament-id"))
+        .Times(2)
+        .WillRepeatedly(testing::Return(TournamentWithId("tournament-id")));
+    EXPECT_CALL(*repositoryMock, Update("tournament-id", testing::_))
+        .WillOnce(testing::Return(std::expected<std::string, std::string>("tournament-id")));
+
+    {
+        UnitOfWork unit;
+        cache->Update("tournament-id", domain::Tournament("Renamed", 2025));
+        // Una lectura dentro de la unidad puede guardar filas que el rollback descarta
+        cache->ReadById("tournament-id");
+    }
+    cache->ReadById("tournament-id");
+
+    EXPECT_EQ(Counters().misses.load(), 2);
+    EXPECT_EQ(Counters().invalidations.load(), 1);
+}
+
+TEST_F(CachedRepositoryTest, EvictsLeastRecentlyUsedTest) {
+    auto cache = Cache(2, 60000);
+    EXPECT_CALL(*repositoryMock, ReadById(testing::_))
+        .WillRepeatedly(testing::Invoke([](const std::string& id) { return TournamentWithId(id); }));
+
+    cache->ReadById("a");
+    cache->ReadById("b");
+    cache->ReadById("a");
+    // Sale "b", la menos usada
+    cache->ReadById("c");
+    cache->ReadById("a");
+    cache->ReadById("b");
+
+    EXPECT_EQ(Counters().hits.load(), 2);
+    EXPECT_EQ(Counters().misses.load(), 4);
+    EXPECT_EQ(Counters().evictions.load(), 2);
+}
+
+TEST_F(CachedRepositoryTest, ErrorsAreNotStoredTest) {
+    auto cache = Cache(16, 60000);
+    EXPECT_CALL(*repositoryMock, ReadById("missing-id"))
+        .Times(2)
+        .WillRepeatedly(testing::Return(std::unexpected<std::string>("Tournament not found")));
+
+    cache->ReadById("missing-id");
+    const auto missing = cache->ReadById("missing-id");
+
+    EXPECT_FALSE(missing.has_value());
+    EXPECT_EQ(Counters().hits.load(), 0);
+    EXPECT_EQ(Counters().misses.load(), 2);
+}
+
+TEST_F(CachedRepositoryTest, ExpiredEntryIsReadAgainTest) {
+    auto cache = Cache(16, 0);
+    EXPECT_CALL(*repositoryMock, ReadById("tournament-id"))
+        .Times(2)
+        .WillRepeatedly(testing::Return(TournamentWithId("tournament-id")));
+
+    cache->ReadById("tournament-id");
+    cache->ReadById("tournament-id");
+
+    EXPECT_EQ(Counters().hits.load(), 0);
+    EXPECT_EQ(Counters().misses.load(), 2);
+}
+
+// Un Evict que llega mientras la lectura está en el repositorio: lo leído puede ser la
+// versión anterior, así que no se guarda y la siguiente lectura vuelve a la base
+TEST_F(CachedRepositoryTest, EvictDuringReadIsNotOverwrittenTest) {
+    auto cache = Cache(16, 60000);
+    EXPECT_CALL(*repositoryMock, ReadById("tournament-id"))
+        .Times(2)
+        .WillOnce(testing::Invoke([&cache](const std::string& id) {
+            cache->Evict(id);
+            return TournamentWithId(id);
+        }))
+        .WillOnce(testing::Return(TournamentWithId("tournament-id")));
+
+    const auto first = cache->ReadById("tournament-id");
+    const auto second = cache->ReadById("tournament-id");
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(Counters().hits.load(), 0);
+    EXPECT_EQ(Counters().misses.load(), 2);
+}
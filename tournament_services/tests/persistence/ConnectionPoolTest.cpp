@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "persistence/configuration/ConnectionPool.hpp"
+
+using namespace std::chrono_literals;
+
+// Reemplazo de pqxx::connection: el test decide si está abierta y si responde al ping
+struct FakeConnection {
+    std::atomic<bool> open{true};
+    std::atomic<bool> healthy{true};
+};
+
+class ConnectionPoolTest : public ::testing::Test {
+protected:
+    std::atomic<int> connects{0};
+
+    ConnectionPoolCallbacks<FakeConnection> Callbacks() {
+        return {
+            .connect = [this] {
+                connects.fetch_add(1);
+                return std::make_unique<FakeConnection>();
+            },
+            .isOpen = [](const FakeConnection& connection) { return connection.open.load(); },
+            .ping = [](FakeConnection& connection) { return connection.healthy.load(); }
+        };
+    }
+
+    static ConnectionPoolOptions Options(size_t minSize, size_t maxSize) {
+        return {
+            .minSize = minSize,
+            .maxSize = maxSize,
+            .acquireTimeout = 2000ms,
+            .growAfterWait = 5ms,
+            .idleTimeout = 60000ms,
+            .healthCheckInterval = 60000ms,
+            .reconnectInterval = 5ms,
+            .shardCount = 2
+        };
+    }
+
+    // El hilo de mantenimiento trabaja en segundo plano; se espera su efecto con un tope
+    static bool WaitUntil(const std::function<bool()>& condition, std::chrono::milliseconds timeout = 2000ms) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }
+};
+
+TEST_F(ConnectionPoolTest, AcquireTimesOutWhenExhaustedTest) {
+    ConnectionPool<FakeConnection> pool(Callbacks(), Options(1, 1));
+    auto held = pool.Acquire();
+
+    EXPECT_THROW(pool.Acquire(20ms), ConnectionTimeoutError);
+
+    const auto stats = pool.Stats();
+    EXPECT_EQ(stats.timeouts, 1);
+    EXPECT_EQ(stats.waits, 1);
+    EXPECT_GE(stats.maxWait, 20ms);
+    EXPECT_EQ(stats.acquisitions, 1);
+}
+
+TEST_F(ConnectionPoolTest, ReturnedConnectionIsReusedTest) {
+    ConnectionPool<FakeConnection> pool(Callbacks(), Options(1, 1));
+    FakeConnection* first;
+    {
+        auto handle = pool.Acquire();
+        first = &*handle;
+    }
+
+    auto handle = pool.Acquire();
+
+    EXPECT_EQ(&*handle, first);
+    EXPECT_EQ(connects.load(), 1);
+}
+
+TEST_F(ConnectionPoolTest, BrokenConnectionIsReopenedTest) {
+    ConnectionPool<FakeConnection> pool(Callbacks(), Options(1, 1));
+    {
+        auto handle = pool.Acquire();
+        // Se cae mientras está prestada; al devolverla sale de circulación
+        handle->open = false;
+    }
+
+    auto handle = pool.Acquire();
+
+    EXPECT_TRUE(handle->open.load());
+    EXPECT_EQ(connects.load(), 2);
+    EXPECT_EQ(pool.Size(), 1);
+}
+
+TEST_F(ConnectionPoolTest, FailedInitialConnectIsRetriedTest) {
+    std::atomic<int> attempts{0};
+    auto callbacks = Callbacks();
+    callbacks.connect = [&attempts] {
+        if (attempts.fetch_add(1) == 0) {
+            throw std::runtime_error("connection refused");
+        }
+        return std::make_unique<FakeConnection>();
+    };
+    ConnectionPool<FakeConnection> pool(callbacks, Options(1, 1));
+
+    auto handle = pool.Acquire();
+
+    EXPECT_TRUE(handle->open.load());
+    EXPECT_GE(attempts.load(), 2);
+}
+
+TEST_F(ConnectionPoolTest, IdleConnectionFailingPingIsReplacedTest) {
+    auto options = Options(1, 1);
+    options.healthCheckInterval = 10ms;
+    ConnectionPool<FakeConnection> pool(Callbacks(), options);
+    {
+        auto handle = pool.Acquire();
+        handle->healthy = false;
+    }
+
+    ASSERT_TRUE(WaitUntil([&] { return connects.load() == 2; }));
+    auto handle = pool.Acquire();
+
+    EXPECT_TRUE(handle->healthy.load());
+}
+
+TEST_F(ConnectionPoolTest, GrowsToMaxSizeUnderWaitTest) {
+    ConnectionPool<FakeConnection> pool(Callbacks(), Options(1, 3));
+    std::vector<ConnectionPool<FakeConnection>::Handle> held;
+
+    held.push_back(pool.Acquire());
+    held.push_back(pool.Acquire());
+    held.push_back(pool.Acquire());
+
+    EXPECT_EQ(pool.Size(), 3);
+    EXPECT_EQ(connects.load(), 3);
+    // Con maxSize alcanzado ya no crece: la espera termina en timeout
+    EXPECT_THROW(pool.Acquire(30ms), ConnectionTimeoutError);
+    EXPECT_EQ(pool.Size(), 3);
+
+    const auto stats = pool.Stats();
+    EXPECT_EQ(stats.grown, 2);
+    EXPECT_EQ(stats.inUse, 3);
+}
+
+TEST_F(ConnectionPoolTest, ReapsIdleConnectionsToMinSizeTest) {
+    auto options = Options(1, 3);
+    options.idleTimeout = 20ms;
+    options.healthCheckInterval = 10ms;
+    ConnectionPool<FakeConnection> pool(Callbacks(), options);
+    {
+        std::vector<ConnectionPool<FakeConnection>::Handle> held;
+        for (int i = 0; i < 3; i++) {
+            held.push_back(pool.Acquire());
+        }
+        ASSERT_EQ(pool.Size(), 3);
+    }
+
+    ASSERT_TRUE(WaitUntil([&] { return pool.Size() == 1; }));
+    EXPECT_EQ(pool.Stats().reaped, 2);
+
+    // Lo que queda sigue sirviendo préstamos
+    auto handle = pool.Acquire();
+    EXPECT_TRUE(handle->open.load());
+}
+
+TEST_F(ConnectionPoolTest, StatsTest) {
+    ConnectionPool<FakeConnection> pool(Callbacks(), Options(2, 4));
+    {
+        auto first = pool.Acquire();
+        auto second = pool.Acquire();
+
+        const auto stats = pool.Stats();
+        EXPECT_EQ(stats.size, 2);
+        EXPECT_EQ(stats.inUse, 2);
+        EXPECT_EQ(stats.minSize, 2);
+        EXPECT_EQ(stats.maxSize, 4);
+        EXPECT_EQ(stats.acquisitions, 2);
+        EXPECT_EQ(stats.waits, 0);
+        EXPECT_EQ(stats.timeouts, 0);
+    }
+
+    const auto stats = pool.Stats();
+    EXPECT_EQ(stats.inUse, 0);
+    EXPECT_EQ(stats.grown, 0);
+    EXPECT_EQ(stats.reaped, 0);
+}